@@ -102,6 +102,10 @@ extern SDL_DECLSPEC bool SDLCALL SDL_TryLockSpinlock(SDL_SpinLock *lock);
 /**
  * Lock a spin lock by setting it to a non-zero value.
  *
+ * If the lock is held by another thread, this spins for a while, adapting
+ * how long it spins to how long contended locks have recently been held,
+ * and then sleeps until the lock is released.
+ *
  * ***Please note that spinlocks are dangerous if you don't know what you're
  * doing. Please be careful using any sort of spinlock!***
  *
@@ -511,6 +515,61 @@ extern SDL_DECLSPEC int SDLCALL SDL_AddAtomicInt(SDL_AtomicInt *a, int v);
 #define SDL_AtomicDecRef(a)    (SDL_AddAtomicInt(a, -1) == 1)
 #endif
 
+/**
+ * Wait until an atomic variable no longer holds a given value.
+ *
+ * If `a` holds `value`, the calling thread sleeps until another thread calls
+ * SDL_WakeAtomicInt() on the same variable or the timeout elapses. If `a`
+ * holds any other value, this returns immediately. Checking the value and
+ * going to sleep is atomic with respect to SDL_WakeAtomicInt(), so a thread
+ * that changes the value and then wakes the variable can't be missed.
+ *
+ * This lets threads block on a state change without a separate mutex and
+ * condition variable, like a futex. On Linux this is a futex, on other
+ * platforms it is implemented with a small table of mutexes and condition
+ * variables shared by all atomic variables.
+ *
+ * This function may return before the value changes, so it should always be
+ * called in a loop that checks the value again.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicInt variable to wait on.
+ * \param value the value that `a` holds while the caller should wait.
+ * \param timeoutNS the timeout in nanoseconds, 0 to not wait at all, or -1 to
+ *                  wait indefinitely.
+ * \returns false if the timeout elapsed, true otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WakeAtomicInt
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WaitAtomicInt(SDL_AtomicInt *a, int value, Sint64 timeoutNS);
+
+/**
+ * Wake threads waiting on an atomic variable.
+ *
+ * This wakes threads blocked in SDL_WaitAtomicInt() on `a`. The new value
+ * should be stored in `a` before calling this function.
+ *
+ * ***Note: If you don't know what this function is for, you shouldn't use
+ * it!***
+ *
+ * \param a a pointer to an SDL_AtomicInt variable that has changed.
+ * \param wake_all true to wake all waiting threads, false to wake at least
+ *                 one of them.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WaitAtomicInt
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WakeAtomicInt(SDL_AtomicInt *a, bool wake_all);
+
 /**
  * A type representing an atomic unsigned 32-bit value.
  *
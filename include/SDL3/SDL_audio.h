@@ -1061,6 +1061,28 @@ extern SDL_DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_Audio
  */
 extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * The algorithm an audio stream uses to change the sample rate.
+ *
+ * The sinc modes filter the audio with a windowed sinc filter, which keeps
+ * the most detail and adds the least noise, but gets more expensive as the
+ * filter gets longer. The other modes just interpolate between neighbouring
+ * sample frames, which is much cheaper but adds audible aliasing.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_NEAREST,     /**< Use the nearest sample frame. */
+    SDL_AUDIO_RESAMPLE_LINEAR,      /**< Linear interpolation of the two nearest sample frames. */
+    SDL_AUDIO_RESAMPLE_CUBIC,       /**< Cubic interpolation of the four nearest sample frames. */
+    SDL_AUDIO_RESAMPLE_SINC_LOW,    /**< Short sinc filter, 8 sample frames. */
+    SDL_AUDIO_RESAMPLE_SINC_MEDIUM, /**< Sinc filter of 12 sample frames, the default. */
+    SDL_AUDIO_RESAMPLE_SINC_HIGH    /**< Long sinc filter, 32 sample frames. */
+} SDL_AudioResampleQuality;
+
 /**
  * Get the properties associated with an audio stream.
  *
@@ -1074,6 +1096,11 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
  *   be cleaned up. Streams that are not cleaned up will still be unbound from
  *   devices when the audio subsystem quits. This property was added in SDL
  *   3.4.0.
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: the SDL_AudioResampleQuality
+ *   used when the input and output sample rates differ. Defaults to
+ *   SDL_AUDIO_RESAMPLE_SINC_MEDIUM. It can be changed at any time, and is
+ *   used from the next time data is read from the stream. This property was
+ *   added in SDL 3.4.0.
  *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -1086,6 +1113,7 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
 #define SDL_PROP_AUDIOSTREAM_AUTO_CLEANUP_BOOLEAN "SDL.audiostream.auto_cleanup"
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER "SDL.audiostream.resample_quality"
 
 
 /**
@@ -1696,6 +1724,52 @@ extern SDL_DECLSPEC bool SDLCALL SDL_FlushAudioStream(SDL_AudioStream *stream);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_ClearAudioStream(SDL_AudioStream *stream);
 
+/**
+ * Give an audio stream a lock-free input buffer for a single feeding thread.
+ *
+ * Normally, putting data into a stream and getting data out of it both hold
+ * the stream's lock, so a thread feeding a stream and the audio device
+ * thread reading it can stall each other. Once this is set, data put into
+ * the stream is copied into a wait-free ring buffer of at least `frames`
+ * sample frames without taking the lock, and is moved into the stream the
+ * next time something reads from it.
+ *
+ * This comes with some rules:
+ *
+ * - Only one thread may put data into the stream (with
+ *   SDL_PutAudioStreamData(), SDL_PutAudioStreamDataNoCopy() or
+ *   SDL_PutAudioStreamPlanarData()).
+ * - Putting data never waits for the other side. If the ring buffer doesn't
+ *   have room for all of it, the call fails and nothing is added, so try
+ *   again later or use a bigger buffer.
+ * - The input format and channel count can't change;
+ *   SDL_SetAudioStreamFormat() fails if it tries to. The sample rate and
+ *   channel map can still change.
+ * - The put callback isn't called for data added through the ring buffer.
+ * - SDL_PutAudioStreamDataNoCopy() copies the data, and calls its callback
+ *   before returning.
+ *
+ * Setting `frames` to zero moves anything left in the ring buffer into the
+ * stream and goes back to the usual locking behavior.
+ *
+ * The stream's input format must be set before calling this function.
+ *
+ * \param stream the audio stream to change.
+ * \param frames the minimum size of the ring buffer, in sample frames of the
+ *               input format, or 0 to stop using one.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               while another thread is putting data into the stream.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_SetAudioStreamFormat
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamSingleProducer(SDL_AudioStream *stream, int frames);
+
 /**
  * Use this function to pause audio playback on the audio device associated
  * with an audio stream.
@@ -2202,6 +2276,37 @@ typedef void (SDLCALL *SDL_AudioPostmixCallback)(void *userdata, const SDL_Audio
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioPostmixCallback(SDL_AudioDeviceID devid, SDL_AudioPostmixCallback callback, void *userdata);
 
+/**
+ * Advance an audio device that runs on a manual clock.
+ *
+ * When SDL_HINT_AUDIO_OFFLINE_CLOCK is set to "manual", the dummy and disk
+ * audio drivers don't run a thread for their devices. Instead, each call to
+ * this function moves the device's clock forward by `frames` sample frames,
+ * and processes audio on the calling thread: bound streams are read and
+ * mixed, postmix callbacks are called, and the disk driver writes its file.
+ *
+ * Audio is processed a whole device buffer at a time, so if `frames` isn't
+ * a multiple of the device's buffer size, the rest is carried over to the
+ * next call. Over many calls, the device processes exactly as many frames as
+ * it was asked for, so an app can keep it in step with a video frame rate,
+ * for example.
+ *
+ * Any audio device ID for the device can be used, physical or logical.
+ *
+ * \param devid the ID of an opened audio device.
+ * \param frames the number of sample frames to advance the clock by.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceFormat
+ * \sa SDL_SetAudioPostmixCallback
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_StepAudioDevice(SDL_AudioDeviceID devid, int frames);
+
 
 /**
  * Load the audio data of a WAVE file into memory.
@@ -2319,6 +2424,97 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * Open a WAVE file as an audio stream that decodes it as it plays.
+ *
+ * Unlike SDL_LoadWAV_IO(), this only reads the headers of the WAVE data up
+ * front. The audio data is read from `src` and decoded a block at a time
+ * whenever the stream needs more data, so long files start playing right
+ * away and only need a small, fixed amount of memory.
+ *
+ * The returned stream's input format is the format of the WAVE data, and its
+ * output format starts out the same; change it with
+ * SDL_SetAudioStreamFormat() or bind the stream to an audio device to have
+ * it converted. Don't put any data into the stream yourself or set its get
+ * callback. When the end of the WAVE data is reached, the stream is flushed.
+ *
+ * The stream has the following properties:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER`: the number of sample frames in
+ *   the WAVE data.
+ *
+ * This supports the same formats and hints as SDL_LoadWAV_IO(). It is
+ * required that the data source supports seeking, and `src` must stay valid
+ * until the stream is destroyed.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the stream is
+ *                destroyed, or before returning in the case of an error.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, may be NULL.
+ * \returns an audio stream on success, ready to be bound to an audio device,
+ *          or NULL on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_OpenWAVStream
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec);
+
+#define SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER "SDL.audiostream.wav.frames"
+
+/**
+ * Open a WAVE file from a file path as an audio stream that decodes it as it
+ * plays.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_OpenWAVStream_IO(SDL_IOFromFile(path, "rb"), true, spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, may be NULL.
+ * \returns an audio stream on success, ready to be bound to an audio device,
+ *          or NULL on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_OpenWAVStream_IO
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec);
+
+/**
+ * Move the playback position of a WAVE audio stream.
+ *
+ * This discards any data queued in the stream, and decoding continues from
+ * the given sample frame. Compressed data is decoded from the start of the
+ * block that contains the frame.
+ *
+ * \param stream an audio stream created by SDL_OpenWAVStream_IO() or
+ *               SDL_OpenWAVStream().
+ * \param frame the sample frame to continue from. Seeking past the end of
+ *              the data ends the stream.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_OpenWAVStream_IO
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame);
+
 /**
  * Mix audio data in a specified format.
  *
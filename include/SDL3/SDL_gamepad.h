@@ -362,6 +362,12 @@ extern SDL_DECLSPEC int SDLCALL SDL_AddGamepadMapping(const char *mapping);
  * processing it, so take this into consideration if you are in a memory
  * constrained environment.
  *
+ * The stream may also contain a binary database created with
+ * SDL_SaveGamepadMappingsToIO(), which is loaded without any text parsing.
+ * If `src` was created with SDL_IOFromMem() or SDL_IOFromConstMem(), for
+ * example over a memory mapped file, a binary database is read in place
+ * rather than copied.
+ *
  * \param src the data stream for the mappings to be added.
  * \param closeio if true, calls SDL_CloseIO() on `src` before returning, even
  *                in the case of an error.
@@ -376,6 +382,7 @@ extern SDL_DECLSPEC int SDLCALL SDL_AddGamepadMapping(const char *mapping);
  * \sa SDL_AddGamepadMappingsFromFile
  * \sa SDL_GetGamepadMapping
  * \sa SDL_GetGamepadMappingForGUID
+ * \sa SDL_SaveGamepadMappingsToIO
  * \sa SDL_HINT_GAMECONTROLLERCONFIG
  * \sa SDL_HINT_GAMECONTROLLERCONFIG_FILE
  * \sa SDL_EVENT_GAMEPAD_ADDED
@@ -416,6 +423,36 @@ extern SDL_DECLSPEC int SDLCALL SDL_AddGamepadMappingsFromIO(SDL_IOStream *src,
  */
 extern SDL_DECLSPEC int SDLCALL SDL_AddGamepadMappingsFromFile(const char *file);
 
+/**
+ * Save the loaded gamepad mappings as a binary database.
+ *
+ * This saves every mapping that was added by the application or from hints,
+ * but not the mappings built into SDL, in a compact binary form that can be
+ * passed to SDL_AddGamepadMappingsFromIO() or
+ * SDL_AddGamepadMappingsFromFile(). Loading a binary database skips all the
+ * text parsing, which can be considerably faster for large databases.
+ *
+ * The database is specific to the current platform and SDL version, and any
+ * `hint:` conditions in the mappings are evaluated when they are added, so
+ * the database should be regenerated whenever the text mappings or those
+ * hints change. A database for a different platform or version is ignored
+ * when loading.
+ *
+ * \param dst the data stream to write the database to.
+ * \param closeio if true, calls SDL_CloseIO() on `dst` before returning, even
+ *                in the case of an error.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddGamepadMappingsFromIO
+ * \sa SDL_AddGamepadMappingsFromFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SaveGamepadMappingsToIO(SDL_IOStream *dst, bool closeio);
+
 /**
  * Reinitialize the SDL mapping database to its initial state.
  *
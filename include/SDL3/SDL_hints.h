@@ -522,6 +522,30 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_INCLUDE_MONITORS "SDL_AUDIO_INCLUDE_MONITORS"
 
+/**
+ * A variable controlling how the dummy and disk audio drivers keep time.
+ *
+ * These drivers don't talk to any hardware, so they can render audio faster
+ * than real-time, which is useful for automated tests and for exporting
+ * audio with video. Rendered audio can be collected with
+ * SDL_SetAudioPostmixCallback(), or from the disk driver's output file.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "realtime": Process audio at the rate it would play, adjusted by
+ *   SDL_HINT_AUDIO_DUMMY_TIMESCALE or SDL_HINT_AUDIO_DISK_TIMESCALE.
+ *   (default)
+ * - "fast": Process audio as fast as possible, without sleeping.
+ * - "manual": There is no audio device thread, and audio is only processed
+ *   when the app calls SDL_StepAudioDevice(), so it can run in lock-step
+ *   with the app's own clock.
+ *
+ * This hint should be set before the audio subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_OFFLINE_CLOCK "SDL_AUDIO_OFFLINE_CLOCK"
+
 /**
  * A variable controlling whether SDL updates joystick state when getting
  * input events.
@@ -591,6 +615,42 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable describing the virtual devices exposed by the dummy camera
+ * driver.
+ *
+ * The dummy camera driver is only used when requested with
+ * SDL_HINT_CAMERA_DRIVER, and generates frames without any hardware, which
+ * is useful for testing and benchmarking the camera pipeline on headless
+ * machines.
+ *
+ * The variable is a comma-separated list of devices. Each device is
+ * described by a pixel format, a resolution and an optional frame rate,
+ * followed by optional flags, separated by spaces:
+ *
+ * - The format is one of "YUY2", "NV12", "MJPG" or "XRGB8888".
+ * - The resolution is "WIDTHxHEIGHT", optionally followed by "@FPS" or
+ *   "@NUMERATOR/DENOMINATOR". The default frame rate is 30 frames per
+ *   second.
+ * - "free" makes the device produce a new frame as soon as the app has
+ *   released one, instead of pacing frames at the frame rate.
+ * - "file=PATH" streams frames from a file instead of generating a test
+ *   pattern. The rest of the device description, up to the next comma, is
+ *   the path. Raw formats expect tightly packed frames back to back; MJPG
+ *   expects concatenated JPEG images. The file is restarted when it runs
+ *   out of frames.
+ *
+ * For example: "NV12 1280x720@30, MJPG 640x480@15 free, YUY2 320x240
+ * file=frames.yuy2"
+ *
+ * The default value is unset, which exposes a single "YUY2 640x480@30"
+ * device. This hint needs to be set before the camera subsystem is
+ * initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_CAMERA_DUMMY_DEVICES "SDL_CAMERA_DUMMY_DEVICES"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -772,6 +832,31 @@ extern "C" {
  */
 #define SDL_HINT_EVDEV_DEVICES "SDL_EVDEV_DEVICES"
 
+/**
+ * A variable controlling whether high rate motion events are coalesced in the
+ * event queue.
+ *
+ * When enabled, a mouse motion, joystick axis, gamepad axis or sensor update
+ * event replaces the previous event for the same device and axis or sensor
+ * if that event is still waiting in the queue, instead of being added after
+ * it. The application then only sees the latest value for each axis and
+ * sensor once per pump, and the relative motion of coalesced mouse motion
+ * events is accumulated, so no movement is lost. This greatly reduces queue
+ * traffic from 1 kHz controllers, gyro sensors and high resolution mice, at
+ * the cost of intermediate samples, which may matter to applications that
+ * integrate sensor data. Event watchers still see every event.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Every motion event is queued. (default)
+ * - "1": Motion events are coalesced while they are waiting in the queue.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_EVENT_COALESCING "SDL_EVENT_COALESCING"
+
 /**
  * A variable controlling verbosity of the logging of SDL events pushed onto
  * the internal queue.
@@ -1159,6 +1244,21 @@ extern "C" {
  */
 #define SDL_HINT_IOS_HIDE_HOME_INDICATOR "SDL_IOS_HIDE_HOME_INDICATOR"
 
+/**
+ * A variable controlling the number of worker threads in job systems.
+ *
+ * The variable can be set to a positive number of worker threads. By default
+ * job systems use one less worker thread than the number of logical CPU
+ * cores, and at least one.
+ *
+ * This hint applies to SDL's shared job system and to job systems created by
+ * passing 0 to SDL_CreateJobSystem(). It should be set before calling
+ * SDL_CreateJobSystem() or first using the shared job system.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOB_WORKERS "SDL_JOB_WORKERS"
+
 /**
  * A variable that lets you enable joystick (and gamecontroller) events even
  * when your app is in the background.
@@ -2385,6 +2485,52 @@ extern "C" {
  */
 #define SDL_HINT_LOGGING "SDL_LOGGING"
 
+/**
+ * A variable controlling whether log messages are written on a background
+ * thread.
+ *
+ * When enabled, SDL_LogMessage() and friends format the message and add it
+ * to a lock-free queue, and a background thread passes the queued messages
+ * to the log output function. This keeps threads that log heavily, like the
+ * audio thread or the render loop, from waiting on console or file I/O.
+ * Messages are passed to the output function in the order they were queued,
+ * but that is done on the background thread, not on the thread that logged
+ * them.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Log messages are written on the thread that logs them. (default)
+ * - "1": Log messages are queued and written on a background thread.
+ *
+ * This hint can be set anytime. Disabling it writes out the queued messages
+ * first.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_LOG_ASYNC_OVERFLOW
+ * \sa SDL_FlushLogMessages
+ */
+#define SDL_HINT_LOG_ASYNC "SDL_LOG_ASYNC"
+
+/**
+ * A variable controlling what happens when the asynchronous log queue is
+ * full.
+ *
+ * This is used when SDL_HINT_LOG_ASYNC is enabled and messages are logged
+ * faster than the output function can write them.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "drop": The message is discarded, and the number of discarded messages
+ *   is logged once there is room again. (default)
+ * - "block": The logging thread waits until there is room in the queue.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_LOG_ASYNC_OVERFLOW "SDL_LOG_ASYNC_OVERFLOW"
+
 /**
  * A variable controlling whether to force the application to become the
  * foreground process when launched on macOS.
@@ -3283,6 +3429,22 @@ extern "C" {
  */
 #define SDL_HINT_TOUCH_MOUSE_EVENTS "SDL_TOUCH_MOUSE_EVENTS"
 
+/**
+ * A variable naming a file to write a trace of SDL's internal work to.
+ *
+ * If this is set when SDL is initialized, SDL starts tracing right away
+ * and saves the trace to this file in the Chrome trace event format when
+ * SDL_Quit() is called.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_StartTracing
+ * \sa SDL_SaveTrace
+ */
+#define SDL_HINT_TRACE_FILE "SDL_TRACE_FILE"
+
 /**
  * A variable controlling whether trackpads should be treated as touch
  * devices.
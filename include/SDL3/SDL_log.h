@@ -531,6 +531,27 @@ extern SDL_DECLSPEC void SDLCALL SDL_GetLogOutputFunction(SDL_LogOutputFunction
  */
 extern SDL_DECLSPEC void SDLCALL SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata);
 
+/**
+ * Wait for queued log messages to be written.
+ *
+ * When SDL_HINT_LOG_ASYNC is enabled, log messages are queued and passed to
+ * the log output function on a background thread. This function waits until
+ * every message queued before the call has been passed to the output
+ * function. It does nothing if asynchronous logging is disabled, or when
+ * called from the log output function itself.
+ *
+ * Replacing the log output function with SDL_SetLogOutputFunction() flushes
+ * the queued messages first, so they are passed to the function that was set
+ * when they were logged.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_LOG_ASYNC
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_FlushLogMessages(void);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -464,6 +464,19 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   enabled, this will be 1.0. This property can change dynamically when
  *   SDL_EVENT_WINDOW_HDR_STATE_CHANGED is sent.
  *
+ * These properties describe the memory used to queue rendering, and are
+ * updated each time SDL_RenderPresent() is called:
+ *
+ * - `SDL_PROP_RENDERER_FRAME_COMMANDS_NUMBER`: the number of render commands
+ *   queued during the last frame.
+ * - `SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER`: the number of bytes of
+ *   vertex data queued during the last frame.
+ * - `SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER`: the number of render command
+ *   chunks currently allocated. Unused chunks are released after a while.
+ * - `SDL_PROP_RENDERER_VERTEX_BYTES_ALLOCATED_NUMBER`: the size of the vertex
+ *   buffer currently allocated, in bytes. This shrinks back after a while if
+ *   recent frames no longer need it.
+ *
  * With the direct3d renderer:
  *
  * - `SDL_PROP_RENDERER_D3D9_DEVICE_POINTER`: the IDirect3DDevice9 associated
@@ -528,6 +541,10 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_HDR_ENABLED_BOOLEAN                       "SDL.renderer.HDR_enabled"
 #define SDL_PROP_RENDERER_SDR_WHITE_POINT_FLOAT                     "SDL.renderer.SDR_white_point"
 #define SDL_PROP_RENDERER_HDR_HEADROOM_FLOAT                        "SDL.renderer.HDR_headroom"
+#define SDL_PROP_RENDERER_FRAME_COMMANDS_NUMBER                     "SDL.renderer.frame.commands"
+#define SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER                 "SDL.renderer.frame.vertex_bytes"
+#define SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER                     "SDL.renderer.command_chunks"
+#define SDL_PROP_RENDERER_VERTEX_BYTES_ALLOCATED_NUMBER             "SDL.renderer.vertex_bytes_allocated"
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
@@ -2018,6 +2018,7 @@ typedef int (SDLCALL *SDL_CompareCallback_r)(void *userdata, const void *a, cons
  *
  * \sa SDL_bsearch_r
  * \sa SDL_qsort
+ * \sa SDL_radixsort
  */
 extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
@@ -2079,6 +2080,67 @@ extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t si
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
+/**
+ * The type of the key that SDL_radixsort() sorts elements by.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_radixsort
+ */
+typedef enum SDL_SortKeyType
+{
+    SDL_SORTKEY_UINT32,     /**< Uint32, sorted in increasing order */
+    SDL_SORTKEY_SINT32,     /**< Sint32, sorted in increasing order */
+    SDL_SORTKEY_UINT64,     /**< Uint64, sorted in increasing order */
+    SDL_SORTKEY_SINT64,     /**< Sint64, sorted in increasing order */
+    SDL_SORTKEY_FLOAT,      /**< float, sorted in increasing order, with -0.0f before 0.0f and NaNs at either end by sign */
+    SDL_SORTKEY_DOUBLE      /**< double, sorted in increasing order, with -0.0 before 0.0 and NaNs at either end by sign */
+} SDL_SortKeyType;
+
+/**
+ * Sort an array by a numeric key stored in each element, without a compare
+ * function.
+ *
+ * This is a stable radix sort: elements with equal keys keep their original
+ * order. It is usually much faster than SDL_qsort() for large arrays, since
+ * it never calls back into the application.
+ *
+ * The key is read from `key_offset` bytes into each element, and doesn't
+ * need to be aligned. To sort a plain array of numbers, pass the size of the
+ * number as `size` and 0 as `key_offset`.
+ *
+ * For example:
+ *
+ * ```c
+ * typedef struct {
+ *     float depth;
+ *     int texture;
+ * } sprite;
+ *
+ * sprite sprites[] = {
+ *     { 3.0f, 0 }, { 1.0f, 1 }, { 2.0f, 2 }
+ * };
+ *
+ * SDL_radixsort(sprites, SDL_arraysize(sprites), sizeof(sprites[0]), offsetof(sprite, depth), SDL_SORTKEY_FLOAT);
+ * ```
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param key_offset the offset of the key within each element, in bytes.
+ * \param key_type the type of the key.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_qsort
+ * \sa SDL_qsort_r
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_radixsort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type);
+
 /**
  * Compute the absolute value of `x`.
  *
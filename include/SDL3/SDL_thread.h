@@ -569,6 +569,220 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetTLS(SDL_TLSID *id, const void *value, SD
  */
 extern SDL_DECLSPEC void SDLCALL SDL_CleanupTLS(void);
 
+/**
+ * A pool of worker threads that run jobs.
+ *
+ * Each worker thread keeps its own queue of jobs, and idle workers steal
+ * jobs from busy ones, so jobs that submit more jobs keep all the workers
+ * busy without contending on a single queue.
+ *
+ * SDL keeps a shared job system that is used when NULL is passed to the job
+ * functions, so that an app and SDL itself can share the same worker
+ * threads instead of each creating enough threads for every CPU core.
+ *
+ * These are opaque data.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobSystem
+ * \sa SDL_SubmitJob
+ * \sa SDL_ParallelFor
+ */
+typedef struct SDL_JobSystem SDL_JobSystem;
+
+/**
+ * A job that has been submitted to a job system.
+ *
+ * These are opaque data.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJob
+ * \sa SDL_DetachJob
+ */
+typedef struct SDL_Job SDL_Job;
+
+/**
+ * The function run by a job.
+ *
+ * \param userdata the `userdata` pointer passed to SDL_SubmitJob().
+ *
+ * \threadsafety This will be called on one of the job system's worker
+ *               threads, or on a thread that is waiting for jobs to
+ *               complete.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobCallback)(void *userdata);
+
+/**
+ * The function run for each range of indices by SDL_ParallelFor().
+ *
+ * \param userdata the `userdata` pointer passed to SDL_ParallelFor().
+ * \param start the first index in the range.
+ * \param end one past the last index in the range.
+ *
+ * \threadsafety This may be called on several threads at once, each with a
+ *               different range.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_ParallelFor
+ */
+typedef void (SDLCALL *SDL_ParallelForCallback)(void *userdata, int start, int end);
+
+/**
+ * Create a new job system.
+ *
+ * Most apps should use SDL's shared job system by passing NULL to the job
+ * functions instead, this is useful if you need a separate set of worker
+ * threads, e.g. for jobs that block for long periods of time.
+ *
+ * If the job system can't create any threads, e.g. if SDL was built without
+ * thread support, jobs are run on the thread that submits them.
+ *
+ * \param num_workers the number of worker threads to create, or 0 to use
+ *                    SDL_HINT_JOB_WORKERS or one less than the number of
+ *                    logical CPU cores.
+ * \returns the new job system or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyJobSystem
+ * \sa SDL_SubmitJob
+ * \sa SDL_ParallelFor
+ */
+extern SDL_DECLSPEC SDL_JobSystem * SDLCALL SDL_CreateJobSystem(int num_workers);
+
+/**
+ * Get the number of worker threads in a job system.
+ *
+ * \param jobs the job system to query, or NULL for SDL's shared job system.
+ * \returns the number of worker threads, which may be 0 if the job system
+ *          runs jobs on the thread that submits them, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetJobSystemWorkers(SDL_JobSystem *jobs);
+
+/**
+ * Submit a job to a job system.
+ *
+ * The job will be run on one of the job system's worker threads once all of
+ * the jobs it depends on have completed.
+ *
+ * The returned job must be passed to either SDL_WaitJob() or SDL_DetachJob()
+ * once it's no longer needed as a dependency of other jobs.
+ *
+ * \param jobs the job system to use, or NULL for SDL's shared job system.
+ * \param callback the function to run.
+ * \param userdata a pointer that is passed to `callback`.
+ * \param dependencies an array of jobs that have to complete before this
+ *                     one is run, which must have been submitted to the same
+ *                     job system. May be NULL if `num_dependencies` is 0.
+ * \param num_dependencies the number of jobs in `dependencies`.
+ * \returns the new job or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WaitJob
+ * \sa SDL_DetachJob
+ */
+extern SDL_DECLSPEC SDL_Job * SDLCALL SDL_SubmitJob(SDL_JobSystem *jobs, SDL_JobCallback callback, void *userdata, SDL_Job * const *dependencies, int num_dependencies);
+
+/**
+ * Wait for a job to complete and free it.
+ *
+ * While waiting, the calling thread helps run other queued jobs.
+ *
+ * \param job the job to wait for, may be NULL.
+ *
+ * \threadsafety Only one thread may wait for a job, and the job may not be
+ *               used by any thread after this call.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ * \sa SDL_DetachJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WaitJob(SDL_Job *job);
+
+/**
+ * Let a job run without waiting for it.
+ *
+ * The job will be freed automatically once it has completed.
+ *
+ * \param job the job to detach, may be NULL.
+ *
+ * \threadsafety The job may not be used by any thread after this call.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DetachJob(SDL_Job *job);
+
+/**
+ * Run a function over a range of indices in parallel.
+ *
+ * The range is split into chunks of `grain` indices, and `callback` is
+ * called once for each chunk on the job system's worker threads and on the
+ * calling thread. This function returns once all of the chunks have been
+ * processed.
+ *
+ * This is typically used to process the rows of an image or the blocks of
+ * an audio buffer.
+ *
+ * \param jobs the job system to use, or NULL for SDL's shared job system.
+ * \param start the first index in the range.
+ * \param end one past the last index in the range.
+ * \param grain the number of indices in each chunk, or 0 to pick a size
+ *              that divides the range evenly between the worker threads.
+ * \param callback the function to call for each chunk.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ParallelFor(SDL_JobSystem *jobs, int start, int end, int grain, SDL_ParallelForCallback callback, void *userdata);
+
+/**
+ * Destroy a job system.
+ *
+ * This waits for all the jobs that have been submitted to the job system to
+ * complete, and then shuts down the worker threads. Jobs that haven't been
+ * waited for or detached still have to be passed to SDL_WaitJob() or
+ * SDL_DetachJob() afterwards to free them.
+ *
+ * \param jobs the job system to destroy, may be NULL.
+ *
+ * \threadsafety No other thread may be using the job system when it is
+ *               destroyed.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobSystem
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobSystem(SDL_JobSystem *jobs);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
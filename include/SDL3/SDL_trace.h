@@ -0,0 +1,163 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/**
+ * # CategoryTrace
+ *
+ * SDL can record how long it spends in its own internal hot spots, like the
+ * audio device thread, camera frame processing, render command queue
+ * flushes, event pumping, async i/o workers and main callback iterations.
+ *
+ * Each of these is recorded as a named scope with a start time and a
+ * duration on the thread that ran it. Apps can add their own scopes to the
+ * same timeline with SDL_BeginTraceScope() and SDL_EndTraceScope().
+ *
+ * Tracing is off until SDL_StartTracing() is called or SDL_HINT_TRACE_FILE
+ * is set before SDL_Init(). While it is off, each scope costs a single
+ * check of a flag. The recorded trace can be saved in the Chrome trace
+ * event format with SDL_SaveTrace(), and then opened in chrome://tracing,
+ * Perfetto or any other tool that understands that format.
+ *
+ * SDL can be built without tracing support, in which case the functions in
+ * this category do nothing and SDL_StartTracing() reports an error.
+ */
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_iostream.h>
+
+#include <SDL3/SDL_begin_code.h>
+
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start recording trace scopes.
+ *
+ * This discards anything recorded by an earlier trace.
+ *
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SaveTrace
+ * \sa SDL_StopTracing
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_StartTracing(void);
+
+/**
+ * Stop recording trace scopes.
+ *
+ * Scopes that have already been recorded are kept until the next call to
+ * SDL_StartTracing(), so they can still be saved with SDL_SaveTrace().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_StartTracing
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_StopTracing(void);
+
+/**
+ * Begin a named scope on the current thread.
+ *
+ * Every call to this function should be matched by a call to
+ * SDL_EndTraceScope() on the same thread. Scopes may be nested.
+ *
+ * SDL keeps the `name` pointer rather than a copy of the string, so it
+ * should be a string literal or otherwise stay valid until the trace has
+ * been saved.
+ *
+ * This does nothing if tracing isn't active.
+ *
+ * \param name the name of the scope, shown on the timeline.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EndTraceScope
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_BeginTraceScope(const char *name);
+
+/**
+ * End the innermost scope begun on the current thread.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginTraceScope
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_EndTraceScope(void);
+
+/**
+ * Save the recorded trace in the Chrome trace event JSON format.
+ *
+ * This can be called while tracing is active, in which case the scopes
+ * that have ended so far are saved.
+ *
+ * \param dst the data stream to write the trace to.
+ * \param closeio if true, calls SDL_CloseIO() on `dst` before returning, even
+ *                in the case of an error.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SaveTrace
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SaveTrace_IO(SDL_IOStream *dst, bool closeio);
+
+/**
+ * Save the recorded trace to a file in the Chrome trace event JSON format.
+ *
+ * \param file a file to save to.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SaveTrace_IO
+ * \sa SDL_StartTracing
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SaveTrace(const char *file);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_trace_h_ */
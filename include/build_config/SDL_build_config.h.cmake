@@ -179,6 +179,8 @@
 #cmakedefine HAVE_FSEEKO64 1
 #cmakedefine HAVE_MEMFD_CREATE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
+#cmakedefine HAVE_SENDFILE 1
 #cmakedefine HAVE_SIGACTION 1
 #cmakedefine HAVE_SA_SIGACTION 1
 #cmakedefine HAVE_ST_MTIM 1
@@ -253,6 +255,7 @@
 #cmakedefine SDL_POWER_DISABLED 1
 #cmakedefine SDL_SENSOR_DISABLED 1
 #cmakedefine SDL_DIALOG_DISABLED 1
+#cmakedefine SDL_TRACE_DISABLED 1
 #cmakedefine SDL_THREADS_DISABLED 1
 
 /* Enable various audio drivers */
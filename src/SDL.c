@@ -279,6 +279,7 @@ void SDL_InitMainThread(void)
     SDL_InitEnvironment();
     SDL_InitTicks();
     SDL_InitFilesystem();
+    SDL_InitTrace();
 
     if (!done_info) {
         const char *value;
@@ -300,6 +301,7 @@ static void SDL_QuitMainThread(void)
     SDL_QuitFilesystem();
     SDL_QuitTicks();
     SDL_QuitEnvironment();
+    SDL_QuitAtomicWait();
     SDL_QuitTLSData();
 }
 
@@ -665,6 +667,9 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitJobs();
+    SDL_QuitLogThread();
+    SDL_QuitTrace();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
@@ -264,6 +264,7 @@ extern "C" {
 
 #include "SDL_utils_c.h"
 #include "SDL_hashtable.h"
+#include "SDL_trace_c.h"
 
 #define PUSH_SDL_ERROR() \
     { char *_error = SDL_strdup(SDL_GetError());
@@ -274,6 +275,9 @@ extern "C" {
 // Do any initialization that needs to happen before threads are started
 extern void SDL_InitMainThread(void);
 
+// Free the resources used by SDL_WaitAtomicInt() on platforms without native support
+extern void SDL_QuitAtomicWait(void);
+
 /* The internal implementations of these functions have up to nanosecond precision.
    We can expose these functions as part of the API if we want to later.
 */
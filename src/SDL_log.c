@@ -26,6 +26,7 @@
 
 // Simple log messages in SDL
 
+#include "SDL_hints_c.h"
 #include "SDL_log_c.h"
 
 #ifdef HAVE_STDIO_H
@@ -43,6 +44,9 @@
 
 #define DEFAULT_CATEGORY -1
 
+// The number of messages that can be queued for asynchronous logging, must be a power of two
+#define SDL_LOG_QUEUE_SIZE 256
+
 typedef struct SDL_LogLevel
 {
     int category;
@@ -50,6 +54,24 @@ typedef struct SDL_LogLevel
     struct SDL_LogLevel *next;
 } SDL_LogLevel;
 
+/* A queued log message.
+   The sequence number tells producers and the log thread whose turn it is to
+   use the entry, as in Dmitry Vyukov's bounded MPMC queue. */
+typedef struct SDL_LogQueueEntry
+{
+    SDL_AtomicInt sequence;
+    int category;
+    SDL_LogPriority priority;
+    char *long_message;
+    char message[SDL_MAX_LOG_MESSAGE_STACK];
+} SDL_LogQueueEntry;
+
+typedef enum SDL_LogThreadState
+{
+    SDL_LOG_THREAD_RUNNING,
+    SDL_LOG_THREAD_SLEEPING
+} SDL_LogThreadState;
+
 
 // The default log output function
 static void SDLCALL SDL_LogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message);
@@ -66,6 +88,21 @@ static SDL_LogPriority SDL_log_default_priority SDL_GUARDED_BY(SDL_log_lock);
 static SDL_LogOutputFunction SDL_log_function SDL_GUARDED_BY(SDL_log_function_lock) = SDL_LogOutput;
 static void *SDL_log_userdata SDL_GUARDED_BY(SDL_log_function_lock) = NULL;
 
+// Asynchronous logging state
+static SDL_LogQueueEntry *SDL_log_queue;
+static SDL_AtomicInt SDL_log_queue_head;    // the next position producers reserve
+static int SDL_log_queue_tail;              // the next position the log thread writes
+static SDL_AtomicInt SDL_log_queue_written; // the tail, published for waiting threads
+static SDL_AtomicInt SDL_log_async;
+static SDL_AtomicInt SDL_log_async_writers;
+static SDL_AtomicInt SDL_log_block_on_overflow;
+static SDL_AtomicInt SDL_log_dropped;
+static SDL_AtomicInt SDL_log_waiters;
+static SDL_AtomicInt SDL_log_thread_state;
+static SDL_AtomicInt SDL_log_thread_quit;
+static SDL_Thread *SDL_log_thread;
+static SDL_ThreadID SDL_log_thread_id;
+
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
@@ -125,6 +162,172 @@ static void SDLCALL SDL_LoggingChanged(void *userdata, const char *name, const c
     SDL_ResetLogPriorities();
 }
 
+// Queue positions wrap around, so they are compared as unsigned differences
+#define SDL_LOG_POS_DIFF(a, b) ((int)((Uint32)(a) - (Uint32)(b)))
+#define SDL_LOG_POS_ADD(a, b)  ((int)((Uint32)(a) + (Uint32)(b)))
+
+static void SDL_WriteLogMessage(int category, SDL_LogPriority priority, const char *message)
+{
+    SDL_LockMutex(SDL_log_function_lock);
+    {
+        if (SDL_log_function) {
+            SDL_log_function(SDL_log_userdata, category, priority, message);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_function_lock);
+}
+
+static void SDL_WakeLogThread(void)
+{
+    if (SDL_CompareAndSwapAtomicInt(&SDL_log_thread_state, SDL_LOG_THREAD_SLEEPING, SDL_LOG_THREAD_RUNNING)) {
+        SDL_WakeAtomicInt(&SDL_log_thread_state, false);
+    }
+}
+
+// Wait for the log thread to write more messages, or for a short timeout
+static void SDL_WaitForLogThread(int written)
+{
+    SDL_AddAtomicInt(&SDL_log_waiters, 1);
+    SDL_WakeLogThread();
+    SDL_WaitAtomicInt(&SDL_log_queue_written, written, 10 * SDL_NS_PER_MS);
+    SDL_AddAtomicInt(&SDL_log_waiters, -1);
+}
+
+static void SDL_ReportDroppedLogMessages(void)
+{
+    const int dropped = SDL_GetAtomicInt(&SDL_log_dropped);
+    if (dropped) {
+        char message[64];
+        SDL_AddAtomicInt(&SDL_log_dropped, -dropped);
+        (void)SDL_snprintf(message, sizeof(message), "%d log messages were dropped", dropped);
+        SDL_WriteLogMessage(SDL_LOG_CATEGORY_SYSTEM, SDL_LOG_PRIORITY_WARN, message);
+    }
+}
+
+static int SDLCALL SDL_LogThread(void *data)
+{
+    (void)data;
+
+    for (;;) {
+        SDL_LogQueueEntry *entry = &SDL_log_queue[SDL_log_queue_tail & (SDL_LOG_QUEUE_SIZE - 1)];
+        const int next = SDL_LOG_POS_ADD(SDL_log_queue_tail, 1);
+
+        if (SDL_GetAtomicInt(&entry->sequence) == next) {
+            SDL_WriteLogMessage(entry->category, entry->priority, entry->long_message ? entry->long_message : entry->message);
+            if (entry->long_message) {
+                SDL_free(entry->long_message);
+                entry->long_message = NULL;
+            }
+
+            // Hand the entry back to the producers
+            SDL_SetAtomicInt(&entry->sequence, SDL_LOG_POS_ADD(SDL_log_queue_tail, SDL_LOG_QUEUE_SIZE));
+            SDL_log_queue_tail = next;
+
+            // Messages are only dropped when the queue is full, report them once it drains
+            entry = &SDL_log_queue[next & (SDL_LOG_QUEUE_SIZE - 1)];
+            if (SDL_GetAtomicInt(&entry->sequence) != SDL_LOG_POS_ADD(next, 1)) {
+                SDL_ReportDroppedLogMessages();
+            }
+
+            SDL_SetAtomicInt(&SDL_log_queue_written, next);
+            if (SDL_GetAtomicInt(&SDL_log_waiters)) {
+                SDL_WakeAtomicInt(&SDL_log_queue_written, true);
+            }
+            continue;
+        }
+
+        if (SDL_GetAtomicInt(&SDL_log_thread_quit) &&
+            SDL_log_queue_tail == SDL_GetAtomicInt(&SDL_log_queue_head)) {
+            break;
+        }
+
+        // Sleep until a message is queued
+        SDL_SetAtomicInt(&SDL_log_thread_state, SDL_LOG_THREAD_SLEEPING);
+        if (SDL_GetAtomicInt(&entry->sequence) != next && !SDL_GetAtomicInt(&SDL_log_thread_quit)) {
+            SDL_WaitAtomicInt(&SDL_log_thread_state, SDL_LOG_THREAD_SLEEPING, -1);
+        }
+        SDL_SetAtomicInt(&SDL_log_thread_state, SDL_LOG_THREAD_RUNNING);
+    }
+    return 0;
+}
+
+static void SDL_StartAsyncLog(void)
+{
+    if (!SDL_log_queue) {
+        int i;
+
+        SDL_log_queue = (SDL_LogQueueEntry *)SDL_calloc(SDL_LOG_QUEUE_SIZE, sizeof(*SDL_log_queue));
+        if (!SDL_log_queue) {
+            return;
+        }
+        for (i = 0; i < SDL_LOG_QUEUE_SIZE; ++i) {
+            SDL_SetAtomicInt(&SDL_log_queue[i].sequence, i);
+        }
+        SDL_SetAtomicInt(&SDL_log_queue_head, 0);
+        SDL_SetAtomicInt(&SDL_log_queue_written, 0);
+        SDL_log_queue_tail = 0;
+    }
+
+    if (!SDL_log_thread) {
+        SDL_SetAtomicInt(&SDL_log_thread_quit, 0);
+        SDL_SetAtomicInt(&SDL_log_thread_state, SDL_LOG_THREAD_RUNNING);
+        SDL_log_thread = SDL_CreateThread(SDL_LogThread, "SDLLog", NULL);
+        if (!SDL_log_thread) {
+            return;
+        }
+        SDL_log_thread_id = SDL_GetThreadID(SDL_log_thread);
+    }
+
+    SDL_SetAtomicInt(&SDL_log_async, 1);
+}
+
+// Stop queueing messages and wait for the queued ones to be written
+static void SDL_StopAsyncLog(void)
+{
+    SDL_SetAtomicInt(&SDL_log_async, 0);
+    if (!SDL_log_thread) {
+        return;
+    }
+
+    // Let producers that already started queueing finish
+    while (SDL_GetAtomicInt(&SDL_log_async_writers) > 0) {
+        SDL_DelayNS(10 * SDL_NS_PER_US);
+    }
+    SDL_FlushLogMessages();
+}
+
+// Write the queued messages and stop the log thread, SDL_Quit() does this before checking for leaked objects
+void SDL_QuitLogThread(void)
+{
+    SDL_StopAsyncLog();
+
+    if (SDL_log_thread) {
+        SDL_SetAtomicInt(&SDL_log_thread_quit, 1);
+        SDL_WakeLogThread();
+        SDL_WaitThread(SDL_log_thread, NULL);
+        SDL_log_thread = NULL;
+        SDL_log_thread_id = 0;
+    }
+    if (SDL_log_queue) {
+        SDL_free(SDL_log_queue);
+        SDL_log_queue = NULL;
+    }
+}
+
+static void SDLCALL SDL_LogAsyncChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    if (SDL_GetStringBoolean(hint, false)) {
+        SDL_StartAsyncLog();
+    } else {
+        SDL_StopAsyncLog();
+    }
+}
+
+static void SDLCALL SDL_LogAsyncOverflowChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_SetAtomicInt(&SDL_log_block_on_overflow, (hint && SDL_strcasecmp(hint, "block") == 0) ? 1 : 0);
+}
+
 void SDL_InitLog(void)
 {
     if (!SDL_ShouldInit(&SDL_log_init)) {
@@ -136,6 +339,8 @@ void SDL_InitLog(void)
     SDL_log_function_lock = SDL_CreateMutex();
 
     SDL_AddHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_LOG_ASYNC_OVERFLOW, SDL_LogAsyncOverflowChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_LOG_ASYNC, SDL_LogAsyncChanged, NULL);
 
     SDL_SetInitialized(&SDL_log_init, true);
 }
@@ -147,6 +352,10 @@ void SDL_QuitLog(void)
     }
 
     SDL_RemoveHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
+    SDL_RemoveHintCallback(SDL_HINT_LOG_ASYNC_OVERFLOW, SDL_LogAsyncOverflowChanged, NULL);
+    SDL_RemoveHintCallback(SDL_HINT_LOG_ASYNC, SDL_LogAsyncChanged, NULL);
+
+    SDL_QuitLogThread();
 
     CleanupLogPriorities();
     CleanupLogPrefixes();
@@ -569,6 +778,91 @@ static const char *GetCategoryPrefix(int category)
 }
 #endif // SDL_PLATFORM_ANDROID
 
+// Chop off final endline.
+static void SDL_ChopLogMessage(char *message, int len)
+{
+    if ((len > 0) && (message[len - 1] == '\n')) {
+        message[--len] = '\0';
+        if ((len > 0) && (message[len - 1] == '\r')) { // catch "\r\n", too.
+            message[--len] = '\0';
+        }
+    }
+}
+
+// Format a message into the asynchronous queue, returns false if the message should be written directly
+static bool SDL_QueueLogMessage(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
+{
+    SDL_LogQueueEntry *entry = NULL;
+    int pos;
+
+    SDL_AddAtomicInt(&SDL_log_async_writers, 1);
+    if (!SDL_GetAtomicInt(&SDL_log_async) || SDL_GetCurrentThreadID() == SDL_log_thread_id) {
+        SDL_AddAtomicInt(&SDL_log_async_writers, -1);
+        return false;
+    }
+
+    // Reserve an entry
+    pos = SDL_GetAtomicInt(&SDL_log_queue_head);
+    for (;;) {
+        SDL_LogQueueEntry *slot = &SDL_log_queue[pos & (SDL_LOG_QUEUE_SIZE - 1)];
+        const int diff = SDL_LOG_POS_DIFF(SDL_GetAtomicInt(&slot->sequence), pos);
+
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicInt(&SDL_log_queue_head, pos, SDL_LOG_POS_ADD(pos, 1))) {
+                entry = slot;
+                break;
+            }
+        } else if (diff < 0) {
+            // The queue is full
+            if (!SDL_GetAtomicInt(&SDL_log_block_on_overflow)) {
+                SDL_AddAtomicInt(&SDL_log_dropped, 1);
+                break;
+            }
+            SDL_WaitForLogThread(SDL_GetAtomicInt(&SDL_log_queue_written));
+        }
+        pos = SDL_GetAtomicInt(&SDL_log_queue_head);
+    }
+
+    if (entry) {
+        va_list aq;
+        int len;
+
+        entry->category = category;
+        entry->priority = priority;
+
+        va_copy(aq, ap);
+        len = SDL_vsnprintf(entry->message, sizeof(entry->message), fmt, aq);
+        va_end(aq);
+
+        if (len < 0) {
+            entry->message[0] = '\0';
+        } else if (len >= sizeof(entry->message)) {
+            // If message truncated, allocate and re-render, or keep the truncated message
+            size_t len_plus_term;
+            if (SDL_size_add_check_overflow(len, 1, &len_plus_term)) {
+                entry->long_message = (char *)SDL_malloc(len_plus_term);
+            }
+            if (entry->long_message) {
+                va_copy(aq, ap);
+                len = SDL_vsnprintf(entry->long_message, len_plus_term, fmt, aq);
+                va_end(aq);
+                SDL_ChopLogMessage(entry->long_message, len);
+            } else {
+                SDL_ChopLogMessage(entry->message, sizeof(entry->message) - 1);
+            }
+        } else {
+            SDL_ChopLogMessage(entry->message, len);
+        }
+
+        // Publish the entry
+        SDL_SetAtomicInt(&entry->sequence, SDL_LOG_POS_ADD(pos, 1));
+        SDL_WakeLogThread();
+    }
+
+    SDL_AddAtomicInt(&SDL_log_async_writers, -1);
+    return true;
+}
+
 void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_STRING const char *fmt, va_list ap)
 {
     char *message = NULL;
@@ -606,6 +900,10 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
     return;
 #endif
 
+    if (SDL_QueueLogMessage(category, priority, fmt, ap)) {
+        return;
+    }
+
     // Render into stack buffer
     va_copy(aq, ap);
     len = SDL_vsnprintf(stack_buf, sizeof(stack_buf), fmt, aq);
@@ -629,19 +927,9 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         message = stack_buf;
     }
 
-    // Chop off final endline.
-    if ((len > 0) && (message[len - 1] == '\n')) {
-        message[--len] = '\0';
-        if ((len > 0) && (message[len - 1] == '\r')) { // catch "\r\n", too.
-            message[--len] = '\0';
-        }
-    }
+    SDL_ChopLogMessage(message, len);
 
-    SDL_LockMutex(SDL_log_function_lock);
-    {
-        SDL_log_function(SDL_log_userdata, category, priority, message);
-    }
-    SDL_UnlockMutex(SDL_log_function_lock);
+    SDL_WriteLogMessage(category, priority, message);
 
     // Free only if dynamically allocated
     if (message != stack_buf) {
@@ -820,6 +1108,9 @@ void SDL_GetLogOutputFunction(SDL_LogOutputFunction *callback, void **userdata)
 
 void SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata)
 {
+    // Queued messages go to the function that was set when they were logged
+    SDL_FlushLogMessages();
+
     SDL_LockMutex(SDL_log_function_lock);
     {
         SDL_log_function = callback;
@@ -827,3 +1118,21 @@ void SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata)
     }
     SDL_UnlockMutex(SDL_log_function_lock);
 }
+
+void SDL_FlushLogMessages(void)
+{
+    int head;
+
+    if (!SDL_log_thread || SDL_GetCurrentThreadID() == SDL_log_thread_id) {
+        return;
+    }
+
+    head = SDL_GetAtomicInt(&SDL_log_queue_head);
+    for (;;) {
+        const int written = SDL_GetAtomicInt(&SDL_log_queue_written);
+        if (SDL_LOG_POS_DIFF(head, written) <= 0) {
+            break;
+        }
+        SDL_WaitForLogThread(written);
+    }
+}
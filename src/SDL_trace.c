@@ -0,0 +1,444 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Trace scopes recorded into per-thread buffers and saved as Chrome trace JSON
+
+#ifndef SDL_TRACE_DISABLED
+
+// The most scopes that are recorded while nested on a single thread
+#define SDL_TRACE_MAX_DEPTH 64
+
+// Events are stored in chunks that never move, so they can be saved while more are added
+#define SDL_TRACE_CHUNK_EVENTS 4096
+
+// The most events kept for each thread, 24 MB on 64-bit platforms
+#define SDL_TRACE_MAX_EVENTS (SDL_TRACE_CHUNK_EVENTS * 256)
+
+typedef struct SDL_TraceEvent
+{
+    const char *name;
+    Uint64 start;
+    Uint64 duration;
+} SDL_TraceEvent;
+
+typedef struct SDL_TraceChunk
+{
+    struct SDL_TraceChunk *next;
+    SDL_TraceEvent events[SDL_TRACE_CHUNK_EVENTS];
+} SDL_TraceChunk;
+
+/* Everything but the atomics is only touched by the thread that owns the
+   buffer. Saving the trace reads the events below num_events, which are
+   never changed again until tracing is restarted. */
+typedef struct SDL_TraceBuffer
+{
+    SDL_AtomicInt generation;
+    SDL_AtomicInt num_events;
+    SDL_AtomicInt dropped;
+    SDL_TraceChunk *chunks;
+    SDL_TraceChunk *current;
+    int depth;
+    const char *open_names[SDL_TRACE_MAX_DEPTH];
+    Uint64 open_starts[SDL_TRACE_MAX_DEPTH];
+    int tid;
+    char name[64];
+    struct SDL_TraceBuffer *next;
+} SDL_TraceBuffer;
+
+bool SDL_trace_active;
+static bool SDL_trace_from_hint;
+static SDL_InitState SDL_trace_init;
+static SDL_Mutex *SDL_trace_lock;  // held while saving, so tracing can't restart and reuse the events being written
+static SDL_AtomicInt SDL_trace_generation;
+static SDL_AtomicInt SDL_trace_num_threads;
+static void *SDL_trace_buffers;  // SDL_TraceBuffer *, accessed atomically
+static SDL_TLSID SDL_trace_buffer;
+static SDL_TLSID SDL_trace_thread_name;
+
+void SDL_SetTraceThreadName(const char *name)
+{
+    // The name is owned by the SDL_Thread, which outlives anything the thread records
+    SDL_SetTLS(&SDL_trace_thread_name, name, NULL);
+}
+
+static void SDL_CheckInitTrace(void)
+{
+    int status = SDL_GetAtomicInt(&SDL_trace_init.status);
+    if (status == SDL_INIT_STATUS_INITIALIZED ||
+        (status == SDL_INIT_STATUS_INITIALIZING && SDL_trace_init.thread == SDL_GetCurrentThreadID())) {
+        return;
+    }
+
+    if (SDL_ShouldInit(&SDL_trace_init)) {
+        // If this fails we'll continue without it.
+        SDL_trace_lock = SDL_CreateMutex();
+        SDL_SetInitialized(&SDL_trace_init, true);
+    }
+}
+
+static SDL_TraceBuffer *SDL_GetTraceBuffer(bool create)
+{
+    SDL_TraceBuffer *buffer = (SDL_TraceBuffer *)SDL_GetTLS(&SDL_trace_buffer);
+    const int generation = SDL_GetAtomicInt(&SDL_trace_generation);
+
+    if (!buffer) {
+        const char *name;
+
+        if (!create) {
+            return NULL;
+        }
+
+        buffer = (SDL_TraceBuffer *)SDL_calloc(1, sizeof(*buffer));
+        if (!buffer) {
+            return NULL;
+        }
+        buffer->tid = SDL_AtomicIncRef(&SDL_trace_num_threads) + 1;
+        name = (const char *)SDL_GetTLS(&SDL_trace_thread_name);
+        if (name) {
+            SDL_strlcpy(buffer->name, name, sizeof(buffer->name));
+        } else if (SDL_IsMainThread()) {
+            SDL_strlcpy(buffer->name, "main", sizeof(buffer->name));
+        } else {
+            SDL_snprintf(buffer->name, sizeof(buffer->name), "thread %" SDL_PRIu64, SDL_GetCurrentThreadID());
+        }
+        SDL_SetAtomicInt(&buffer->generation, generation);
+
+        // Buffers stay in the list until SDL_QuitTrace(), so they can be saved after their thread is gone
+        if (!SDL_SetTLS(&SDL_trace_buffer, buffer, NULL)) {
+            SDL_free(buffer);
+            return NULL;
+        }
+        do {
+            buffer->next = (SDL_TraceBuffer *)SDL_GetAtomicPointer(&SDL_trace_buffers);
+        } while (!SDL_CompareAndSwapAtomicPointer(&SDL_trace_buffers, buffer->next, buffer));
+
+    } else if (SDL_GetAtomicInt(&buffer->generation) != generation) {
+        // Tracing was restarted, throw away the old events
+        buffer->depth = 0;
+        SDL_SetAtomicInt(&buffer->num_events, 0);
+        SDL_SetAtomicInt(&buffer->dropped, 0);
+        SDL_SetAtomicInt(&buffer->generation, generation);
+    }
+    return buffer;
+}
+
+static void SDL_AddTraceEvent(SDL_TraceBuffer *buffer, const char *name, Uint64 start, Uint64 end)
+{
+    const int count = SDL_GetAtomicInt(&buffer->num_events);
+    const int index = count % SDL_TRACE_CHUNK_EVENTS;
+    SDL_TraceEvent *event;
+
+    if (count >= SDL_TRACE_MAX_EVENTS) {
+        SDL_AddAtomicInt(&buffer->dropped, 1);
+        return;
+    }
+
+    if (index == 0) {
+        // Move on to the next chunk, reusing the ones from an earlier trace
+        SDL_TraceChunk *chunk = count ? buffer->current->next : buffer->chunks;
+        if (!chunk) {
+            chunk = (SDL_TraceChunk *)SDL_malloc(sizeof(*chunk));
+            if (!chunk) {
+                SDL_AddAtomicInt(&buffer->dropped, 1);
+                return;
+            }
+            chunk->next = NULL;
+            if (count) {
+                buffer->current->next = chunk;
+            } else {
+                buffer->chunks = chunk;
+            }
+        }
+        buffer->current = chunk;
+    }
+
+    event = &buffer->current->events[index];
+    event->name = name;
+    event->start = start;
+    event->duration = end - start;
+
+    // Publish the event to SDL_SaveTrace_IO()
+    SDL_SetAtomicInt(&buffer->num_events, count + 1);
+}
+
+bool SDL_StartTracing(void)
+{
+    SDL_CheckInitTrace();
+
+    SDL_LockMutex(SDL_trace_lock);
+    SDL_AddAtomicInt(&SDL_trace_generation, 1);
+    SDL_trace_active = true;
+    SDL_UnlockMutex(SDL_trace_lock);
+    return true;
+}
+
+void SDL_StopTracing(void)
+{
+    SDL_CheckInitTrace();
+
+    SDL_LockMutex(SDL_trace_lock);
+    SDL_trace_active = false;
+    SDL_UnlockMutex(SDL_trace_lock);
+}
+
+void SDL_BeginTraceScope(const char *name)
+{
+    SDL_TraceBuffer *buffer;
+
+    if (!SDL_trace_active) {
+        return;
+    }
+
+    buffer = SDL_GetTraceBuffer(true);
+    if (!buffer) {
+        return;
+    }
+    if (buffer->depth < SDL_TRACE_MAX_DEPTH) {
+        buffer->open_names[buffer->depth] = name ? name : "(null)";
+        buffer->open_starts[buffer->depth] = SDL_GetTicksNS();
+    }
+    ++buffer->depth;
+}
+
+void SDL_EndTraceScope(void)
+{
+    SDL_TraceBuffer *buffer;
+    Uint64 end;
+
+    if (!SDL_trace_active) {
+        return;
+    }
+
+    end = SDL_GetTicksNS();
+    buffer = SDL_GetTraceBuffer(false);
+    if (!buffer || buffer->depth == 0) {
+        // This scope began before tracing started
+        return;
+    }
+    --buffer->depth;
+    if (buffer->depth < SDL_TRACE_MAX_DEPTH) {
+        SDL_AddTraceEvent(buffer, buffer->open_names[buffer->depth], buffer->open_starts[buffer->depth], end);
+    }
+}
+
+static bool SDL_WriteTraceString(SDL_IOStream *dst, const char *string)
+{
+    char buf[128];
+    size_t len = 0;
+
+    buf[len++] = '"';
+    for (; *string; ++string) {
+        const unsigned char ch = (unsigned char)*string;
+
+        if (len > sizeof(buf) - 8) {
+            if (SDL_WriteIO(dst, buf, len) != len) {
+                return false;
+            }
+            len = 0;
+        }
+        if (ch == '"' || ch == '\\') {
+            buf[len++] = '\\';
+            buf[len++] = (char)ch;
+        } else if (ch < 0x20) {
+            len += SDL_snprintf(&buf[len], sizeof(buf) - len, "\\u%04x", ch);
+        } else {
+            buf[len++] = (char)ch;
+        }
+    }
+    buf[len++] = '"';
+    return SDL_WriteIO(dst, buf, len) == len;
+}
+
+bool SDL_SaveTrace_IO(SDL_IOStream *dst, bool closeio)
+{
+    SDL_TraceBuffer *buffer;
+    bool result = true;
+    bool first = true;
+    int generation;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+
+    // Keep tracing from being restarted, which would reuse the events we're reading
+    SDL_CheckInitTrace();
+    SDL_LockMutex(SDL_trace_lock);
+    generation = SDL_GetAtomicInt(&SDL_trace_generation);
+
+    result = SDL_IOprintf(dst, "{\"traceEvents\":[") > 0;
+    for (buffer = (SDL_TraceBuffer *)SDL_GetAtomicPointer(&SDL_trace_buffers); buffer && result; buffer = buffer->next) {
+        SDL_TraceChunk *chunk = buffer->chunks;
+        int num_events, dropped, i;
+
+        if (SDL_GetAtomicInt(&buffer->generation) != generation) {
+            continue;  // Nothing recorded on this thread since tracing started
+        }
+        num_events = SDL_GetAtomicInt(&buffer->num_events);
+        dropped = SDL_GetAtomicInt(&buffer->dropped);
+        if (dropped > 0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Trace buffer for %s was full, %d scopes were dropped", buffer->name, dropped);
+        }
+
+        result = SDL_IOprintf(dst, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",", buffer->tid) > 0 &&
+                 SDL_WriteTraceString(dst, buffer->name) &&
+                 SDL_IOprintf(dst, "}}") > 0;
+        first = false;
+
+        for (i = 0; i < num_events && result; ++i) {
+            const SDL_TraceEvent *event;
+
+            if (i > 0 && (i % SDL_TRACE_CHUNK_EVENTS) == 0) {
+                chunk = chunk->next;
+            }
+            event = &chunk->events[i % SDL_TRACE_CHUNK_EVENTS];
+
+            // Chrome trace timestamps are in microseconds
+            result = SDL_IOprintf(dst, ",\n{\"name\":") > 0 &&
+                     SDL_WriteTraceString(dst, event->name) &&
+                     SDL_IOprintf(dst, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%" SDL_PRIu64 ".%03d,\"dur\":%" SDL_PRIu64 ".%03d}",
+                                  buffer->tid,
+                                  event->start / SDL_NS_PER_US, (int)(event->start % SDL_NS_PER_US),
+                                  event->duration / SDL_NS_PER_US, (int)(event->duration % SDL_NS_PER_US)) > 0;
+        }
+    }
+    if (result) {
+        result = SDL_IOprintf(dst, "\n],\"displayTimeUnit\":\"ms\"}\n") > 0;
+    }
+
+    SDL_UnlockMutex(SDL_trace_lock);
+
+    if (closeio) {
+        result &= SDL_CloseIO(dst);
+    }
+    return result;
+}
+
+bool SDL_SaveTrace(const char *file)
+{
+    SDL_IOStream *dst = SDL_IOFromFile(file, "wb");
+    if (!dst) {
+        return false;
+    }
+    return SDL_SaveTrace_IO(dst, true);
+}
+
+void SDL_InitTrace(void)
+{
+    const char *file = SDL_GetHint(SDL_HINT_TRACE_FILE);
+
+    if (file && *file && !SDL_trace_from_hint) {
+        SDL_trace_from_hint = true;
+        SDL_StartTracing();
+    }
+}
+
+void SDL_QuitTrace(void)
+{
+    SDL_TraceBuffer *buffer;
+
+    if (SDL_trace_from_hint) {
+        const char *file = SDL_GetHint(SDL_HINT_TRACE_FILE);
+
+        SDL_StopTracing();
+        if (file && *file && !SDL_SaveTrace(file)) {
+            SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Couldn't save trace to %s: %s", file, SDL_GetError());
+        }
+        SDL_trace_from_hint = false;
+    }
+
+    // Threads that recorded anything have finished by now, so free their buffers
+    if (SDL_trace_active) {
+        return;  // ... unless the app is still tracing
+    }
+    buffer = (SDL_TraceBuffer *)SDL_SetAtomicPointer(&SDL_trace_buffers, NULL);
+    while (buffer) {
+        SDL_TraceBuffer *next = buffer->next;
+        SDL_TraceChunk *chunk = buffer->chunks;
+
+        while (chunk) {
+            SDL_TraceChunk *next_chunk = chunk->next;
+            SDL_free(chunk);
+            chunk = next_chunk;
+        }
+        SDL_free(buffer);
+        buffer = next;
+    }
+
+    // Make every thread allocate a new buffer if tracing starts again
+    SDL_SetTLS(&SDL_trace_buffer, NULL, NULL);
+    SDL_SetAtomicInt(&SDL_trace_buffer, 0);
+    SDL_SetAtomicInt(&SDL_trace_num_threads, 0);
+
+    if (SDL_ShouldQuit(&SDL_trace_init)) {
+        if (SDL_trace_lock) {
+            SDL_DestroyMutex(SDL_trace_lock);
+            SDL_trace_lock = NULL;
+        }
+        SDL_SetInitialized(&SDL_trace_init, false);
+    }
+}
+
+#else // SDL_TRACE_DISABLED
+
+void SDL_SetTraceThreadName(const char *name)
+{
+}
+
+bool SDL_StartTracing(void)
+{
+    return SDL_Unsupported();
+}
+
+void SDL_StopTracing(void)
+{
+}
+
+void SDL_BeginTraceScope(const char *name)
+{
+}
+
+void SDL_EndTraceScope(void)
+{
+}
+
+bool SDL_SaveTrace_IO(SDL_IOStream *dst, bool closeio)
+{
+    if (dst && closeio) {
+        SDL_CloseIO(dst);
+    }
+    return SDL_Unsupported();
+}
+
+bool SDL_SaveTrace(const char *file)
+{
+    return SDL_Unsupported();
+}
+
+void SDL_InitTrace(void)
+{
+}
+
+void SDL_QuitTrace(void)
+{
+}
+
+#endif // !SDL_TRACE_DISABLED
@@ -0,0 +1,56 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+// This is included in SDL_internal.h
+//#include "SDL_internal.h"
+
+// This file defines the trace scopes used to instrument SDL internals
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+#ifdef SDL_TRACE_DISABLED
+#define SDL_TRACE_BEGIN(name)
+#define SDL_TRACE_END()
+#else
+// This is only written by SDL_StartTracing() and SDL_StopTracing(), and a
+// stale read just means a scope near the start or end of a trace is missed.
+extern bool SDL_trace_active;
+
+// These only cost a flag check while tracing is off
+#define SDL_TRACE_BEGIN(name)                      \
+    do {                                           \
+        if (SDL_trace_active) {                    \
+            SDL_BeginTraceScope(name);             \
+        }                                          \
+    } while (0)
+#define SDL_TRACE_END()                            \
+    do {                                           \
+        if (SDL_trace_active) {                    \
+            SDL_EndTraceScope();                   \
+        }                                          \
+    } while (0)
+#endif
+
+extern void SDL_InitTrace(void);
+extern void SDL_QuitTrace(void);
+extern void SDL_SetTraceThreadName(const char *name);
+
+#endif // SDL_trace_c_h_
@@ -33,6 +33,15 @@
 #include <atomic.h>
 #endif
 
+#ifdef SDL_PLATFORM_LINUX
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#define HAVE_LINUX_FUTEX 1
+#endif
+
 // The __atomic_load_n() intrinsic showed up in different times for different compilers.
 #ifdef __clang__
 #if __has_builtin(__atomic_load_n) || defined(HAVE_GCC_ATOMICS)
@@ -367,6 +376,143 @@ void *SDL_GetAtomicPointer(void **a)
 #endif
 }
 
+#ifdef HAVE_LINUX_FUTEX
+
+bool SDL_WaitAtomicInt(SDL_AtomicInt *a, int value, Sint64 timeoutNS)
+{
+    struct timespec timeout;
+
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+
+    if (timeoutNS >= 0) {
+        timeout.tv_sec = (time_t)(timeoutNS / SDL_NS_PER_SECOND);
+        timeout.tv_nsec = (long)(timeoutNS % SDL_NS_PER_SECOND);
+    }
+    if (syscall(SYS_futex, &a->value, FUTEX_WAIT_PRIVATE, value, (timeoutNS >= 0) ? &timeout : NULL, NULL, 0) < 0 &&
+        errno == ETIMEDOUT) {
+        return false;
+    }
+    return true;
+}
+
+void SDL_WakeAtomicInt(SDL_AtomicInt *a, bool wake_all)
+{
+    if (a) {
+        syscall(SYS_futex, &a->value, FUTEX_WAKE_PRIVATE, wake_all ? SDL_MAX_SINT32 : 1, NULL, NULL, 0);
+    }
+}
+
+void SDL_QuitAtomicWait(void)
+{
+}
+
+#else
+
+/* Waiters sleep on one of a fixed set of condition variables, picked by address.
+   Variables sharing a bucket wake each other spuriously, which callers have to handle anyway. */
+#define SDL_ATOMIC_WAIT_BUCKETS 64  // must match the hash below
+
+typedef struct SDL_AtomicWaitBucket
+{
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+} SDL_AtomicWaitBucket;
+
+static SDL_InitState SDL_atomic_wait_init;
+static SDL_AtomicWaitBucket SDL_atomic_wait_buckets[SDL_ATOMIC_WAIT_BUCKETS];
+
+static SDL_AtomicWaitBucket *SDL_GetAtomicWaitBucket(SDL_AtomicInt *a)
+{
+    SDL_AtomicWaitBucket *bucket;
+
+    if (SDL_ShouldInit(&SDL_atomic_wait_init)) {
+        int i;
+        for (i = 0; i < SDL_arraysize(SDL_atomic_wait_buckets); ++i) {
+            SDL_atomic_wait_buckets[i].lock = SDL_CreateMutex();
+            SDL_atomic_wait_buckets[i].cond = SDL_CreateCondition();
+        }
+        SDL_SetInitialized(&SDL_atomic_wait_init, true);
+    }
+
+    // Fibonacci hashing, the top 6 bits pick one of the 64 buckets
+    bucket = &SDL_atomic_wait_buckets[((Uint32)((uintptr_t)a >> 2) * 0x9E3779B1u) >> 26];
+    if (!bucket->lock || !bucket->cond) {
+        return NULL;
+    }
+    return bucket;
+}
+
+bool SDL_WaitAtomicInt(SDL_AtomicInt *a, int value, Sint64 timeoutNS)
+{
+    SDL_AtomicWaitBucket *bucket;
+    bool result = true;
+
+    if (!a) {
+        return SDL_InvalidParamError("a");
+    }
+
+    if (SDL_GetAtomicInt(a) != value) {
+        return true;
+    }
+    if (timeoutNS == 0) {
+        return false;
+    }
+
+    bucket = SDL_GetAtomicWaitBucket(a);
+    if (!bucket) {
+        // No threads to wake us up, just wait a little and let the caller check again
+        SDL_DelayNS((timeoutNS > 0) ? SDL_min(timeoutNS, SDL_MS_TO_NS(1)) : SDL_MS_TO_NS(1));
+        return (timeoutNS < 0 || timeoutNS > SDL_MS_TO_NS(1));
+    }
+
+    SDL_LockMutex(bucket->lock);
+    if (SDL_GetAtomicInt(a) == value) {
+        result = SDL_WaitConditionTimeoutNS(bucket->cond, bucket->lock, timeoutNS);
+    }
+    SDL_UnlockMutex(bucket->lock);
+
+    return result;
+}
+
+void SDL_WakeAtomicInt(SDL_AtomicInt *a, bool wake_all)
+{
+    SDL_AtomicWaitBucket *bucket;
+
+    if (!a) {
+        return;
+    }
+
+    bucket = SDL_GetAtomicWaitBucket(a);
+    if (bucket) {
+        // The bucket may be shared with other variables, so everybody has to check
+        SDL_LockMutex(bucket->lock);
+        SDL_BroadcastCondition(bucket->cond);
+        SDL_UnlockMutex(bucket->lock);
+    }
+}
+
+void SDL_QuitAtomicWait(void)
+{
+    int i;
+
+    if (!SDL_ShouldQuit(&SDL_atomic_wait_init)) {
+        return;
+    }
+
+    for (i = 0; i < SDL_arraysize(SDL_atomic_wait_buckets); ++i) {
+        SDL_DestroyCondition(SDL_atomic_wait_buckets[i].cond);
+        SDL_DestroyMutex(SDL_atomic_wait_buckets[i].lock);
+        SDL_atomic_wait_buckets[i].cond = NULL;
+        SDL_atomic_wait_buckets[i].lock = NULL;
+    }
+
+    SDL_SetInitialized(&SDL_atomic_wait_init, false);
+}
+
+#endif // HAVE_LINUX_FUTEX
+
 #ifdef SDL_MEMORY_BARRIER_USES_FUNCTION
 #error This file should be built in arm mode so the mcr instruction is available for memory barriers
 #endif
@@ -56,6 +56,40 @@ extern __inline int _SDL_xchg_watcom(volatile int *a, int v);
 #endif // __WATCOMC__ && __386__
 /* *INDENT-ON* */ // clang-format on
 
+/* Contended locks spin with exponential backoff for up to twice as many pause
+   instructions as recently contended locks took to acquire, yield the CPU a few
+   times, and then sleep until the lock is released. Threads sleeping on a lock
+   are counted in a small table hashed by lock address, so unlocking only has to
+   wake anybody when needed. Each bucket remembers which lock a wakeup is in flight
+   for, so a busy lock doesn't make a system call on every unlock, but other locks
+   that share the bucket still wake their own sleepers. */
+#define SDL_SPINLOCK_MIN_SPINS     64
+#define SDL_SPINLOCK_MAX_SPINS     4096
+#define SDL_SPINLOCK_MAX_PAUSE     64
+#define SDL_SPINLOCK_YIELDS        16
+#define SDL_SPINLOCK_PARK_BUCKETS  64  // must match the hash below
+
+/* The unlocking thread can check for sleepers before it sees them arrive,
+   so sleepers check the lock again after this long in case they missed the wakeup */
+#define SDL_SPINLOCK_PARK_TIMEOUT  SDL_MS_TO_NS(1)
+
+static SDL_AtomicInt SDL_spinlock_spins = { SDL_SPINLOCK_MIN_SPINS };
+#ifndef SDL_THREADS_DISABLED
+typedef struct SDL_SpinlockParking
+{
+    SDL_AtomicInt parked;
+    void *waking;  // the lock with a wakeup in flight, if any
+} SDL_SpinlockParking;
+
+static SDL_SpinlockParking SDL_spinlock_parking[SDL_SPINLOCK_PARK_BUCKETS];
+
+static SDL_SpinlockParking *SDL_GetSpinlockParking(SDL_SpinLock *lock)
+{
+    // Fibonacci hashing, the top 6 bits pick one of the 64 buckets
+    return &SDL_spinlock_parking[((Uint32)((uintptr_t)lock >> 2) * 0x9E3779B1u) >> 26];
+}
+#endif
+
 // This function is where all the magic happens...
 bool SDL_TryLockSpinlock(SDL_SpinLock *lock)
 {
@@ -163,17 +197,61 @@ bool SDL_TryLockSpinlock(SDL_SpinLock *lock)
 
 void SDL_LockSpinlock(SDL_SpinLock *lock)
 {
-    int iterations = 0;
-    // FIXME: Should we have an eventual timeout?
-    while (!SDL_TryLockSpinlock(lock)) {
-        if (iterations < 32) {
-            iterations++;
+    int spins, max_spins, pause, i;
+
+    if (SDL_TryLockSpinlock(lock)) {
+        return;
+    }
+
+    // Spinning can't help if the lock holder needs this CPU to make progress
+    if (SDL_GetNumLogicalCPUCores() > 1) {
+        max_spins = SDL_clamp(2 * SDL_GetAtomicInt(&SDL_spinlock_spins), SDL_SPINLOCK_MIN_SPINS, SDL_SPINLOCK_MAX_SPINS);
+    } else {
+        max_spins = 0;
+    }
+    for (spins = 0, pause = 1; spins < max_spins; spins += pause) {
+        for (i = 0; i < pause; ++i) {
             SDL_CPUPauseInstruction();
-        } else {
-            // !!! FIXME: this doesn't definitely give up the current timeslice, it does different things on various platforms.
-            SDL_Delay(0);
         }
+        if (pause < SDL_SPINLOCK_MAX_PAUSE) {
+            pause *= 2;
+        }
+
+        // Only try to take the lock when it looks free, to keep the cache line shared while it's held
+        if (*(volatile SDL_SpinLock *)lock == 0 && SDL_TryLockSpinlock(lock)) {
+            // Move the estimate 1/8 of the way towards how long this took
+            const int estimate = SDL_GetAtomicInt(&SDL_spinlock_spins);
+            SDL_SetAtomicInt(&SDL_spinlock_spins, estimate + (spins - estimate) / 8);
+            return;
+        }
+    }
+
+    // Give the lock holder a chance to run before going to sleep
+    for (i = 0; i < SDL_SPINLOCK_YIELDS; ++i) {
+        SDL_Delay(0);
+        if (SDL_TryLockSpinlock(lock)) {
+            return;
+        }
+    }
+
+    // The lock holder is probably not running, stop burning the CPU and sleep until it's released
+#ifndef SDL_THREADS_DISABLED
+    {
+        SDL_SpinlockParking *parking = SDL_GetSpinlockParking(lock);
+
+        SDL_AddAtomicInt(&parking->parked, 1);
+        while (!SDL_TryLockSpinlock(lock)) {
+            SDL_WaitAtomicInt((SDL_AtomicInt *)lock, 1, SDL_SPINLOCK_PARK_TIMEOUT);
+            SDL_CompareAndSwapAtomicPointer(&parking->waking, lock, NULL);
+        }
+        SDL_CompareAndSwapAtomicPointer(&parking->waking, lock, NULL);
+        SDL_AddAtomicInt(&parking->parked, -1);
     }
+#else
+    while (!SDL_TryLockSpinlock(lock)) {
+        SDL_Delay(0);
+    }
+#endif
 }
 
 void SDL_UnlockSpinlock(SDL_SpinLock *lock)
@@ -200,4 +278,14 @@ void SDL_UnlockSpinlock(SDL_SpinLock *lock)
 #else
     *lock = 0;
 #endif
+
+#ifndef SDL_THREADS_DISABLED
+    {
+        SDL_SpinlockParking *parking = SDL_GetSpinlockParking(lock);
+        if (SDL_GetAtomicInt(&parking->parked) > 0 && SDL_GetAtomicPointer(&parking->waking) != lock) {
+            SDL_SetAtomicPointer(&parking->waking, lock);
+            SDL_WakeAtomicInt((SDL_AtomicInt *)lock, false);
+        }
+    }
+#endif
 }
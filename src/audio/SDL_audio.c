@@ -1144,6 +1144,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         return false;  // we're done, shut it down.
     }
 
+    SDL_TRACE_BEGIN("SDL_PlaybackAudioThreadIterate");
+
     bool failed = false;
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
@@ -1271,6 +1273,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
 
+    SDL_TRACE_END();
+
     return true;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1324,6 +1328,8 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
         return false;  // we're done, shut it down.
     }
 
+    SDL_TRACE_BEGIN("SDL_RecordingAudioThreadIterate");
+
     bool failed = false;
 
     if (!device->logical_devices) {
@@ -1391,6 +1397,8 @@ bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
 
+    SDL_TRACE_END();
+
     return true;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1800,6 +1808,7 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     SDL_UpdatedAudioDeviceFormat(device);  // start this off sane.
 
     device->currently_opened = true;  // mark this true even if impl.OpenDevice fails, so we know to clean up.
+    device->stepped_frames = 0;
     if (!current_audio.impl.OpenDevice(device)) {
         ClosePhysicalAudioDevice(device);  // clean up anything the backend left half-initialized.
         return false;
@@ -1999,6 +2008,57 @@ bool SDL_SetAudioIterationCallbacks(SDL_AudioDeviceID devid, SDL_AudioIterationC
     return result;
 }
 
+SDL_AudioOfflineClock SDL_GetAudioOfflineClock(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_OFFLINE_CLOCK);
+    if (hint) {
+        if (SDL_strcmp(hint, "fast") == 0) {
+            return SDL_AUDIO_OFFLINE_CLOCK_FAST;
+        } else if (SDL_strcmp(hint, "manual") == 0) {
+            return SDL_AUDIO_OFFLINE_CLOCK_MANUAL;
+        }
+    }
+    return SDL_AUDIO_OFFLINE_CLOCK_REALTIME;
+}
+
+bool SDL_StepAudioDevice(SDL_AudioDeviceID devid, int frames)
+{
+    if (frames < 0) {
+        return SDL_InvalidParamError("frames");
+    }
+
+    SDL_AudioDevice *device = ObtainPhysicalAudioDevice(devid);
+    bool result = false;
+    if (device) {
+        if (!current_audio.impl.SteppedByApp) {
+            SDL_SetError("Audio driver '%s' doesn't run on a manual clock", current_audio.name);
+        } else if (!device->currently_opened) {
+            SDL_SetError("Audio device isn't opened");
+        } else {
+            // The device lock is recursive, so the iterations can take it again while we hold it.
+            Sint64 pending = (Sint64)device->stepped_frames + frames;  // adding in 64 bits so huge steps can't overflow.
+            result = true;
+            while (pending >= device->sample_frames) {
+                const bool iterated = device->recording ? SDL_RecordingAudioThreadIterate(device) : SDL_PlaybackAudioThreadIterate(device);
+                if (!iterated) {
+                    // Same as the device thread: once the device is shutting down, stop iterating.
+                    pending = 0;
+                    result = SDL_SetError("Audio device is shutting down");
+                    break;
+                }
+                pending -= device->sample_frames;
+            }
+            device->stepped_frames = (int)pending;  // always less than a buffer now.
+
+            if (result && SDL_GetAtomicInt(&device->zombie)) {
+                result = SDL_SetError("Audio device has been disconnected");
+            }
+        }
+    }
+    ReleaseAudioDevice(device);
+    return result;
+}
+
 bool SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream * const *streams, int num_streams)
 {
     const bool islogical = !(devid & (1<<1));
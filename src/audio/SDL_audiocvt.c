@@ -413,6 +413,19 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq,
     return resample_rate;
 }
 
+static void UpdateAudioStreamResampleQuality(SDL_AudioStream *stream)
+{
+    Sint64 quality = SDL_AUDIO_RESAMPLE_SINC_MEDIUM;
+
+    // Don't create the properties just to look this up.
+    if (stream->props) {
+        quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality);
+        quality = SDL_clamp(quality, SDL_AUDIO_RESAMPLE_NEAREST, SDL_AUDIO_RESAMPLE_SINC_HIGH);
+    }
+
+    stream->resample_quality = (SDL_AudioResampleQuality)quality;
+}
+
 static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec, const int *chmap)
 {
     if (SDL_AudioSpecsEqual(&stream->input_spec, spec, stream->input_chmap, chmap)) {
@@ -436,6 +449,63 @@ static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioS
     return true;
 }
 
+// Only called by the single producer of a stream, without `stream->lock` held.
+static bool PutAudioStreamRing(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const int frame_size = stream->ring_frame_size;
+
+    if ((len % frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    const Uint32 frames = (Uint32)(len / frame_size);
+    const Uint32 head = SDL_GetAtomicU32(&stream->ring_head);
+    const Uint32 tail = SDL_GetAtomicU32(&stream->ring_tail);
+
+    // Never wait for the consumer, let the caller decide what to do.
+    if (frames > stream->ring_frames - (head - tail)) {
+        return SDL_SetError("Audio stream ring buffer is full");
+    }
+
+    const Uint32 offset = head & (stream->ring_frames - 1);
+    const Uint32 first = SDL_min(frames, stream->ring_frames - offset);
+    SDL_memcpy(stream->ring + (size_t)offset * frame_size, buf, (size_t)first * frame_size);
+    SDL_memcpy(stream->ring, (const Uint8 *)buf + (size_t)first * frame_size, (size_t)(frames - first) * frame_size);
+
+    // Only publish the frames once they've been written.
+    SDL_SetAtomicU32(&stream->ring_head, head + frames);
+
+    return true;
+}
+
+// Moves everything the producer has published so far into the queue.
+// you MUST hold `stream->lock` when calling this.
+static bool DrainAudioStreamRing(SDL_AudioStream *stream)
+{
+    if (!stream->ring) {
+        return true;
+    }
+
+    const int frame_size = stream->ring_frame_size;
+    const Uint32 head = SDL_GetAtomicU32(&stream->ring_head);
+    Uint32 tail = SDL_GetAtomicU32(&stream->ring_tail);
+
+    while (tail != head) {
+        const Uint32 offset = tail & (stream->ring_frames - 1);
+        const Uint32 frames = SDL_min(head - tail, stream->ring_frames - offset);
+
+        if (!SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, stream->ring + (size_t)offset * frame_size, (size_t)frames * frame_size)) {
+            return false;
+        }
+
+        // Hand the space back to the producer once it's been copied.
+        tail += frames;
+        SDL_SetAtomicU32(&stream->ring_tail, tail);
+    }
+
+    return true;
+}
+
 SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
 {
     SDL_ChooseAudioConverters();
@@ -448,6 +518,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
+    result->resample_quality = SDL_AUDIO_RESAMPLE_SINC_MEDIUM;
     result->queue = SDL_CreateAudioQueue(8192);
 
     if (!result->queue) {
@@ -593,6 +664,17 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
         }
     }
 
+    if (src_spec && stream->ring) {
+        // Data already in the ring buffer keeps the format it was put with.
+        if (src_spec->format != stream->src_spec.format || src_spec->channels != stream->src_spec.channels) {
+            SDL_UnlockMutex(stream->lock);
+            return SDL_SetError("Can't change the input format of a single producer audio stream");
+        } else if (!DrainAudioStreamRing(stream)) {
+            SDL_UnlockMutex(stream->lock);
+            return false;
+        }
+    }
+
     if (src_spec) {
         if (src_spec->channels != stream->src_spec.channels) {
             SDL_free(stream->src_chmap);
@@ -624,7 +706,9 @@ bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec
 
     SDL_LockMutex(stream->lock);
 
-    if (channels != spec->channels) {
+    if (isinput && !DrainAudioStreamRing(stream)) {
+        result = false;  // data already in the ring buffer has to keep the old channel map.
+    } else if (channels != spec->channels) {
         result = SDL_SetError("Wrong number of channels");
     } else if (!*stream_chmap && !chmap) {
         // already at default, we're good.
@@ -815,6 +899,17 @@ static bool PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int l
     SDL_Log("AUDIOSTREAM: wants to put %d bytes", len);
 #endif
 
+    if (stream->ring) {
+        // The data is copied into the ring buffer, so the caller's buffer is done with right away.
+        if (!PutAudioStreamRing(stream, buf, len)) {
+            return false;
+        }
+        if (callback) {
+            callback(userdata, buf, len);
+        }
+        return true;
+    }
+
     SDL_LockMutex(stream->lock);
 
     if (!CheckAudioStreamIsFullySetup(stream)) {
@@ -855,7 +950,7 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
 
-    if (len >= large_input_thresh) {
+    if (len >= large_input_thresh && !stream->ring) {
         void *data = SDL_malloc(len);
 
         if (!data) {
@@ -974,17 +1069,22 @@ bool SDL_PutAudioStreamPlanarData(SDL_AudioStream *stream, const void * const *c
     SDL_AudioSpec spec;
     int chmap_copy[SDL_MAX_CHANNELMAP_CHANNELS];
     int *chmap = NULL;
-    SDL_LockMutex(stream->lock);
-    if (!CheckAudioStreamIsFullySetup(stream)) {
+    if (stream->ring) {
+        // The input format can't change while there's a single producer, so don't take the lock.
+        SDL_copyp(&spec, &stream->src_spec);
+    } else {
+        SDL_LockMutex(stream->lock);
+        if (!CheckAudioStreamIsFullySetup(stream)) {
+            SDL_UnlockMutex(stream->lock);
+            return false;
+        }
+        SDL_copyp(&spec, &stream->src_spec);
+        if (stream->src_chmap) {
+            chmap = chmap_copy;
+            SDL_memcpy(chmap, stream->src_chmap, sizeof (*chmap) * spec.channels);
+        }
         SDL_UnlockMutex(stream->lock);
-        return false;
-    }
-    SDL_copyp(&spec, &stream->src_spec);
-    if (stream->src_chmap) {
-        chmap = chmap_copy;
-        SDL_memcpy(chmap, stream->src_chmap, sizeof (*chmap) * spec.channels);
     }
-    SDL_UnlockMutex(stream->lock);
 
     if (spec.channels == 1) {  // nothing to interleave, just use the usual function.
         return SDL_PutAudioStreamData(stream, channel_buffers[0], SDL_AUDIO_FRAMESIZE(spec) * num_samples);
@@ -1015,6 +1115,14 @@ bool SDL_PutAudioStreamPlanarData(SDL_AudioStream *stream, const void * const *c
 
     InterleaveAudioChannels(data, channel_buffers, num_channels, num_samples, &spec);
 
+    if (stream->ring) {
+        retval = PutAudioStreamRing(stream, data, len);
+        if (callback) {
+            callback(NULL, data, len);
+        }
+        return retval;
+    }
+
     // it's okay if the stream format changed on another thread while we didn't hold the lock; PutAudioStreamBufferInternal will notice
     //  and set up a new track with the right format, and the next SDL_PutAudioStreamData will notice that stream->src_spec doesn't
     //  match the new track and set up a new one again. It's a bad idea to change the format on another thread while putting here,
@@ -1056,9 +1164,66 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    const bool retval = DrainAudioStreamRing(stream);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
+    return retval;
+}
+
+bool SDL_SetAudioStreamSingleProducer(SDL_AudioStream *stream, int frames)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (frames < 0) {
+        return SDL_InvalidParamError("frames");
+    }
+
+    SDL_LockMutex(stream->lock);
+
+    if (frames > 0 && stream->src_spec.format == SDL_AUDIO_UNKNOWN) {
+        SDL_UnlockMutex(stream->lock);
+        return SDL_SetError("Stream has no source format");
+    }
+
+    // Anything the producer already put in the old ring buffer goes into the queue first.
+    if (!DrainAudioStreamRing(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return false;
+    }
+
+    Uint8 *ring = NULL;
+    Uint32 ring_frames = 0;
+    const int frame_size = SDL_AUDIO_FRAMESIZE(stream->src_spec);
+
+    if (frames > 0) {
+        // A power of two, so the frame counters can wrap around freely.
+        ring_frames = 1;
+        while (ring_frames < (Uint32)frames) {
+            ring_frames <<= 1;
+        }
+
+        if ((Sint64)ring_frames * frame_size > SDL_INT_MAX) {
+            SDL_UnlockMutex(stream->lock);
+            return SDL_InvalidParamError("frames");
+        }
+
+        ring = (Uint8 *)SDL_malloc((size_t)ring_frames * frame_size);
+        if (!ring) {
+            SDL_UnlockMutex(stream->lock);
+            return false;
+        }
+    }
+
+    SDL_free(stream->ring);
+    stream->ring = ring;
+    stream->ring_frames = ring_frames;
+    stream->ring_frame_size = frame_size;
+    SDL_SetAtomicU32(&stream->ring_head, 0);
+    SDL_SetAtomicU32(&stream->ring_tail, 0);
+
+    SDL_UnlockMutex(stream->lock);
+
     return true;
 }
 
@@ -1117,7 +1282,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1224,7 +1389,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1297,7 +1462,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     SDL_ResampleAudio(resample_channels,
                   (const float *)input_buffer, input_frames,
                   (float *)resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_quality);
 
     // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
@@ -1334,6 +1499,13 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
+    if (!DrainAudioStreamRing(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    UpdateAudioStreamResampleQuality(stream);
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
@@ -1433,6 +1605,9 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    DrainAudioStreamRing(stream);
+    UpdateAudioStreamResampleQuality(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1454,6 +1629,7 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamRing(stream);
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1470,6 +1646,9 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    if (stream->ring) {
+        SDL_SetAtomicU32(&stream->ring_tail, SDL_GetAtomicU32(&stream->ring_head));
+    }
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
@@ -1500,6 +1679,7 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_aligned_free(stream->work_buffer);
+    SDL_free(stream->ring);
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
 
@@ -26,27 +26,33 @@
 
 // SDL's resampler uses a "bandlimited interpolation" algorithm:
 //     https://ccrma.stanford.edu/~jos/resample/
+// There are three sinc filters of different lengths to choose from, as well as
+// plain nearest, linear and cubic interpolation for when speed matters more.
 
-// TODO: Support changing this at runtime?
 #if defined(SDL_SSE_INTRINSICS) || defined(SDL_NEON_INTRINSICS)
 // In <current year>, SSE is basically mandatory anyway
-// We want RESAMPLER_SAMPLES_PER_FRAME to be a multiple of 4, to make SIMD easier
+// We want the samples per frame to be a multiple of 4, to make SIMD easier
 #define RESAMPLER_ZERO_CROSSINGS 6
 #else
 #define RESAMPLER_ZERO_CROSSINGS 5
 #endif
+#define RESAMPLER_LOW_ZERO_CROSSINGS  4
+#define RESAMPLER_HIGH_ZERO_CROSSINGS 16
 
-#define RESAMPLER_SAMPLES_PER_FRAME (RESAMPLER_ZERO_CROSSINGS * 2)
+#define RESAMPLER_SAMPLES_PER_FRAME      (RESAMPLER_ZERO_CROSSINGS * 2)
+#define RESAMPLER_LOW_SAMPLES_PER_FRAME  (RESAMPLER_LOW_ZERO_CROSSINGS * 2)
+#define RESAMPLER_HIGH_SAMPLES_PER_FRAME (RESAMPLER_HIGH_ZERO_CROSSINGS * 2)
 
-// For a given srcpos, `srcpos + frame` are sampled, where `-RESAMPLER_ZERO_CROSSINGS < frame <= RESAMPLER_ZERO_CROSSINGS`.
+// For a given srcpos, `srcpos + frame` are sampled, where `-zero_crossings < frame <= zero_crossings`.
 // Note, when upsampling, it is also possible to start sampling from `srcpos = -1`.
-#define RESAMPLER_MAX_PADDING_FRAMES (RESAMPLER_ZERO_CROSSINGS + 1)
+#define RESAMPLER_PADDING_FRAMES(zero_crossings) ((zero_crossings) + 1)
+#define RESAMPLER_MAX_PADDING_FRAMES             RESAMPLER_PADDING_FRAMES(RESAMPLER_HIGH_ZERO_CROSSINGS)
 
 // More bits gives more precision, at the cost of a larger table.
-#define RESAMPLER_BITS_PER_ZERO_CROSSING    3
-#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
-#define RESAMPLER_FILTER_INTERP_BITS        (32 - RESAMPLER_BITS_PER_ZERO_CROSSING)
-#define RESAMPLER_FILTER_INTERP_RANGE       (1 << RESAMPLER_FILTER_INTERP_BITS)
+#define RESAMPLER_BITS_PER_ZERO_CROSSING         3
+#define RESAMPLER_HIGH_BITS_PER_ZERO_CROSSING    5
+#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING      (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
+#define RESAMPLER_HIGH_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_HIGH_BITS_PER_ZERO_CROSSING)
 
 // ResampleFrame is just a vector/matrix/matrix multiplication.
 // It performs cubic interpolation of the filter, then multiplies that with the input.
@@ -68,22 +74,22 @@ typedef union Cubic
 
 } Cubic;
 
-static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps)
 {
     const float frac2 = frac * frac;
     const float frac3 = frac * frac2;
 
     int i, chan;
-    float scales[RESAMPLER_SAMPLES_PER_FRAME];
+    float scales[RESAMPLER_HIGH_SAMPLES_PER_FRAME];
 
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i, ++filter) {
+    for (i = 0; i < taps; ++i, ++filter) {
         scales[i] = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
     }
 
     for (chan = 0; chan < chans; ++chan) {
         float out = 0.0f;
 
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i) {
+        for (i = 0; i < taps; ++i) {
             out += src[i * chans + chan] * scales[i];
         }
 
@@ -91,7 +97,7 @@ static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *fil
     }
 }
 
-static void ResampleFrame_Mono(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+static void ResampleFrame_Mono(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps)
 {
     const float frac2 = frac * frac;
     const float frac3 = frac * frac2;
@@ -99,7 +105,7 @@ static void ResampleFrame_Mono(const float *src, float *dst, const Cubic *filter
     int i;
     float out = 0.0f;
 
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i, ++filter) {
+    for (i = 0; i < taps; ++i, ++filter) {
         // Interpolate between the nearest two filters
         const float scale = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
 
@@ -109,7 +115,7 @@ static void ResampleFrame_Mono(const float *src, float *dst, const Cubic *filter
     dst[0] = out;
 }
 
-static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps)
 {
     const float frac2 = frac * frac;
     const float frac3 = frac * frac2;
@@ -118,7 +124,7 @@ static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filt
     float out0 = 0.0f;
     float out1 = 0.0f;
 
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i, ++filter) {
+    for (i = 0; i < taps; ++i, ++filter) {
         // Interpolate between the nearest two filters
         const float scale = filter->v[0] + (filter->v[1] * frac) + (filter->v[2] * frac2) + (filter->v[3] * frac3);
 
@@ -130,47 +136,41 @@ static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filt
     dst[1] = out1;
 }
 
-#ifdef SDL_SSE_INTRINSICS
-#define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
-
-static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+// When the position is exactly on one of the points of the filter table, there's
+// nothing to interpolate, and the filter can be applied as it is.
+static void ResamplePhase_Generic(const float *src, float *dst, const float *filter, int chans, int taps)
 {
-#if RESAMPLER_SAMPLES_PER_FRAME != 12
-#error Invalid samples per frame
-#endif
+    int i, chan;
 
-    __m128 f0, f1, f2;
+    for (chan = 0; chan < chans; ++chan) {
+        float out = 0.0f;
 
-    {
-        const __m128 frac1 = _mm_set1_ps(frac);
-        const __m128 frac2 = _mm_mul_ps(frac1, frac1);
-        const __m128 frac3 = _mm_mul_ps(frac1, frac2);
-
-// Transposed in SetupAudioResampler
-// Explicitly use _mm_load_ps to workaround ICE in GCC 4.9.4 accessing Cubic.v128
-#define X(out)                                               \
-    out = _mm_load_ps(filter[0].v);                          \
-    out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v)); \
-    out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v)); \
-    out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v)); \
-    filter += 4
-
-        X(f0);
-        X(f1);
-        X(f2);
+        for (i = 0; i < taps; ++i) {
+            out += src[i * chans + chan] * filter[i];
+        }
 
-#undef X
+        dst[chan] = out;
     }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+#define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
+
+// Multiplies the filter taps in f (4 per vector) with the input
+SDL_FORCE_INLINE void SDL_TARGETING("sse") ResampleApply_SSE(const float *src, float *dst, const __m128 *f, int chans, int taps)
+{
+    const int groups = taps / 4;
+    int g;
 
     if (chans == 2) {
         // Duplicate each of the filter elements and multiply by the input
         // Use two accumulators to improve throughput
-        __m128 out0 = _mm_mul_ps(_mm_loadu_ps(src + 0), _mm_unpacklo_ps(f0, f0));
-        __m128 out1 = _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(f0, f0));
-        out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 8), _mm_unpacklo_ps(f1, f1));
-        out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 12), _mm_unpackhi_ps(f1, f1));
-        out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 16), _mm_unpacklo_ps(f2, f2));
-        out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 20), _mm_unpackhi_ps(f2, f2));
+        __m128 out0 = _mm_mul_ps(_mm_loadu_ps(src + 0), _mm_unpacklo_ps(f[0], f[0]));
+        __m128 out1 = _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(f[0], f[0]));
+        for (g = 1; g < groups; ++g) {
+            out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + g * 8 + 0), _mm_unpacklo_ps(f[g], f[g]));
+            out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + g * 8 + 4), _mm_unpackhi_ps(f[g], f[g]));
+        }
 
         // Add the accumulators together
         __m128 out = _mm_add_ps(out0, out1);
@@ -185,9 +185,10 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
 
     if (chans == 1) {
         // Multiply the filter by the input
-        __m128 out = _mm_mul_ps(f0, _mm_loadu_ps(src + 0));
-        out = sdl_madd_ps(out, f1, _mm_loadu_ps(src + 4));
-        out = sdl_madd_ps(out, f2, _mm_loadu_ps(src + 8));
+        __m128 out = _mm_mul_ps(f[0], _mm_loadu_ps(src + 0));
+        for (g = 1; g < groups; ++g) {
+            out = sdl_madd_ps(out, f[g], _mm_loadu_ps(src + g * 4));
+        }
 
         // Horizontal sum
         __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
@@ -210,18 +211,14 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     out = sdl_madd_ps(out, _mm_loadu_ps(in), _mm_shuffle_ps(a, a, _MM_SHUFFLE(b, b, b, b))); \
     in += chans
 
-#define Y(a)       \
-    X(a, 0, out0); \
-    X(a, 1, out1); \
-    X(a, 2, out0); \
-    X(a, 3, out1)
-
-        Y(f0);
-        Y(f1);
-        Y(f2);
+        for (g = 0; g < groups; ++g) {
+            X(f[g], 0, out0);
+            X(f[g], 1, out1);
+            X(f[g], 2, out0);
+            X(f[g], 3, out1);
+        }
 
 #undef X
-#undef Y
 
         // Add the accumulators together
         __m128 out = _mm_add_ps(out0, out1);
@@ -234,23 +231,16 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     // Without vgatherdps (AVX2), this gets quite messy.
     for (; chan < chans; ++chan) {
         const float *in = &src[chan];
-        __m128 v0, v1, v2;
+        __m128 out = _mm_setzero_ps();
 
-#define X(x)                                                                         \
-    x = _mm_unpacklo_ps(_mm_load_ss(in), _mm_load_ss(in + chans));                   \
-    in += chans + chans;                                                             \
-    x = _mm_movelh_ps(x, _mm_unpacklo_ps(_mm_load_ss(in), _mm_load_ss(in + chans))); \
-    in += chans + chans
+        for (g = 0; g < groups; ++g) {
+            __m128 v = _mm_unpacklo_ps(_mm_load_ss(in), _mm_load_ss(in + chans));
+            in += chans + chans;
+            v = _mm_movelh_ps(v, _mm_unpacklo_ps(_mm_load_ss(in), _mm_load_ss(in + chans)));
+            in += chans + chans;
 
-        X(v0);
-        X(v1);
-        X(v2);
-
-#undef X
-
-        __m128 out = _mm_mul_ps(f0, v0);
-        out = sdl_madd_ps(out, f1, v1);
-        out = sdl_madd_ps(out, f2, v2);
+            out = g ? sdl_madd_ps(out, f[g], v) : _mm_mul_ps(f[g], v);
+        }
 
         // Horizontal sum
         __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
@@ -261,48 +251,177 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 }
 
+SDL_FORCE_INLINE void SDL_TARGETING("sse") ResampleFrame_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans, const int taps)
+{
+    __m128 f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+    const __m128 frac1 = _mm_set1_ps(frac);
+    const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+    const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+    int g;
+
+    // Transposed in SetupAudioResampler
+    // Explicitly use _mm_load_ps to workaround ICE in GCC 4.9.4 accessing Cubic.v128
+    for (g = 0; g < taps / 4; ++g, filter += 4) {
+        __m128 out = _mm_load_ps(filter[0].v);
+        out = sdl_madd_ps(out, frac1, _mm_load_ps(filter[1].v));
+        out = sdl_madd_ps(out, frac2, _mm_load_ps(filter[2].v));
+        out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v));
+        f[g] = out;
+    }
+
+    ResampleApply_SSE(src, dst, f, chans, taps);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("sse") ResamplePhase_SSE(const float *src, float *dst, const float *filter, int chans, const int taps)
+{
+    __m128 f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+    int g;
+
+    for (g = 0; g < taps / 4; ++g) {
+        f[g] = _mm_loadu_ps(filter + g * 4);
+    }
+
+    ResampleApply_SSE(src, dst, f, chans, taps);
+}
+
+// Separate functions for each filter length, so the loops above can be unrolled.
+#define RESAMPLER_SSE_FUNCS(name, samples_per_frame)                                                                                  \
+    static void SDL_TARGETING("sse") ResampleFrame_SSE_##name(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps) \
+    {                                                                                                                                 \
+        ResampleFrame_SSE(src, dst, filter, frac, chans, samples_per_frame);                                                          \
+    }                                                                                                                                 \
+    static void SDL_TARGETING("sse") ResamplePhase_SSE_##name(const float *src, float *dst, const float *filter, int chans, int taps)  \
+    {                                                                                                                                 \
+        ResamplePhase_SSE(src, dst, filter, chans, samples_per_frame);                                                                \
+    }
+
+RESAMPLER_SSE_FUNCS(Low, RESAMPLER_LOW_SAMPLES_PER_FRAME)
+RESAMPLER_SSE_FUNCS(Medium, RESAMPLER_SAMPLES_PER_FRAME)
+RESAMPLER_SSE_FUNCS(High, RESAMPLER_HIGH_SAMPLES_PER_FRAME)
+
+#undef RESAMPLER_SSE_FUNCS
 #undef sdl_madd_ps
 #endif
 
-#ifdef SDL_NEON_INTRINSICS
-static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+#ifdef SDL_AVX2_INTRINSICS
+// The AVX2 versions work on 8 taps at a time, and only cover mono and stereo.
+// Other channel counts go through the SSE versions.
+
+// Multiplies the filter taps in f (8 per vector) with the input
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") ResampleApply_AVX2(const float *src, float *dst, const __m256 *f, int chans, int taps)
 {
-#if RESAMPLER_SAMPLES_PER_FRAME != 12
-#error Invalid samples per frame
-#endif
+    const int groups = taps / 8;
+    int g;
 
-    float32x4_t f0, f1, f2;
+    if (chans == 2) {
+        const __m256i lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+        const __m256i hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+        __m256 out0 = _mm256_mul_ps(_mm256_loadu_ps(src + 0), _mm256_permutevar8x32_ps(f[0], lo));
+        __m256 out1 = _mm256_mul_ps(_mm256_loadu_ps(src + 8), _mm256_permutevar8x32_ps(f[0], hi));
+        for (g = 1; g < groups; ++g) {
+            out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_loadu_ps(src + g * 16 + 0), _mm256_permutevar8x32_ps(f[g], lo)));
+            out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_loadu_ps(src + g * 16 + 8), _mm256_permutevar8x32_ps(f[g], hi)));
+        }
 
-    {
-        const float32x4_t frac1 = vdupq_n_f32(frac);
-        const float32x4_t frac2 = vmulq_f32(frac1, frac1);
-        const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+        __m256 sum = _mm256_add_ps(out0, out1);
+        __m128 out = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+        out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+        _mm_storel_pi((__m64 *)dst, out);
+    } else {
+        __m256 sum = _mm256_mul_ps(f[0], _mm256_loadu_ps(src + 0));
+        for (g = 1; g < groups; ++g) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(f[g], _mm256_loadu_ps(src + g * 8)));
+        }
 
-// Transposed in SetupAudioResampler
-#define X(out)                                                                                                                  \
-    out = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3); \
-    filter += 4
+        __m128 out = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+        __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
+        out = _mm_add_ps(out, shuf);
+        out = _mm_add_ss(out, _mm_movehl_ps(shuf, out));
+        _mm_store_ss(dst, out);
+    }
+}
 
-        X(f0);
-        X(f1);
-        X(f2);
+// Only used for filters with a multiple of 8 taps, which are transposed in groups of 8.
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") ResampleFrame_AVX2(const float *src, float *dst, const Cubic *filter, float frac, int chans, const int taps)
+{
+    __m256 f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 8];
+    const __m256 frac1 = _mm256_set1_ps(frac);
+    const __m256 frac2 = _mm256_mul_ps(frac1, frac1);
+    const __m256 frac3 = _mm256_mul_ps(frac1, frac2);
+    int g;
+
+    for (g = 0; g < taps / 8; ++g, filter += 8) {
+        __m256 out = _mm256_loadu_ps(filter[0].v);
+        out = _mm256_add_ps(out, _mm256_mul_ps(frac1, _mm256_loadu_ps(filter[2].v)));
+        out = _mm256_add_ps(out, _mm256_mul_ps(frac2, _mm256_loadu_ps(filter[4].v)));
+        out = _mm256_add_ps(out, _mm256_mul_ps(frac3, _mm256_loadu_ps(filter[6].v)));
+        f[g] = out;
+    }
 
-#undef X
+    if (chans <= 2) {
+        ResampleApply_AVX2(src, dst, f, chans, taps);
+    } else {
+        float taps_buffer[RESAMPLER_HIGH_SAMPLES_PER_FRAME];
+        for (g = 0; g < taps / 8; ++g) {
+            _mm256_storeu_ps(taps_buffer + g * 8, f[g]);
+        }
+        ResamplePhase_SSE(src, dst, taps_buffer, chans, taps);
     }
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") ResamplePhase_AVX2(const float *src, float *dst, const float *filter, int chans, const int taps)
+{
+    __m256 f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 8];
+    int g;
+
+    if (chans > 2) {
+        ResamplePhase_SSE(src, dst, filter, chans, taps);
+        return;
+    }
+
+    for (g = 0; g < taps / 8; ++g) {
+        f[g] = _mm256_loadu_ps(filter + g * 8);
+    }
+
+    ResampleApply_AVX2(src, dst, f, chans, taps);
+}
+
+// The medium filter has 12 taps, which doesn't split into groups of 8, so it stays with SSE.
+#define RESAMPLER_AVX2_FUNCS(name, samples_per_frame)                                                                                  \
+    static void SDL_TARGETING("avx2") ResampleFrame_AVX2_##name(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps) \
+    {                                                                                                                                  \
+        ResampleFrame_AVX2(src, dst, filter, frac, chans, samples_per_frame);                                                          \
+    }                                                                                                                                  \
+    static void SDL_TARGETING("avx2") ResamplePhase_AVX2_##name(const float *src, float *dst, const float *filter, int chans, int taps)  \
+    {                                                                                                                                  \
+        ResamplePhase_AVX2(src, dst, filter, chans, samples_per_frame);                                                                \
+    }
+
+RESAMPLER_AVX2_FUNCS(Low, RESAMPLER_LOW_SAMPLES_PER_FRAME)
+RESAMPLER_AVX2_FUNCS(High, RESAMPLER_HIGH_SAMPLES_PER_FRAME)
+
+#undef RESAMPLER_AVX2_FUNCS
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+// Multiplies the filter taps in f (4 per vector) with the input
+SDL_FORCE_INLINE void ResampleApply_NEON(const float *src, float *dst, const float32x4_t *f, int chans, int taps)
+{
+    const int groups = taps / 4;
+    int g;
 
     if (chans == 2) {
-        float32x4x2_t g0 = vzipq_f32(f0, f0);
-        float32x4x2_t g1 = vzipq_f32(f1, f1);
-        float32x4x2_t g2 = vzipq_f32(f2, f2);
+        float32x4x2_t g0 = vzipq_f32(f[0], f[0]);
 
         // Duplicate each of the filter elements and multiply by the input
         // Use two accumulators to improve throughput
         float32x4_t out0 = vmulq_f32(vld1q_f32(src + 0), g0.val[0]);
         float32x4_t out1 = vmulq_f32(vld1q_f32(src + 4), g0.val[1]);
-        out0 = vmlaq_f32(out0, vld1q_f32(src + 8), g1.val[0]);
-        out1 = vmlaq_f32(out1, vld1q_f32(src + 12), g1.val[1]);
-        out0 = vmlaq_f32(out0, vld1q_f32(src + 16), g2.val[0]);
-        out1 = vmlaq_f32(out1, vld1q_f32(src + 20), g2.val[1]);
+        for (g = 1; g < groups; ++g) {
+            float32x4x2_t gn = vzipq_f32(f[g], f[g]);
+            out0 = vmlaq_f32(out0, vld1q_f32(src + g * 8 + 0), gn.val[0]);
+            out1 = vmlaq_f32(out1, vld1q_f32(src + g * 8 + 4), gn.val[1]);
+        }
 
         // Add the accumulators together
         out0 = vaddq_f32(out0, out1);
@@ -317,9 +436,10 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
 
     if (chans == 1) {
         // Multiply the filter by the input
-        float32x4_t out = vmulq_f32(f0, vld1q_f32(src + 0));
-        out = vmlaq_f32(out, f1, vld1q_f32(src + 4));
-        out = vmlaq_f32(out, f2, vld1q_f32(src + 8));
+        float32x4_t out = vmulq_f32(f[0], vld1q_f32(src + 0));
+        for (g = 1; g < groups; ++g) {
+            out = vmlaq_f32(out, f[g], vld1q_f32(src + g * 4));
+        }
 
         // Horizontal sum
         float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
@@ -341,18 +461,14 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
     out = vmlaq_f32(out, vld1q_f32(in), vdupq_lane_f32(a, b)); \
     in += chans
 
-#define Y(a)                      \
-    X(vget_low_f32(a), 0, out0);  \
-    X(vget_low_f32(a), 1, out1);  \
-    X(vget_high_f32(a), 0, out0); \
-    X(vget_high_f32(a), 1, out1)
-
-        Y(f0);
-        Y(f1);
-        Y(f2);
+        for (g = 0; g < groups; ++g) {
+            X(vget_low_f32(f[g]), 0, out0);
+            X(vget_low_f32(f[g]), 1, out1);
+            X(vget_high_f32(f[g]), 0, out0);
+            X(vget_high_f32(f[g]), 1, out1);
+        }
 
 #undef X
-#undef Y
 
         // Add the accumulators together
         float32x4_t out = vaddq_f32(out0, out1);
@@ -364,27 +480,20 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
     // Channel counts 1,2,4,8 are already handled above, leaving 3,5,6,7 to deal with (looping 3,1,2,3 times).
     for (; chan < chans; ++chan) {
         const float *in = &src[chan];
-        float32x4_t v0, v1, v2;
-
-#define X(x)                      \
-    x = vld1q_dup_f32(in);        \
-    in += chans;                  \
-    x = vld1q_lane_f32(in, x, 1); \
-    in += chans;                  \
-    x = vld1q_lane_f32(in, x, 2); \
-    in += chans;                  \
-    x = vld1q_lane_f32(in, x, 3); \
-    in += chans
-
-        X(v0);
-        X(v1);
-        X(v2);
-
-#undef X
-
-        float32x4_t out = vmulq_f32(f0, v0);
-        out = vmlaq_f32(out, f1, v1);
-        out = vmlaq_f32(out, f2, v2);
+        float32x4_t out = vdupq_n_f32(0);
+
+        for (g = 0; g < groups; ++g) {
+            float32x4_t v = vld1q_dup_f32(in);
+            in += chans;
+            v = vld1q_lane_f32(in, v, 1);
+            in += chans;
+            v = vld1q_lane_f32(in, v, 2);
+            in += chans;
+            v = vld1q_lane_f32(in, v, 3);
+            in += chans;
+
+            out = g ? vmlaq_f32(out, f[g], v) : vmulq_f32(f[g], v);
+        }
 
         // Horizontal sum
         float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
@@ -393,6 +502,51 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
         vst1_lane_f32(&dst[chan], sum, 0);
     }
 }
+
+SDL_FORCE_INLINE void ResampleFrame_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans, const int taps)
+{
+    float32x4_t f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+    const float32x4_t frac1 = vdupq_n_f32(frac);
+    const float32x4_t frac2 = vmulq_f32(frac1, frac1);
+    const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+    int g;
+
+    // Transposed in SetupAudioResampler
+    for (g = 0; g < taps / 4; ++g, filter += 4) {
+        f[g] = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3);
+    }
+
+    ResampleApply_NEON(src, dst, f, chans, taps);
+}
+
+SDL_FORCE_INLINE void ResamplePhase_NEON(const float *src, float *dst, const float *filter, int chans, const int taps)
+{
+    float32x4_t f[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+    int g;
+
+    for (g = 0; g < taps / 4; ++g) {
+        f[g] = vld1q_f32(filter + g * 4);
+    }
+
+    ResampleApply_NEON(src, dst, f, chans, taps);
+}
+
+// Separate functions for each filter length, so the loops above can be unrolled.
+#define RESAMPLER_NEON_FUNCS(name, samples_per_frame)                                                                \
+    static void ResampleFrame_NEON_##name(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps) \
+    {                                                                                                                \
+        ResampleFrame_NEON(src, dst, filter, frac, chans, samples_per_frame);                                        \
+    }                                                                                                                \
+    static void ResamplePhase_NEON_##name(const float *src, float *dst, const float *filter, int chans, int taps)  \
+    {                                                                                                                \
+        ResamplePhase_NEON(src, dst, filter, chans, samples_per_frame);                                              \
+    }
+
+RESAMPLER_NEON_FUNCS(Low, RESAMPLER_LOW_SAMPLES_PER_FRAME)
+RESAMPLER_NEON_FUNCS(Medium, RESAMPLER_SAMPLES_PER_FRAME)
+RESAMPLER_NEON_FUNCS(High, RESAMPLER_HIGH_SAMPLES_PER_FRAME)
+
+#undef RESAMPLER_NEON_FUNCS
 #endif
 
 // Calculate the cubic equation which passes through all four points.
@@ -451,37 +605,64 @@ static float Sinc(const float *table, int x, int y)
     return (s * y) / x;
 }
 
-static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans, int taps);
+typedef void (*ResamplePhaseFunc)(const float *src, float *dst, const float *filter, int chans, int taps);
 
-static void GenerateResamplerFilter(void)
+typedef struct ResamplerSinc
 {
-    enum
-    {
-        // Generate samples at 3x the target resolution, so that we have samples at [0, 1/3, 2/3, 1] of each position
-        TABLE_SAMPLES_PER_ZERO_CROSSING = RESAMPLER_SAMPLES_PER_ZERO_CROSSING * 3,
-        TABLE_SIZE = RESAMPLER_ZERO_CROSSINGS * TABLE_SAMPLES_PER_ZERO_CROSSING,
-    };
+    int zero_crossings;
+    int bits_per_zero_crossing;
+    float dB;
+    Cubic *filter;  // [1 << bits_per_zero_crossing][zero_crossings * 2], transposed for SIMD
+    float *phases;  // [1 << bits_per_zero_crossing][zero_crossings * 2], the filter at each point of the table
+    ResampleFrameFunc frame[8];
+    ResamplePhaseFunc phase[8];
+} ResamplerSinc;
+
+static Cubic ResamplerFilterLow[RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_LOW_SAMPLES_PER_FRAME];
+static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_SAMPLES_PER_FRAME];
+static Cubic ResamplerFilterHigh[RESAMPLER_HIGH_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_HIGH_SAMPLES_PER_FRAME];
+static float ResamplerPhasesLow[RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_LOW_SAMPLES_PER_FRAME];
+static float ResamplerPhases[RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_SAMPLES_PER_FRAME];
+static float ResamplerPhasesHigh[RESAMPLER_HIGH_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_HIGH_SAMPLES_PER_FRAME];
+
+// Indexed by SDL_AudioResampleQuality - SDL_AUDIO_RESAMPLE_SINC_LOW
+static ResamplerSinc ResamplerSincs[3] = {
+    { RESAMPLER_LOW_ZERO_CROSSINGS, RESAMPLER_BITS_PER_ZERO_CROSSING, 60.0f, ResamplerFilterLow, ResamplerPhasesLow },
+    { RESAMPLER_ZERO_CROSSINGS, RESAMPLER_BITS_PER_ZERO_CROSSING, 80.0f, ResamplerFilter, ResamplerPhases },
+    { RESAMPLER_HIGH_ZERO_CROSSINGS, RESAMPLER_HIGH_BITS_PER_ZERO_CROSSING, 100.0f, ResamplerFilterHigh, ResamplerPhasesHigh },
+};
+
+static void GenerateResamplerFilter(ResamplerSinc *sinc)
+{
+    // Generate samples at 3x the target resolution, so that we have samples at [0, 1/3, 2/3, 1] of each position
+    static float sinc_table[RESAMPLER_HIGH_SAMPLES_PER_ZERO_CROSSING * 3];
+    static float filter[RESAMPLER_HIGH_ZERO_CROSSINGS * RESAMPLER_HIGH_SAMPLES_PER_ZERO_CROSSING * 3 + 1];
+
+    const int zero_crossings = sinc->zero_crossings;
+    const int samples_per_zero_crossing = 1 << sinc->bits_per_zero_crossing;
+    const int samples_per_frame = zero_crossings * 2;
+    const int table_samples_per_zero_crossing = samples_per_zero_crossing * 3;
+    const int table_size = zero_crossings * table_samples_per_zero_crossing;
 
     // if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab.
-    const float dB = 80.0f;
+    const float dB = sinc->dB;
     const float beta = 0.1102f * (dB - 8.7f);
     const float bessel_beta = BesselI0(beta);
-    const float lensqr = TABLE_SIZE * TABLE_SIZE;
+    const float lensqr = (float)table_size * table_size;
 
     int i, j;
 
-    float sinc[TABLE_SAMPLES_PER_ZERO_CROSSING];
-    SincTable(sinc, TABLE_SAMPLES_PER_ZERO_CROSSING);
+    SincTable(sinc_table, table_samples_per_zero_crossing);
 
     // Generate one wing of the filter
     // https://en.wikipedia.org/wiki/Kaiser_window
     // https://en.wikipedia.org/wiki/Whittaker%E2%80%93Shannon_interpolation_formula
-    float filter[TABLE_SIZE + 1];
     filter[0] = 1.0f;
 
-    for (i = 1; i <= TABLE_SIZE; ++i) {
+    for (i = 1; i <= table_size; ++i) {
         float b = BesselI0(beta * SDL_sqrtf((lensqr - (i * i)) / lensqr)) / bessel_beta;
-        float s = Sinc(sinc, i, TABLE_SAMPLES_PER_ZERO_CROSSING);
+        float s = Sinc(sinc_table, i, table_samples_per_zero_crossing);
         filter[i] = b * s;
     }
 
@@ -492,81 +673,110 @@ static void GenerateResamplerFilter(void)
     // For the left wing, this means interpolating "forwards" (away from the center)
     // For the right wing, this means interpolating "backwards" (towards the center)
     //
-    // The center of the filter is at the end of the left wing (RESAMPLER_ZERO_CROSSINGS - 1)
+    // The center of the filter is at the end of the left wing (zero_crossings - 1)
     // The left wing is the filter, but reversed
     // The right wing is the filter, but offset by 1
     //
     // Since the right wing is offset by 1, this just means we interpolate backwards
     // between the same points, instead of forwards
     // interp(p[n], p[n+1], t) = interp(p[n+1], p[n+1-1], 1 - t) = interp(p[n+1], p[n], 1 - t)
-    for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
-        for (j = 0; j < RESAMPLER_ZERO_CROSSINGS; ++j) {
-            const float *ys = &filter[((j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING) + i) * 3];
+    for (i = 0; i < samples_per_zero_crossing; ++i) {
+        for (j = 0; j < zero_crossings; ++j) {
+            const float *ys = &filter[((j * samples_per_zero_crossing) + i) * 3];
 
-            Cubic *fwd = &ResamplerFilter[i][RESAMPLER_ZERO_CROSSINGS - j - 1];
-            Cubic *rev = &ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING - i - 1][RESAMPLER_ZERO_CROSSINGS + j];
+            Cubic *fwd = &sinc->filter[i * samples_per_frame + zero_crossings - j - 1];
+            Cubic *rev = &sinc->filter[(samples_per_zero_crossing - i - 1) * samples_per_frame + zero_crossings + j];
 
             // Calculate the cubic equation of the 4 points
             CubicLeastSquares(fwd, ys[0], ys[1], ys[2], ys[3]);
             CubicLeastSquares(rev, ys[3], ys[2], ys[1], ys[0]);
         }
     }
-}
 
-typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
-static ResampleFrameFunc ResampleFrame[8];
+    // The constant term of each cubic is the filter at that point of the table.
+    for (i = 0; i < samples_per_zero_crossing * samples_per_frame; ++i) {
+        sinc->phases[i] = sinc->filter[i].v[0];
+    }
+}
 
-// Transpose 4x4 floats
-static void Transpose4x4(Cubic *data)
+// Transpose each group of `width` (4 or 8) cubics, so the same coefficient of
+// neighbouring taps is next to each other.
+static void TransposeCubics(Cubic *data, int width)
 {
     int i, j;
 
-    Cubic temp[4] = { data[0], data[1], data[2], data[3] };
+    Cubic temp[8];
+    SDL_memcpy(temp, data, width * sizeof(Cubic));
 
-    for (i = 0; i < 4; ++i) {
+    for (i = 0; i < width; ++i) {
         for (j = 0; j < 4; ++j) {
-            data[i].v[j] = temp[j].v[i];
+            ((float *)data)[j * width + i] = temp[i].v[j];
         }
     }
 }
 
 static void SetupAudioResampler(void)
 {
-    int i, j;
-    bool transpose = false;
+    int i, j, s;
+
+    for (s = 0; s < SDL_arraysize(ResamplerSincs); ++s) {
+        ResamplerSinc *sinc = &ResamplerSincs[s];
+        const int samples_per_frame = sinc->zero_crossings * 2;
+        const int rows = 1 << sinc->bits_per_zero_crossing;
+        int transpose = 0;
 
-    GenerateResamplerFilter();
+        GenerateResamplerFilter(sinc);
 
 #ifdef SDL_SSE_INTRINSICS
-    if (SDL_HasSSE()) {
-        for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic_SSE;
-        }
-        transpose = true;
-    } else
+        if (SDL_HasSSE()) {
+            static const ResampleFrameFunc frame_sse[] = { ResampleFrame_SSE_Low, ResampleFrame_SSE_Medium, ResampleFrame_SSE_High };
+            static const ResamplePhaseFunc phase_sse[] = { ResamplePhase_SSE_Low, ResamplePhase_SSE_Medium, ResamplePhase_SSE_High };
+
+            for (i = 0; i < 8; ++i) {
+                sinc->frame[i] = frame_sse[s];
+                sinc->phase[i] = phase_sse[s];
+            }
+            transpose = 4;
+
+#ifdef SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2() && (samples_per_frame % 8) == 0) {
+                for (i = 0; i < 8; ++i) {
+                    sinc->frame[i] = (s == 0) ? ResampleFrame_AVX2_Low : ResampleFrame_AVX2_High;
+                    sinc->phase[i] = (s == 0) ? ResamplePhase_AVX2_Low : ResamplePhase_AVX2_High;
+                }
+                transpose = 8;
+            }
+#endif
+        } else
 #endif
 #ifdef SDL_NEON_INTRINSICS
-    if (SDL_HasNEON()) {
-        for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic_NEON;
-        }
-        transpose = true;
-    } else
+        if (SDL_HasNEON()) {
+            static const ResampleFrameFunc frame_neon[] = { ResampleFrame_NEON_Low, ResampleFrame_NEON_Medium, ResampleFrame_NEON_High };
+            static const ResamplePhaseFunc phase_neon[] = { ResamplePhase_NEON_Low, ResamplePhase_NEON_Medium, ResamplePhase_NEON_High };
+
+            for (i = 0; i < 8; ++i) {
+                sinc->frame[i] = frame_neon[s];
+                sinc->phase[i] = phase_neon[s];
+            }
+            transpose = 4;
+        } else
 #endif
-    {
-        for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic;
-        }
+        {
+            for (i = 0; i < 8; ++i) {
+                sinc->frame[i] = ResampleFrame_Generic;
+                sinc->phase[i] = ResamplePhase_Generic;
+            }
 
-        ResampleFrame[0] = ResampleFrame_Mono;
-        ResampleFrame[1] = ResampleFrame_Stereo;
-    }
+            sinc->frame[0] = ResampleFrame_Mono;
+            sinc->frame[1] = ResampleFrame_Stereo;
+        }
 
-    if (transpose) {
-        // Transpose each set of 4 coefficients, to reduce work when resampling
-        for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
-            for (j = 0; j + 4 <= RESAMPLER_SAMPLES_PER_FRAME; j += 4) {
-                Transpose4x4(&ResamplerFilter[i][j]);
+        if (transpose) {
+            // Transpose each set of coefficients, to reduce work when resampling
+            for (i = 0; i < rows; ++i) {
+                for (j = 0; j + transpose <= samples_per_frame; j += transpose) {
+                    TransposeCubics(&sinc->filter[i * samples_per_frame + j], transpose);
+                }
             }
         }
     }
@@ -607,17 +817,33 @@ Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
 int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
+    // The quality can change at any time, so this is enough for the longest filter.
 
     return RESAMPLER_MAX_PADDING_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
-}
+    if (!resample_rate) {
+        return 0;
+    }
 
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_NEAREST:
+    case SDL_AUDIO_RESAMPLE_LINEAR:
+        return 1;
+    case SDL_AUDIO_RESAMPLE_CUBIC:
+        return 2;
+    case SDL_AUDIO_RESAMPLE_SINC_LOW:
+    case SDL_AUDIO_RESAMPLE_SINC_MEDIUM:
+    case SDL_AUDIO_RESAMPLE_SINC_HIGH:
+        return RESAMPLER_PADDING_FRAMES(ResamplerSincs[quality - SDL_AUDIO_RESAMPLE_SINC_LOW].zero_crossings);
+    }
+
+    return RESAMPLER_MAX_PADDING_FRAMES;
+}
 // These are not general purpose. They do not check for all possible underflow/overflow
 SDL_FORCE_INLINE bool ResamplerAdd(Sint64 a, Sint64 b, Sint64 *ret)
 {
@@ -675,31 +901,128 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
+// The plain interpolations read the frames around the position directly, and return the position after the last output frame.
+static Sint64 ResampleNearest(int chans, const float *src, float *dst, int outframes, Sint64 resample_rate, Sint64 srcpos)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)((srcpos + 0x80000000) >> 32) * chans];
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = frame[chan];
+        }
+    }
+
+    return srcpos;
+}
+
+static Sint64 ResampleLinear(int chans, const float *src, float *dst, int outframes, Sint64 resample_rate, Sint64 srcpos)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = frame[chan] + (frame[chans + chan] - frame[chan]) * frac;
+        }
+    }
+
+    return srcpos;
+}
+
+static Sint64 ResampleCubic(int chans, const float *src, float *dst, int outframes, Sint64 resample_rate, Sint64 srcpos)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+
+        // Catmull-Rom spline through the two frames on each side
+        for (chan = 0; chan < chans; ++chan) {
+            const float y0 = frame[chan - chans];
+            const float y1 = frame[chan];
+            const float y2 = frame[chan + chans];
+            const float y3 = frame[chan + chans * 2];
+            const float a = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+            const float b = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+            const float c = 0.5f * (y2 - y0);
+
+            dst[chan] = ((a * frac + b) * frac + c) * frac + y1;
+        }
+    }
+
+    return srcpos;
+}
+
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality)
 {
     int i;
     Sint64 srcpos = *inout_resample_offset;
-    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
 
     SDL_assert(resample_rate > 0);
 
-    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_NEAREST:
+        srcpos = ResampleNearest(chans, src, dst, outframes, resample_rate, srcpos);
+        break;
+    case SDL_AUDIO_RESAMPLE_LINEAR:
+        srcpos = ResampleLinear(chans, src, dst, outframes, resample_rate, srcpos);
+        break;
+    case SDL_AUDIO_RESAMPLE_CUBIC:
+        srcpos = ResampleCubic(chans, src, dst, outframes, resample_rate, srcpos);
+        break;
+    default:
+    {
+        const ResamplerSinc *sinc = &ResamplerSincs[quality - SDL_AUDIO_RESAMPLE_SINC_LOW];
+        const int samples_per_frame = sinc->zero_crossings * 2;
+        const int interp_bits = 32 - sinc->bits_per_zero_crossing;
+        const Sint64 interp_mask = ((Sint64)1 << interp_bits) - 1;
+
+        src -= (sinc->zero_crossings - 1) * chans;
+
+        if (((resample_rate | srcpos) & interp_mask) == 0) {
+            // Every position falls exactly on a point of the filter table, like
+            // when doubling the rate. Use the filter phases as they are.
+            const ResamplePhaseFunc resample_phase = sinc->phase[chans - 1];
+
+            for (i = 0; i < outframes; ++i) {
+                const int srcindex = (int)(Sint32)(srcpos >> 32);
+                const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+                srcpos += resample_rate;
+
+                SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+                resample_phase(&src[srcindex * chans], dst, &sinc->phases[(srcfraction >> interp_bits) * samples_per_frame], chans, samples_per_frame);
 
-    for (i = 0; i < outframes; ++i) {
-        int srcindex = (int)(Sint32)(srcpos >> 32);
-        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
-        srcpos += resample_rate;
+                dst += chans;
+            }
+        } else {
+            const ResampleFrameFunc resample_frame = sinc->frame[chans - 1];
+            const float interp_scale = 1.0f / (float)((Sint64)1 << interp_bits);
+
+            for (i = 0; i < outframes; ++i) {
+                const int srcindex = (int)(Sint32)(srcpos >> 32);
+                const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+                srcpos += resample_rate;
 
-        SDL_assert(srcindex >= -1 && srcindex < inframes);
+                SDL_assert(srcindex >= -1 && srcindex < inframes);
 
-        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
-        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+                const Cubic *filter = &sinc->filter[(srcfraction >> interp_bits) * samples_per_frame];
+                const float frac = (float)(srcfraction & interp_mask) * interp_scale;
 
-        const float *frame = &src[srcindex * chans];
-        resample_frame(frame, dst, filter, frac, chans);
+                const float *frame = &src[srcindex * chans];
+                resample_frame(frame, dst, filter, frac, chans, samples_per_frame);
 
-        dst += chans;
+                dst += chans;
+            }
+        }
+        break;
+    }
     }
 
     *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
@@ -110,6 +110,16 @@ extern bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device);
 extern void SDL_RecordingAudioThreadShutdown(SDL_AudioDevice *device);
 extern void SDL_AudioThreadFinalize(SDL_AudioDevice *device);
 
+// How the dummy and disk drivers keep time, from SDL_HINT_AUDIO_OFFLINE_CLOCK.
+typedef enum SDL_AudioOfflineClock
+{
+    SDL_AUDIO_OFFLINE_CLOCK_REALTIME,
+    SDL_AUDIO_OFFLINE_CLOCK_FAST,
+    SDL_AUDIO_OFFLINE_CLOCK_MANUAL
+} SDL_AudioOfflineClock;
+
+extern SDL_AudioOfflineClock SDL_GetAudioOfflineClock(void);
+
 extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt);
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bitsize);
@@ -165,6 +175,7 @@ typedef struct SDL_AudioDriverImpl
 
     // Some flags to push duplicate code into the core and reduce #ifdefs.
     bool ProvidesOwnCallbackThread;  // !!! FIXME: rename this, it's not a callback thread anymore.
+    bool SteppedByApp;  // there's no device thread at all, devices only run from SDL_StepAudioDevice. Requires ProvidesOwnCallbackThread.
     bool HasRecordingSupport;
     bool OnlyHasDefaultPlaybackDevice;
     bool OnlyHasDefaultRecordingDevice;   // !!! FIXME: is there ever a time where you'd have a default playback and not a default recording (or vice versa)?
@@ -223,10 +234,19 @@ struct SDL_AudioStream
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
     Sint64 resample_offset;
+    SDL_AudioResampleQuality resample_quality;  // from SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, updated when reading data
 
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
+    // Optional lock-free input for a single producer thread (see SDL_SetAudioStreamSingleProducer).
+    // Only the producer advances `ring_head`, and `ring_tail` is only advanced with `lock` held.
+    Uint8 *ring;
+    Uint32 ring_frames;       // a power of two
+    int ring_frame_size;      // the input format can't change while the ring is in use.
+    SDL_AtomicU32 ring_head;  // total frames written
+    SDL_AtomicU32 ring_tail;  // total frames moved into `queue`
+
     bool simplified;  // true if created via SDL_OpenAudioDeviceStream
 
     SDL_LogicalAudioDevice *bound_device;
@@ -325,6 +345,9 @@ struct SDL_AudioDevice
     // Number of sample frames the devices wants per-buffer.
     int sample_frames;
 
+    // Sample frames SDL_StepAudioDevice was asked for that don't fill a whole buffer yet.
+    int stepped_frames;
+
     // Value to use for SDL_memset to silence a buffer in this device's format
     int silence_value;
 
@@ -491,15 +491,16 @@ static bool MS_ADPCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+static const Uint16 ms_adpcm_adaptive[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230
+};
+
 static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sample1, Sint32 sample2, Uint8 nybble)
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
     const Uint16 max_deltaval = 65535;
-    const Uint16 adaptive[] = {
-        230, 230, 230, 230, 307, 409, 512, 614,
-        768, 614, 512, 409, 307, 230, 230, 230
-    };
     Sint32 new_sample;
     Sint32 errordelta;
     Uint32 delta = cstate->delta;
@@ -513,7 +514,7 @@ static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sampl
     } else if (new_sample > max_audioval) {
         new_sample = max_audioval;
     }
-    delta = (delta * adaptive[nybble]) / 256;
+    delta = (delta * ms_adpcm_adaptive[nybble]) / 256;
     if (delta < 16) {
         delta = 16;
     } else if (delta > max_deltaval) {
@@ -634,6 +635,168 @@ static bool MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return true;
 }
 
+/* Complete MS ADPCM blocks don't depend on each other, and neither do the
+ * channels in a block. The SIMD decoders below run four of these streams side
+ * by side, one in each vector lane. The block headers are still decoded one by
+ * one; the lanes start with two sample frames already in the output.
+ */
+typedef void (*MS_ADPCM_DecodeLanesFunc)(const Uint8 *const *data, const size_t *nibble, Sint16 *const *output, const MS_ADPCM_ChannelState *cstate, size_t frames, size_t channels);
+
+static MS_ADPCM_DecodeLanesFunc MS_ADPCM_DecodeLanes = NULL;
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_TARGETING("sse4.1") MS_ADPCM_DecodeLanes_SSE41(const Uint8 *const *data, const size_t *nibble, Sint16 *const *output, const MS_ADPCM_ChannelState *cstate, size_t frames, size_t channels)
+{
+    const __m128i rounding = _mm_set1_epi32(255);
+    const __m128i signbit = _mm_set1_epi32(8);
+    const __m128i min_audioval = _mm_set1_epi32(-32768);
+    const __m128i max_audioval = _mm_set1_epi32(32767);
+    const __m128i min_deltaval = _mm_set1_epi32(16);
+    const __m128i max_deltaval = _mm_set1_epi32(65535);
+    const __m128i coeff1 = _mm_setr_epi32(cstate[0].coeff1, cstate[1].coeff1, cstate[2].coeff1, cstate[3].coeff1);
+    const __m128i coeff2 = _mm_setr_epi32(cstate[0].coeff2, cstate[1].coeff2, cstate[2].coeff2, cstate[3].coeff2);
+    __m128i delta = _mm_setr_epi32(cstate[0].delta, cstate[1].delta, cstate[2].delta, cstate[3].delta);
+    __m128i sample1 = _mm_setr_epi32(output[0][channels], output[1][channels], output[2][channels], output[3][channels]);
+    __m128i sample2 = _mm_setr_epi32(output[0][0], output[1][0], output[2][0], output[3][0]);
+    size_t f, pos = 0, outpos = channels * 2;
+
+    for (f = 2; f < frames; f++, pos += channels, outpos += channels) {
+        const size_t n0 = nibble[0] + pos, n1 = nibble[1] + pos, n2 = nibble[2] + pos, n3 = nibble[3] + pos;
+        const Uint8 nybble0 = (data[0][n0 >> 1] >> ((~n0 & 1) << 2)) & 0x0f;
+        const Uint8 nybble1 = (data[1][n1 >> 1] >> ((~n1 & 1) << 2)) & 0x0f;
+        const Uint8 nybble2 = (data[2][n2 >> 1] >> ((~n2 & 1) << 2)) & 0x0f;
+        const Uint8 nybble3 = (data[3][n3 >> 1] >> ((~n3 & 1) << 2)) & 0x0f;
+        const __m128i nybbles = _mm_setr_epi32(nybble0, nybble1, nybble2, nybble3);
+        const __m128i adaptive = _mm_setr_epi32(ms_adpcm_adaptive[nybble0], ms_adpcm_adaptive[nybble1], ms_adpcm_adaptive[nybble2], ms_adpcm_adaptive[nybble3]);
+        // The nibble is a signed 4-bit error delta.
+        const __m128i errordelta = _mm_sub_epi32(_mm_xor_si128(nybbles, signbit), signbit);
+        __m128i new_sample = _mm_add_epi32(_mm_mullo_epi32(sample1, coeff1), _mm_mullo_epi32(sample2, coeff2));
+        Sint16 samples[8] SDL_ALIGNED(16);
+
+        // Division by 256 that rounds towards zero, like the scalar decoder.
+        new_sample = _mm_srai_epi32(_mm_add_epi32(new_sample, _mm_and_si128(_mm_srai_epi32(new_sample, 31), rounding)), 8);
+        new_sample = _mm_add_epi32(new_sample, _mm_mullo_epi32(delta, errordelta));
+        new_sample = _mm_min_epi32(_mm_max_epi32(new_sample, min_audioval), max_audioval);
+
+        delta = _mm_srli_epi32(_mm_mullo_epi32(delta, adaptive), 8);
+        delta = _mm_min_epi32(_mm_max_epi32(delta, min_deltaval), max_deltaval);
+
+        sample2 = sample1;
+        sample1 = new_sample;
+
+        _mm_store_si128((__m128i *)samples, _mm_packs_epi32(new_sample, new_sample));
+        output[0][outpos] = samples[0];
+        output[1][outpos] = samples[1];
+        output[2][outpos] = samples[2];
+        output[3][outpos] = samples[3];
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void MS_ADPCM_DecodeLanes_NEON(const Uint8 *const *data, const size_t *nibble, Sint16 *const *output, const MS_ADPCM_ChannelState *cstate, size_t frames, size_t channels)
+{
+    const int32x4_t rounding = vdupq_n_s32(255);
+    const int32x4_t signbit = vdupq_n_s32(8);
+    const int32x4_t min_audioval = vdupq_n_s32(-32768);
+    const int32x4_t max_audioval = vdupq_n_s32(32767);
+    const int32x4_t min_deltaval = vdupq_n_s32(16);
+    const int32x4_t max_deltaval = vdupq_n_s32(65535);
+    const Sint32 c1[4] = { cstate[0].coeff1, cstate[1].coeff1, cstate[2].coeff1, cstate[3].coeff1 };
+    const Sint32 c2[4] = { cstate[0].coeff2, cstate[1].coeff2, cstate[2].coeff2, cstate[3].coeff2 };
+    const Sint32 d[4] = { cstate[0].delta, cstate[1].delta, cstate[2].delta, cstate[3].delta };
+    const Sint32 s1[4] = { output[0][channels], output[1][channels], output[2][channels], output[3][channels] };
+    const Sint32 s2[4] = { output[0][0], output[1][0], output[2][0], output[3][0] };
+    const int32x4_t coeff1 = vld1q_s32(c1);
+    const int32x4_t coeff2 = vld1q_s32(c2);
+    int32x4_t delta = vld1q_s32(d);
+    int32x4_t sample1 = vld1q_s32(s1);
+    int32x4_t sample2 = vld1q_s32(s2);
+    size_t f, pos = 0, outpos = channels * 2;
+
+    for (f = 2; f < frames; f++, pos += channels, outpos += channels) {
+        const size_t n0 = nibble[0] + pos, n1 = nibble[1] + pos, n2 = nibble[2] + pos, n3 = nibble[3] + pos;
+        const Sint32 nybble[4] = {
+            (data[0][n0 >> 1] >> ((~n0 & 1) << 2)) & 0x0f,
+            (data[1][n1 >> 1] >> ((~n1 & 1) << 2)) & 0x0f,
+            (data[2][n2 >> 1] >> ((~n2 & 1) << 2)) & 0x0f,
+            (data[3][n3 >> 1] >> ((~n3 & 1) << 2)) & 0x0f
+        };
+        const Sint32 adapt[4] = {
+            ms_adpcm_adaptive[nybble[0]], ms_adpcm_adaptive[nybble[1]], ms_adpcm_adaptive[nybble[2]], ms_adpcm_adaptive[nybble[3]]
+        };
+        // The nibble is a signed 4-bit error delta.
+        const int32x4_t errordelta = vsubq_s32(veorq_s32(vld1q_s32(nybble), signbit), signbit);
+        int32x4_t new_sample = vmlaq_s32(vmulq_s32(sample1, coeff1), sample2, coeff2);
+        int16x4_t samples;
+
+        // Division by 256 that rounds towards zero, like the scalar decoder.
+        new_sample = vshrq_n_s32(vaddq_s32(new_sample, vandq_s32(vshrq_n_s32(new_sample, 31), rounding)), 8);
+        new_sample = vmlaq_s32(new_sample, delta, errordelta);
+        new_sample = vminq_s32(vmaxq_s32(new_sample, min_audioval), max_audioval);
+
+        delta = vshrq_n_s32(vmulq_s32(delta, vld1q_s32(adapt)), 8);
+        delta = vminq_s32(vmaxq_s32(delta, min_deltaval), max_deltaval);
+
+        sample2 = sample1;
+        sample1 = new_sample;
+
+        samples = vmovn_s32(new_sample);
+        output[0][outpos] = vget_lane_s16(samples, 0);
+        output[1][outpos] = vget_lane_s16(samples, 1);
+        output[2][outpos] = vget_lane_s16(samples, 2);
+        output[3][outpos] = vget_lane_s16(samples, 3);
+    }
+}
+#endif
+
+/* Decodes runs of complete blocks with MS_ADPCM_DecodeLanes, four streams at a
+ * time. Stops before anything that needs the careful handling of the block by
+ * block decoder, like truncated blocks or the end of the data.
+ */
+static bool MS_ADPCM_DecodeBlocksInLanes(ADPCM_DecoderState *state)
+{
+    const size_t channels = state->channels;
+    const size_t batchblocks = 4;
+    const size_t batchframes = batchblocks * state->samplesperblock;
+
+    while (state->framesleft >= (Sint64)batchframes && state->input.size - state->input.pos >= batchblocks * state->blocksize) {
+        const Uint8 *data[4];
+        size_t nibble[4];
+        Sint16 *output[4];
+        MS_ADPCM_ChannelState cstate[4];
+        size_t b, lane = 0;
+
+        for (b = 0; b < batchblocks; b++) {
+            size_t c;
+
+            state->block.data = state->input.data + state->input.pos + b * state->blocksize;
+            state->block.size = state->blocksize;
+            state->block.pos = 0;
+            state->cstate = cstate + lane;
+            if (!MS_ADPCM_DecodeBlockHeader(state)) {
+                return false;
+            }
+
+            for (c = 0; c < channels; c++) {
+                data[lane] = state->block.data + state->blockheadersize;
+                nibble[lane] = c;
+                output[lane] = state->output.data + state->output.pos - channels * 2 + c;
+                if (++lane == 4) {
+                    MS_ADPCM_DecodeLanes(data, nibble, output, cstate, state->samplesperblock, channels);
+                    lane = 0;
+                }
+            }
+            state->output.pos += (state->samplesperblock - 2) * channels;
+            state->framesleft -= state->samplesperblock - 2;
+        }
+
+        state->input.pos += batchblocks * state->blocksize;
+    }
+
+    return true;
+}
+
 static bool MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     bool result;
@@ -687,9 +850,17 @@ static bool MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len
         return false;
     }
 
+    // Most of the blocks can be decoded in parallel, if the CPU can do that.
+    if (MS_ADPCM_DecodeLanes) {
+        if (!MS_ADPCM_DecodeBlocksInLanes(&state)) {
+            SDL_free(state.output.data);
+            return false;
+        }
+    }
+
     state.cstate = cstate;
 
-    // Decode block by block. A truncated block will stop the decoding.
+    // Decode the rest block by block. A truncated block will stop the decoding.
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
         state.block.data = state.input.data + state.input.pos;
@@ -851,26 +1022,28 @@ static bool IMA_ADPCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+static const Sint8 ima_adpcm_index_table[16] = {
+    -1, -1, -1, -1,
+    2, 4, 6, 8,
+    -1, -1, -1, -1,
+    2, 4, 6, 8
+};
+
+static const Uint16 ima_adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+    143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+    1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767
+};
+
 static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 nybble)
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
-    const Sint8 index_table_4b[16] = {
-        -1, -1, -1, -1,
-        2, 4, 6, 8,
-        -1, -1, -1, -1,
-        2, 4, 6, 8
-    };
-    const Uint16 step_table[89] = {
-        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
-        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
-        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
-        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
-        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
-        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
-        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
-        22385, 24623, 27086, 29794, 32767
-    };
     Uint32 step;
     Sint32 sample, delta;
     Sint8 index = *cindex;
@@ -883,10 +1056,10 @@ static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 ny
     }
 
     // explicit cast to avoid gcc warning about using 'char' as array index
-    step = step_table[(size_t)index];
+    step = ima_adpcm_step_table[(size_t)index];
 
     // Update index value
-    *cindex = index + index_table_4b[nybble];
+    *cindex = index + ima_adpcm_index_table[nybble];
 
     /* This calculation uses shifts and additions because multiplications were
      * much slower back then. Sadly, this can't just be replaced with an actual
@@ -1028,6 +1201,198 @@ static bool IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return result;
 }
 
+/* Like MS ADPCM, IMA ADPCM blocks and the channels in them are independent
+ * streams. The SIMD decoders run four of them side by side, one in each
+ * vector lane. Each lane starts with the sample frame from the block header in
+ * the output and reads the 32-bit words with its nibbles from the sub-blocks.
+ */
+typedef void (*IMA_ADPCM_DecodeLanesFunc)(const Uint8 *const *data, Sint16 *const *output, const Sint8 *cindex, size_t subblocks, size_t channels);
+
+static IMA_ADPCM_DecodeLanesFunc IMA_ADPCM_DecodeLanes = NULL;
+
+#define IMA_ADPCM_SUBBLOCK_WORD(data, pos) \
+    ((Sint32)((Uint32)(data)[pos] | ((Uint32)(data)[(pos) + 1] << 8) | ((Uint32)(data)[(pos) + 2] << 16) | ((Uint32)(data)[(pos) + 3] << 24)))
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") IMA_ADPCM_DecodeLanes_SSE2(const Uint8 *const *data, Sint16 *const *output, const Sint8 *cindex, size_t subblocks, size_t channels)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i three = _mm_set1_epi32(3);
+    const __m128i four = _mm_set1_epi32(4);
+    const __m128i eight = _mm_set1_epi32(8);
+    const __m128i fifteen = _mm_set1_epi32(15);
+    const __m128i max_index = _mm_set1_epi32(88);
+    __m128i sample = _mm_setr_epi32(output[0][0], output[1][0], output[2][0], output[3][0]);
+    __m128i index = _mm_setr_epi32(cindex[0], cindex[1], cindex[2], cindex[3]);
+    size_t s, i, inpos = 0, outpos = channels;
+
+    // Clamp index into valid range.
+    index = _mm_min_epi16(_mm_max_epi16(index, zero), max_index);
+
+    for (s = 0; s < subblocks; s++, inpos += channels * 4) {
+        __m128i nybbles = _mm_setr_epi32(IMA_ADPCM_SUBBLOCK_WORD(data[0], inpos), IMA_ADPCM_SUBBLOCK_WORD(data[1], inpos),
+                                         IMA_ADPCM_SUBBLOCK_WORD(data[2], inpos), IMA_ADPCM_SUBBLOCK_WORD(data[3], inpos));
+
+        for (i = 0; i < 8; i++, outpos += channels) {
+            const __m128i nybble = _mm_and_si128(nybbles, fifteen);
+            const __m128i bit4 = _mm_cmpeq_epi32(_mm_and_si128(nybble, four), four);
+            const __m128i bit2 = _mm_cmpeq_epi32(_mm_and_si128(nybble, two), two);
+            const __m128i bit1 = _mm_cmpeq_epi32(_mm_and_si128(nybble, one), one);
+            const __m128i bit8 = _mm_cmpeq_epi32(_mm_and_si128(nybble, eight), eight);
+            Sint32 lanes[4] SDL_ALIGNED(16);
+            Sint16 samples[8] SDL_ALIGNED(16);
+            __m128i step, delta, packed;
+
+            _mm_store_si128((__m128i *)lanes, index);
+            step = _mm_setr_epi32(ima_adpcm_step_table[lanes[0]], ima_adpcm_step_table[lanes[1]],
+                                  ima_adpcm_step_table[lanes[2]], ima_adpcm_step_table[lanes[3]]);
+
+            // Same shifts and additions as IMA_ADPCM_ProcessNibble.
+            delta = _mm_srli_epi32(step, 3);
+            delta = _mm_add_epi32(delta, _mm_and_si128(bit4, step));
+            delta = _mm_add_epi32(delta, _mm_and_si128(bit2, _mm_srli_epi32(step, 1)));
+            delta = _mm_add_epi32(delta, _mm_and_si128(bit1, _mm_srli_epi32(step, 2)));
+            delta = _mm_sub_epi32(_mm_xor_si128(delta, bit8), bit8);
+
+            // The index moves down by one or up by 2, 4, 6, or 8.
+            index = _mm_add_epi32(index, _mm_or_si128(_mm_and_si128(bit4, _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(nybble, three), 1), two)),
+                                                      _mm_andnot_si128(bit4, _mm_set1_epi32(-1))));
+            index = _mm_min_epi16(_mm_max_epi16(index, zero), max_index);
+
+            // Saturating to 16 bits clamps the output sample.
+            packed = _mm_packs_epi32(_mm_add_epi32(sample, delta), zero);
+            sample = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+
+            _mm_store_si128((__m128i *)samples, packed);
+            output[0][outpos] = samples[0];
+            output[1][outpos] = samples[1];
+            output[2][outpos] = samples[2];
+            output[3][outpos] = samples[3];
+
+            nybbles = _mm_srli_epi32(nybbles, 4);
+        }
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void IMA_ADPCM_DecodeLanes_NEON(const Uint8 *const *data, Sint16 *const *output, const Sint8 *cindex, size_t subblocks, size_t channels)
+{
+    const int32x4_t zero = vdupq_n_s32(0);
+    const int32x4_t fifteen = vdupq_n_s32(15);
+    const int32x4_t max_index = vdupq_n_s32(88);
+    const Sint32 first[4] = { output[0][0], output[1][0], output[2][0], output[3][0] };
+    const Sint32 firstindex[4] = { cindex[0], cindex[1], cindex[2], cindex[3] };
+    int32x4_t sample = vld1q_s32(first);
+    int32x4_t index = vld1q_s32(firstindex);
+    size_t s, i, inpos = 0, outpos = channels;
+
+    // Clamp index into valid range.
+    index = vminq_s32(vmaxq_s32(index, zero), max_index);
+
+    for (s = 0; s < subblocks; s++, inpos += channels * 4) {
+        const Sint32 words[4] = {
+            IMA_ADPCM_SUBBLOCK_WORD(data[0], inpos), IMA_ADPCM_SUBBLOCK_WORD(data[1], inpos),
+            IMA_ADPCM_SUBBLOCK_WORD(data[2], inpos), IMA_ADPCM_SUBBLOCK_WORD(data[3], inpos)
+        };
+        uint32x4_t nybbles = vreinterpretq_u32_s32(vld1q_s32(words));
+
+        for (i = 0; i < 8; i++, outpos += channels) {
+            const int32x4_t nybble = vreinterpretq_s32_u32(vandq_u32(nybbles, vreinterpretq_u32_s32(fifteen)));
+            const int32x4_t bit4 = vreinterpretq_s32_u32(vtstq_s32(nybble, vdupq_n_s32(4)));
+            const int32x4_t bit2 = vreinterpretq_s32_u32(vtstq_s32(nybble, vdupq_n_s32(2)));
+            const int32x4_t bit1 = vreinterpretq_s32_u32(vtstq_s32(nybble, vdupq_n_s32(1)));
+            const int32x4_t bit8 = vreinterpretq_s32_u32(vtstq_s32(nybble, vdupq_n_s32(8)));
+            Sint32 lanes[4];
+            Sint32 steps[4];
+            int32x4_t step, delta;
+            int16x4_t samples;
+
+            vst1q_s32(lanes, index);
+            steps[0] = ima_adpcm_step_table[lanes[0]];
+            steps[1] = ima_adpcm_step_table[lanes[1]];
+            steps[2] = ima_adpcm_step_table[lanes[2]];
+            steps[3] = ima_adpcm_step_table[lanes[3]];
+            step = vld1q_s32(steps);
+
+            // Same shifts and additions as IMA_ADPCM_ProcessNibble.
+            delta = vshrq_n_s32(step, 3);
+            delta = vaddq_s32(delta, vandq_s32(bit4, step));
+            delta = vaddq_s32(delta, vandq_s32(bit2, vshrq_n_s32(step, 1)));
+            delta = vaddq_s32(delta, vandq_s32(bit1, vshrq_n_s32(step, 2)));
+            delta = vsubq_s32(veorq_s32(delta, bit8), bit8);
+
+            // The index moves down by one or up by 2, 4, 6, or 8.
+            index = vaddq_s32(index, vbslq_s32(vreinterpretq_u32_s32(bit4),
+                                               vaddq_s32(vshlq_n_s32(vandq_s32(nybble, vdupq_n_s32(3)), 1), vdupq_n_s32(2)),
+                                               vdupq_n_s32(-1)));
+            index = vminq_s32(vmaxq_s32(index, zero), max_index);
+
+            // Saturating to 16 bits clamps the output sample.
+            samples = vqmovn_s32(vaddq_s32(sample, delta));
+            sample = vmovl_s16(samples);
+
+            output[0][outpos] = vget_lane_s16(samples, 0);
+            output[1][outpos] = vget_lane_s16(samples, 1);
+            output[2][outpos] = vget_lane_s16(samples, 2);
+            output[3][outpos] = vget_lane_s16(samples, 3);
+
+            nybbles = vshrq_n_u32(nybbles, 4);
+        }
+    }
+}
+#endif
+
+/* Decodes runs of complete blocks with IMA_ADPCM_DecodeLanes, four streams at
+ * a time. Only used if the blocks are made of whole sub-blocks. Stops before
+ * anything that needs the careful handling of the block by block decoder, like
+ * truncated blocks or the end of the data.
+ */
+static void IMA_ADPCM_DecodeBlocksInLanes(ADPCM_DecoderState *state)
+{
+    const size_t channels = state->channels;
+    const size_t batchblocks = 4;
+    const size_t batchframes = batchblocks * state->samplesperblock;
+    const size_t subblocks = (state->samplesperblock - 1) / 8;
+    Sint8 *cstate = (Sint8 *)state->cstate;
+
+    if ((state->samplesperblock - 1) % 8 != 0) {
+        return;
+    }
+
+    while (state->framesleft >= (Sint64)batchframes && state->input.size - state->input.pos >= batchblocks * state->blocksize) {
+        const Uint8 *data[4];
+        Sint16 *output[4];
+        Sint8 cindex[4];
+        size_t b, lane = 0;
+
+        for (b = 0; b < batchblocks; b++) {
+            size_t c;
+
+            state->block.data = state->input.data + state->input.pos + b * state->blocksize;
+            state->block.size = state->blocksize;
+            state->block.pos = 0;
+            IMA_ADPCM_DecodeBlockHeader(state);
+
+            for (c = 0; c < channels; c++) {
+                data[lane] = state->block.data + state->blockheadersize + c * 4;
+                output[lane] = state->output.data + state->output.pos - channels + c;
+                cindex[lane] = cstate[c];
+                if (++lane == 4) {
+                    IMA_ADPCM_DecodeLanes(data, output, cindex, subblocks, channels);
+                    lane = 0;
+                }
+            }
+            state->output.pos += (state->samplesperblock - 1) * channels;
+            state->framesleft -= state->samplesperblock - 1;
+        }
+
+        state->input.pos += batchblocks * state->blocksize;
+    }
+}
+
 static bool IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     bool result;
@@ -1085,7 +1450,12 @@ static bool IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_le
     }
     state.cstate = cstate;
 
-    // Decode block by block. A truncated block will stop the decoding.
+    // Most of the blocks can be decoded in parallel, if the CPU can do that.
+    if (IMA_ADPCM_DecodeLanes) {
+        IMA_ADPCM_DecodeBlocksInLanes(&state);
+    }
+
+    // Decode the rest block by block. A truncated block will stop the decoding.
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
         state.block.data = state.input.data + state.input.pos;
@@ -1159,7 +1529,114 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* The SIMD versions of the A-law and mu-law expansion below compute the same
+ * thing as the scalar code in LAW_DecodeSamples, 16 samples at a time. They
+ * also work backwards through the data and return the number of samples at
+ * the start that are left for the scalar code.
+ */
+typedef size_t (*LAW_DecodeLanesFunc)(Uint16 encoding, Uint8 *data, size_t sample_count);
+
+static LAW_DecodeLanesFunc LAW_DecodeLanes = NULL;
+
+#ifdef SDL_SSE2_INTRINSICS
+// Returns 1 << exponent for exponents from 0 to 7.
+static __m128i SDL_TARGETING("sse2") LAW_Pow2_SSE2(__m128i exponent)
+{
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i two = _mm_set1_epi16(2);
+    const __m128i four = _mm_set1_epi16(4);
+    __m128i result = _mm_add_epi16(one, _mm_and_si128(exponent, one));
+    result = _mm_mullo_epi16(result, _mm_add_epi16(one, _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(exponent, two), two), _mm_set1_epi16(3))));
+    result = _mm_mullo_epi16(result, _mm_add_epi16(one, _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(exponent, four), four), _mm_set1_epi16(15))));
+    return result;
+}
+
+static __m128i SDL_TARGETING("sse2") LAW_Expand_SSE2(Uint16 encoding, __m128i nibble)
+{
+    __m128i exponent, mantissa, negative;
+
+    if (encoding == ALAW_CODE) {
+        const __m128i byte = _mm_xor_si128(_mm_and_si128(nibble, _mm_set1_epi16(0x7f)), _mm_set1_epi16(0x55));
+        exponent = _mm_srli_epi16(byte, 4);
+        mantissa = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(byte, _mm_set1_epi16(0xf)), 4), _mm_set1_epi16(0x8));
+        mantissa = _mm_add_epi16(mantissa, _mm_and_si128(_mm_cmpgt_epi16(exponent, _mm_setzero_si128()), _mm_set1_epi16(0x100)));
+        mantissa = _mm_mullo_epi16(mantissa, LAW_Pow2_SSE2(_mm_subs_epu16(exponent, _mm_set1_epi16(1))));
+        negative = _mm_cmpeq_epi16(_mm_and_si128(nibble, _mm_set1_epi16(0x80)), _mm_setzero_si128());
+    } else {
+        nibble = _mm_xor_si128(nibble, _mm_set1_epi16(0xff));
+        exponent = _mm_and_si128(_mm_srli_epi16(nibble, 4), _mm_set1_epi16(0x7));
+        mantissa = _mm_add_epi16(_mm_slli_epi16(_mm_and_si128(nibble, _mm_set1_epi16(0xf)), 3), _mm_set1_epi16(0x84));
+        mantissa = _mm_sub_epi16(_mm_mullo_epi16(mantissa, LAW_Pow2_SSE2(exponent)), _mm_set1_epi16(0x84));
+        negative = _mm_cmpeq_epi16(_mm_and_si128(nibble, _mm_set1_epi16(0x80)), _mm_set1_epi16(0x80));
+    }
+
+    return _mm_sub_epi16(_mm_xor_si128(mantissa, negative), negative);
+}
+
+static size_t SDL_TARGETING("sse2") LAW_DecodeLanes_SSE2(Uint16 encoding, Uint8 *data, size_t sample_count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = sample_count;
+
+    // The stores never reach the bytes that are still to be loaded.
+    while (i >= 16) {
+        __m128i bytes;
+        i -= 16;
+        bytes = _mm_loadu_si128((const __m128i *)(data + i));
+        _mm_storeu_si128((__m128i *)(data + i * 2 + 16), LAW_Expand_SSE2(encoding, _mm_unpackhi_epi8(bytes, zero)));
+        _mm_storeu_si128((__m128i *)(data + i * 2), LAW_Expand_SSE2(encoding, _mm_unpacklo_epi8(bytes, zero)));
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static int16x8_t LAW_Expand_NEON(Uint16 encoding, int16x8_t nibble)
+{
+    int16x8_t mantissa;
+    uint16x8_t negative;
+
+    if (encoding == ALAW_CODE) {
+        const int16x8_t byte = veorq_s16(vandq_s16(nibble, vdupq_n_s16(0x7f)), vdupq_n_s16(0x55));
+        const int16x8_t exponent = vshrq_n_s16(byte, 4);
+        mantissa = vorrq_s16(vshlq_n_s16(vandq_s16(byte, vdupq_n_s16(0xf)), 4), vdupq_n_s16(0x8));
+        mantissa = vaddq_s16(mantissa, vandq_s16(vreinterpretq_s16_u16(vcgtq_s16(exponent, vdupq_n_s16(0))), vdupq_n_s16(0x100)));
+        mantissa = vshlq_s16(mantissa, vreinterpretq_s16_u16(vqsubq_u16(vreinterpretq_u16_s16(exponent), vdupq_n_u16(1))));
+        negative = vceqq_s16(vandq_s16(nibble, vdupq_n_s16(0x80)), vdupq_n_s16(0));
+    } else {
+        int16x8_t exponent;
+        nibble = veorq_s16(nibble, vdupq_n_s16(0xff));
+        exponent = vandq_s16(vshrq_n_s16(nibble, 4), vdupq_n_s16(0x7));
+        mantissa = vaddq_s16(vshlq_n_s16(vandq_s16(nibble, vdupq_n_s16(0xf)), 3), vdupq_n_s16(0x84));
+        mantissa = vsubq_s16(vshlq_s16(mantissa, exponent), vdupq_n_s16(0x84));
+        negative = vtstq_s16(nibble, vdupq_n_s16(0x80));
+    }
+
+    return vbslq_s16(negative, vnegq_s16(mantissa), mantissa);
+}
+
+static size_t LAW_DecodeLanes_NEON(Uint16 encoding, Uint8 *data, size_t sample_count)
+{
+    size_t i = sample_count;
+
+    // The stores never reach the bytes that are still to be loaded.
+    while (i >= 16) {
+        uint8x16_t bytes;
+        i -= 16;
+        bytes = vld1q_u8(data + i);
+        vst1q_s16((Sint16 *)(data + i * 2 + 16), LAW_Expand_NEON(encoding, vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bytes)))));
+        vst1q_s16((Sint16 *)(data + i * 2), LAW_Expand_NEON(encoding, vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bytes)))));
+    }
+
+    return i;
+}
+#endif
+
+/* Expands sample_count A-law or mu-law samples at the start of data to 16-bit
+ * samples in-place. data must be big enough to hold the expanded samples.
+ */
+static bool LAW_DecodeSamples(Uint16 encoding, Uint8 *data, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1200,53 +1677,18 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+    const Uint8 *src = data;
+    Sint16 *dst = (Sint16 *)data;
+    size_t i;
 
     /* Work backwards, since we're expanding in-place. `format` will
      * inform the caller about the byte order.
      */
     i = sample_count;
-    switch (file->format.encoding) {
+    if (LAW_DecodeLanes && (encoding == ALAW_CODE || encoding == MULAW_CODE)) {
+        i = LAW_DecodeLanes(encoding, data, sample_count);
+    }
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1733,58 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    if (!LAW_DecodeSamples(file->format.encoding, src, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1834,35 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+/* Expands sample_count 24-bit samples at the start of ptr to 32-bit samples
+ * in-place. ptr must be big enough to hold the expanded samples.
+ */
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    // work from end to start, since we're expanding in-place.
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1890,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1770,7 +2270,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads the chunk headers and the format of a WAVE file. On success, file->chunk
+ * describes the data chunk, without its data being read yet, and endposition is
+ * set to the position after the RIFF chunk.
+ */
+static bool WaveParse(SDL_IOStream *src, WaveFile *file, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1778,7 +2282,6 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
     const char *hint;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     bool RIFFlengthknown = false;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1981,9 +2484,127 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
-    // Process data chunk.
     *chunk = datachunk;
 
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return true;
+}
+
+static bool WaveGetSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by the checks in WaveParse().
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Has been shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    return true;
+}
+
+static void WaveChooseDecoders(void)
+{
+    static bool decoders_chosen = false;
+    if (decoders_chosen) {
+        return;
+    }
+
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        MS_ADPCM_DecodeLanes = MS_ADPCM_DecodeLanes_SSE41;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        MS_ADPCM_DecodeLanes = MS_ADPCM_DecodeLanes_NEON;
+    } else
+#endif
+    {
+        MS_ADPCM_DecodeLanes = NULL;
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        IMA_ADPCM_DecodeLanes = IMA_ADPCM_DecodeLanes_SSE2;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        IMA_ADPCM_DecodeLanes = IMA_ADPCM_DecodeLanes_NEON;
+    } else
+#endif
+    {
+        IMA_ADPCM_DecodeLanes = NULL;
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        LAW_DecodeLanes = LAW_DecodeLanes_SSE2;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        LAW_DecodeLanes = LAW_DecodeLanes_NEON;
+    } else
+#endif
+    {
+        LAW_DecodeLanes = NULL;
+    }
+
+    decoders_chosen = true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition = 0;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (!WaveParse(src, file, &endposition)) {
+        return false;
+    }
+
+    // Process data chunk.
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result < 0) {
@@ -2002,6 +2623,7 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
     }
 
     // Decode or convert the data if necessary.
+    WaveChooseDecoders();
     switch (format->encoding) {
     case PCM_CODE:
     case IEEE_FLOAT_CODE:
@@ -2027,51 +2649,12 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
+    if (!WaveGetSpec(file, spec)) {
+        return false;
     }
 
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return true;
 }
@@ -2149,3 +2732,301 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+// Number of sample frames decoded at a time from uncompressed data.
+#define WAVE_STREAM_FRAMES 4096
+
+// The audio stream property that points to the WaveStream of a WAVE audio stream.
+#define WAVE_STREAM_PROPERTY "SDL.internal.audiostream.wav"
+
+typedef struct WaveStream
+{
+    SDL_AudioStream *stream;
+    SDL_IOStream *src;
+    bool closeio;
+    WaveFile file;
+    size_t outputframesize; // Size of a decoded sample frame in bytes.
+    Sint64 frame;           // Next sample frame to decode.
+    bool done;              // Set once the end of the data has been put into the stream.
+
+    Uint8 *input;     // Raw data of the current block.
+    size_t inputsize; // Size of the input buffer in bytes.
+    Uint8 *output;    // Decoded data of the current block.
+    size_t outputpos; // Position of the next frame to put into the stream in the output buffer.
+    void *cstate;     // Decoding state for each channel of ADPCM data.
+} WaveStream;
+
+static void WaveStreamFree(WaveStream *ws)
+{
+    if (ws->closeio) {
+        SDL_CloseIO(ws->src);
+    }
+    WaveFreeChunkData(&ws->file.chunk);
+    SDL_free(ws->file.decoderdata);
+    SDL_free(ws->input);
+    SDL_free(ws->output);
+    SDL_free(ws->cstate);
+    SDL_free(ws);
+}
+
+/* Decodes the data at ws->frame into the output buffer and returns the number
+ * of sample frames decoded, 0 at the end of the data. ADPCM data is decoded a
+ * block at a time, skipping the frames before ws->frame in the first block.
+ */
+static size_t WaveStreamDecode(WaveStream *ws)
+{
+    WaveFile *file = &ws->file;
+    WaveFormat *format = &file->format;
+    const Sint64 framesleft = file->sampleframes - ws->frame;
+    Uint64 offset;
+    size_t length, frames, skip = 0;
+
+    if (framesleft <= 0) {
+        return 0;
+    }
+
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        offset = (Uint64)(ws->frame / format->samplesperblock) * format->blockalign;
+        skip = (size_t)(ws->frame % format->samplesperblock);
+        length = format->blockalign;
+    } else {
+        frames = (size_t)SDL_min(framesleft, WAVE_STREAM_FRAMES);
+        offset = (Uint64)ws->frame * format->blockalign;
+        length = frames * format->blockalign;
+    }
+
+    // Only read what's left of the data chunk.
+    if (offset >= file->chunk.length) {
+        return 0;
+    } else if (length > file->chunk.length - offset) {
+        length = (size_t)(file->chunk.length - offset);
+    }
+
+    if (SDL_SeekIO(ws->src, file->chunk.position + (Sint64)offset, SDL_IO_SEEK_SET) < 0) {
+        return 0;
+    }
+    length = SDL_ReadIO(ws->src, ws->input, length);
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    {
+        ADPCM_DecoderState state;
+        bool result;
+
+        SDL_zero(state);
+        state.channels = format->channels;
+        state.blocksize = format->blockalign;
+        state.blockheadersize = (size_t)state.channels * (format->encoding == MS_ADPCM_CODE ? 7 : 4);
+        state.samplesperblock = format->samplesperblock;
+        state.framesize = state.channels * sizeof(Sint16);
+        state.ddata = file->decoderdata;
+        state.cstate = ws->cstate;
+        state.framestotal = file->sampleframes;
+        state.framesleft = framesleft + skip;
+        state.block.data = ws->input;
+        state.block.size = length;
+        state.output.data = (Sint16 *)ws->output;
+        state.output.size = state.samplesperblock * state.channels;
+
+        if (length < state.blockheadersize) {
+            return 0;
+        }
+        if (format->encoding == MS_ADPCM_CODE) {
+            result = MS_ADPCM_DecodeBlockHeader(&state) && MS_ADPCM_DecodeBlockData(&state);
+        } else {
+            result = IMA_ADPCM_DecodeBlockHeader(&state) && IMA_ADPCM_DecodeBlockData(&state);
+        }
+        if (!result && file->trunchint != TruncDropFrame) {
+            // Drop the truncated block like SDL_LoadWAV_IO() does.
+            return 0;
+        }
+
+        frames = SDL_min(state.output.pos / state.channels, (size_t)SDL_min(framesleft + skip, (Sint64)state.samplesperblock));
+        break;
+    }
+    case ALAW_CODE:
+    case MULAW_CODE:
+        frames = length / format->blockalign;
+        LAW_DecodeSamples(format->encoding, ws->input, frames * format->channels);
+        break;
+    case PCM_CODE:
+        frames = length / format->blockalign;
+        if (format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(ws->input, frames * format->channels);
+        }
+        break;
+    default:
+        frames = length / format->blockalign;
+        break;
+    }
+
+    if (frames <= skip) {
+        return 0;
+    }
+    ws->outputpos = skip * ws->outputframesize;
+    ws->frame += frames - skip;
+    return frames - skip;
+}
+
+static void SDLCALL WaveStreamCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *ws = (WaveStream *)userdata;
+    const Uint8 *output = ws->output ? ws->output : ws->input;
+
+    while (additional_amount > 0 && !ws->done) {
+        const size_t frames = WaveStreamDecode(ws);
+        int length;
+
+        if (frames == 0) {
+            // Let the last sample frames through the resampler.
+            SDL_FlushAudioStream(stream);
+            ws->done = true;
+            break;
+        }
+
+        length = (int)(frames * ws->outputframesize);
+        if (!SDL_PutAudioStreamData(stream, output + ws->outputpos, length)) {
+            break;
+        }
+        additional_amount -= length;
+    }
+}
+
+static void SDLCALL WaveStreamCleanup(void *userdata, void *value)
+{
+    WaveStream *ws = (WaveStream *)value;
+
+    // Make sure the callback isn't running and won't run again.
+    SDL_LockAudioStream(ws->stream);
+    SDL_SetAudioStreamGetCallback(ws->stream, NULL, NULL);
+    SDL_UnlockAudioStream(ws->stream);
+
+    WaveStreamFree(ws);
+}
+
+SDL_AudioStream *SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec)
+{
+    WaveStream *ws = NULL;
+    WaveFormat *format;
+    SDL_AudioSpec wavespec;
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+    Sint64 endposition;
+
+    if (spec) {
+        SDL_zerop(spec);
+    }
+
+    if (!src) {
+        SDL_InvalidParamError("src");
+        goto failed;
+    }
+
+    ws = (WaveStream *)SDL_calloc(1, sizeof(*ws));
+    if (!ws) {
+        goto failed;
+    }
+    ws->src = src;
+    ws->file.riffhint = WaveGetRiffSizeHint();
+    ws->file.trunchint = WaveGetTruncationHint();
+    ws->file.facthint = WaveGetFactChunkHint();
+    format = &ws->file.format;
+
+    if (!WaveParse(src, &ws->file, &endposition) || !WaveGetSpec(&ws->file, &wavespec)) {
+        goto failed;
+    }
+    WaveChooseDecoders();
+    ws->outputframesize = SDL_AUDIO_FRAMESIZE(wavespec);
+
+    // Allocate the buffers for a block of input and output data.
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        ws->inputsize = format->blockalign;
+        ws->output = (Uint8 *)SDL_malloc((size_t)format->samplesperblock * ws->outputframesize);
+        ws->cstate = SDL_calloc(format->channels, (format->encoding == MS_ADPCM_CODE) ? sizeof(MS_ADPCM_ChannelState) : sizeof(Sint8));
+        if (!ws->output || !ws->cstate) {
+            goto failed;
+        }
+    } else {
+        // The input buffer is big enough to expand the samples in-place.
+        ws->inputsize = WAVE_STREAM_FRAMES * SDL_max((size_t)format->blockalign, ws->outputframesize);
+    }
+    ws->input = (Uint8 *)SDL_malloc(ws->inputsize);
+    if (!ws->input) {
+        goto failed;
+    }
+
+    stream = SDL_CreateAudioStream(&wavespec, &wavespec);
+    if (!stream) {
+        goto failed;
+    }
+    ws->stream = stream;
+    ws->closeio = closeio;
+
+    props = SDL_GetAudioStreamProperties(stream);
+    if (!props) {
+        goto failed;
+    }
+
+    // From here on the stream owns ws, and the cleanup closes src if needed.
+    if (!SDL_SetPointerPropertyWithCleanup(props, WAVE_STREAM_PROPERTY, ws, WaveStreamCleanup, NULL) ||
+        !SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER, ws->file.sampleframes) ||
+        !SDL_SetAudioStreamGetCallback(stream, WaveStreamCallback, ws)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    if (spec) {
+        *spec = wavespec;
+    }
+    return stream;
+
+failed:
+    if (stream) {
+        SDL_DestroyAudioStream(stream);
+    }
+    if (ws) {
+        ws->closeio = false;
+        WaveStreamFree(ws);
+    }
+    if (closeio && src) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+SDL_AudioStream *SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(path, "rb");
+    if (!stream) {
+        if (spec) {
+            SDL_zerop(spec);
+        }
+        return NULL;
+    }
+    return SDL_OpenWAVStream_IO(stream, true, spec);
+}
+
+bool SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame)
+{
+    WaveStream *ws;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (frame < 0) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    ws = (WaveStream *)SDL_GetPointerProperty(SDL_GetAudioStreamProperties(stream), WAVE_STREAM_PROPERTY, NULL);
+    if (!ws) {
+        return SDL_SetError("Audio stream doesn't decode WAVE data");
+    }
+
+    SDL_LockAudioStream(stream);
+    ws->frame = SDL_min(frame, ws->file.sampleframes);
+    ws->done = false;
+    SDL_ClearAudioStream(stream);
+    SDL_UnlockAudioStream(stream);
+
+    return true;
+}
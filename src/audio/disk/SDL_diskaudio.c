@@ -130,6 +130,10 @@ static bool DISKAUDIO_OpenDevice(SDL_AudioDevice *device)
         }
     }
 
+    if (SDL_GetAudioOfflineClock() == SDL_AUDIO_OFFLINE_CLOCK_FAST) {
+        device->hidden->io_delay = 0;
+    }
+
     // Open the "audio device"
     device->hidden->io = SDL_IOFromFile(fname, recording ? "rb" : "wb");
     if (!device->hidden->io) {
@@ -173,6 +177,12 @@ static bool DISKAUDIO_Init(SDL_AudioDriverImpl *impl)
 
     impl->HasRecordingSupport = true;
 
+    // Without a device thread, the file is only written when the app calls SDL_StepAudioDevice().
+    if (SDL_GetAudioOfflineClock() == SDL_AUDIO_OFFLINE_CLOCK_MANUAL) {
+        impl->ProvidesOwnCallbackThread = true;
+        impl->SteppedByApp = true;
+    }
+
     return true;
 }
 
@@ -29,6 +29,9 @@
 #include <emscripten/emscripten.h>
 #endif
 
+// true if SDL_HINT_AUDIO_OFFLINE_CLOCK is "manual", and SDL_StepAudioDevice() runs the devices.
+static bool stepped_by_app = false;
+
 static bool DUMMYAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
     SDL_Delay(device->hidden->io_delay);
@@ -59,13 +62,20 @@ static bool DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
         }
     }
 
+    if (SDL_GetAudioOfflineClock() == SDL_AUDIO_OFFLINE_CLOCK_FAST) {
+        device->hidden->io_delay = 0;
+    }
+
     // on Emscripten without threads, we just fire a repeating timer to consume audio.
+    // (unless the app is stepping the device itself.)
     #if defined(SDL_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
-    MAIN_THREAD_EM_ASM({
-        var a = Module['SDL3'].dummy_audio;
-        if (a.timers[$0] !== undefined) { clearInterval(a.timers[$0]); }
-        a.timers[$0] = setInterval(function() { dynCall('vi', $3, [$4]); }, ($1 / $2) * 1000);
-    }, device->recording ? 1 : 0, device->sample_frames, device->spec.freq, device->recording ? SDL_RecordingAudioThreadIterate : SDL_PlaybackAudioThreadIterate, device);
+    if (!stepped_by_app) {
+        MAIN_THREAD_EM_ASM({
+            var a = Module['SDL3'].dummy_audio;
+            if (a.timers[$0] !== undefined) { clearInterval(a.timers[$0]); }
+            a.timers[$0] = setInterval(function() { dynCall('vi', $3, [$4]); }, ($1 / $2) * 1000);
+        }, device->recording ? 1 : 0, device->sample_frames, device->spec.freq, device->recording ? SDL_RecordingAudioThreadIterate : SDL_PlaybackAudioThreadIterate, device);
+    }
     #endif
 
     return true; // we're good; don't change reported device format.
@@ -113,6 +123,12 @@ static bool DUMMYAUDIO_Init(SDL_AudioDriverImpl *impl)
     impl->OnlyHasDefaultRecordingDevice = true;
     impl->HasRecordingSupport = true;
 
+    stepped_by_app = (SDL_GetAudioOfflineClock() == SDL_AUDIO_OFFLINE_CLOCK_MANUAL);
+    if (stepped_by_app) {
+        impl->ProvidesOwnCallbackThread = true;
+        impl->SteppedByApp = true;
+    }
+
     // on Emscripten without threads, we just fire a repeating timer to consume audio.
     #if defined(SDL_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
     MAIN_THREAD_EM_ASM({
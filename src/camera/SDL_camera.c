@@ -24,6 +24,7 @@
 #include "SDL_camera_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_surface_c.h"
+#include "../video/SDL_yuv_c.h"
 #include "../thread/SDL_systhread.h"
 
 
@@ -813,6 +814,8 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
         return (permission < 0) ? false : true;  // if permission was denied, shut it down. if undecided, we're done for now.
     }
 
+    SDL_TRACE_BEGIN("SDL_CameraThreadIterate");
+
     bool failed = false;  // set to true if disaster worthy of treating the device as lost has happened.
     SDL_Surface *acquired = NULL;
     SDL_Surface *output_surface = NULL;
@@ -890,19 +893,31 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             SDL_Log("CAMERA: Frame is getting converted!");
             #endif
             SDL_Surface *srcsurf = acquired;
-            if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
+            bool fused = false;
+            #ifdef SDL_HAVE_YUV
+            if (device->needs_scaling && device->needs_conversion &&
+                SDL_ISPIXELFORMAT_FOURCC(srcsurf->format) && (srcsurf->format != SDL_PIXELFORMAT_MJPG) &&
+                !SDL_ISPIXELFORMAT_FOURCC(output_surface->format)) {
+                // YUV to RGB can scale and convert in a single pass, without touching conversion_surface.
+                fused = SDL_StretchPixels_YUV_to_RGB(srcsurf->w, srcsurf->h, srcsurf->format, SDL_COLORSPACE_UNKNOWN, srcsurf->pixels, srcsurf->pitch,
+                                                     output_surface->w, output_surface->h, output_surface->format, SDL_COLORSPACE_UNKNOWN, output_surface->pixels, output_surface->pitch);
+            }
+            #endif
+            // MJPG has to be decoded before it can be scaled, so it always converts first.
+            const bool downscale_first = (device->needs_scaling == -1) && (srcsurf->format != SDL_PIXELFORMAT_MJPG);
+            if (!fused && downscale_first) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
                 SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
                 SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
                 srcsurf = dstsurf;
             }
-            if (device->needs_conversion) {
-                SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
+            if (!fused && device->needs_conversion) {
+                SDL_Surface *dstsurf = (device->needs_scaling && !downscale_first) ? device->conversion_surface : output_surface;
                 SDL_ConvertPixels(srcsurf->w, srcsurf->h,
                                   srcsurf->format, srcsurf->pixels, srcsurf->pitch,
                                   dstsurf->format, dstsurf->pixels, dstsurf->pitch);
                 srcsurf = dstsurf;
             }
-            if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
+            if (!fused && device->needs_scaling && !downscale_first) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
                 SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
             }
 
@@ -921,6 +936,8 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
         SDL_UnlockMutex(device->lock);
     }
 
+    SDL_TRACE_END();
+
     return true;  // always go on if not shutting down, even if device failed.
 }
 
@@ -1004,7 +1021,7 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 
     // if we have to scale _and_ convert, we need a middleman surface, since we can't do both changes at once.
     if (device->needs_scaling && device->needs_conversion) {
-        const bool downscaling_first = (device->needs_scaling < 0);
+        const bool downscaling_first = (device->needs_scaling < 0) && (devspec->format != SDL_PIXELFORMAT_MJPG);  // MJPG has to be decoded before scaling.
         const SDL_CameraSpec *s = downscaling_first ? appspec : devspec;
         const SDL_PixelFormat fmt = downscaling_first ? devspec->format : appspec->format;
         device->conversion_surface = SDL_CreateSurface(s->width, s->height, fmt);
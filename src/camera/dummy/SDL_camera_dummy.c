@@ -23,37 +23,653 @@
 #ifdef SDL_CAMERA_DRIVER_DUMMY
 
 #include "../SDL_syscamera.h"
+#include "../../video/SDL_pixels_c.h"
+
+// The dummy driver doesn't talk to any hardware. It exposes virtual devices
+//  described by SDL_HINT_CAMERA_DUMMY_DEVICES, and feeds them with a scrolling
+//  color bar pattern or with frames read from a file, so the rest of the
+//  camera pipeline can be tested and benchmarked on headless machines.
+
+#define DUMMY_DEFAULT_DEVICES "YUY2 640x480@30"
+#define DUMMY_MAX_FRAMES 16  // frames can be held by the app, so we need more than one buffer.
+#define DUMMY_SCROLL_PIXELS 8  // the pattern moves this far every frame, so consecutive frames differ.
+#define DUMMY_FREE_RUN_POLL_NS (SDL_NS_PER_MS / 10)
+
+typedef struct DummyCameraDevice
+{
+    SDL_CameraSpec spec;
+    bool free_run;
+    char *path;  // NULL to generate a test pattern.
+} DummyCameraDevice;
+
+typedef struct DummyCameraFrame
+{
+    Uint8 *pixels;
+    bool in_use;
+} DummyCameraFrame;
+
+struct SDL_PrivateCameraData
+{
+    const DummyCameraDevice *config;
+    SDL_CameraSpec spec;
+    SDL_IOStream *io;       // raw frames streamed from a file.
+    Uint8 *mjpg_file;       // MJPG frames loaded from a file.
+    size_t mjpg_file_len;
+    size_t mjpg_file_pos;
+    Uint8 *pattern;         // raw test pattern, twice as wide as a frame so we can scroll through it.
+    int pattern_pitch;
+    size_t frame_len;       // size of each buffer in `frames`.
+    DummyCameraFrame frames[DUMMY_MAX_FRAMES];
+    Uint64 frame_count;
+    Uint64 frame_ns;
+    Uint64 next_frame_ns;
+};
+
+static const struct
+{
+    const char *name;
+    SDL_PixelFormat format;
+} DummyCameraFormats[] = {
+    { "YUY2", SDL_PIXELFORMAT_YUY2 },
+    { "NV12", SDL_PIXELFORMAT_NV12 },
+    { "MJPG", SDL_PIXELFORMAT_MJPG },
+    { "XRGB8888", SDL_PIXELFORMAT_XRGB8888 }
+};
+
+// White, yellow, cyan, green, magenta, red, blue, black.
+static const Uint8 DummyColorBars[8][3] = {
+    { 255, 255, 255 }, { 255, 255, 0 }, { 0, 255, 255 }, { 0, 255, 0 },
+    { 255, 0, 255 }, { 255, 0, 0 }, { 0, 0, 255 }, { 0, 0, 0 }
+};
+
+static int GetColorBar(int x, int w)
+{
+    return ((x % w) * (int)SDL_arraysize(DummyColorBars)) / w;
+}
+
+// BT.601 full range (SDL_COLORSPACE_JPEG), SDL's default for YUV formats and what JPEG uses.
+static void ColorBarToYUV(int bar, Uint8 *y, Uint8 *u, Uint8 *v)
+{
+    const int r = DummyColorBars[bar][0];
+    const int g = DummyColorBars[bar][1];
+    const int b = DummyColorBars[bar][2];
+    *y = (Uint8)((77 * r + 150 * g + 29 * b + 128) / 256);
+    *u = (Uint8)SDL_min((-43 * r - 85 * g + 128 * b + 128 + 128 * 256) / 256, 255);
+    *v = (Uint8)SDL_min((128 * r - 107 * g - 21 * b + 128 + 128 * 256) / 256, 255);
+}
+
+static size_t GetRawFrameLen(const SDL_CameraSpec *spec)
+{
+    const size_t wxh = (size_t)spec->width * (size_t)spec->height;
+    if (spec->format == SDL_PIXELFORMAT_NV12) {
+        return wxh + (wxh / 2);
+    }
+    return wxh * SDL_BYTESPERPIXEL(spec->format);
+}
+
+// Raw formats: render the color bars once, twice as wide as the frame, and
+//  hand out windows into it. This makes the pattern free to produce, so
+//  benchmarks measure the camera pipeline and not the frame source.
+static bool CreatePattern(struct SDL_PrivateCameraData *hidden)
+{
+    const int w = hidden->spec.width;
+    const int h = hidden->spec.height;
+    const int pw = w * 2;
+    int rows = h;
+    int x, y;
+
+    switch (hidden->spec.format) {
+    case SDL_PIXELFORMAT_XRGB8888:
+        hidden->pattern_pitch = pw * 4;
+        break;
+    case SDL_PIXELFORMAT_YUY2:
+        hidden->pattern_pitch = pw * 2;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+        hidden->pattern_pitch = pw;
+        rows += h / 2;
+        break;
+    default:
+        return SDL_SetError("Unsupported pattern format");
+    }
+
+    hidden->pattern = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)hidden->pattern_pitch * rows);
+    if (!hidden->pattern) {
+        return false;
+    }
+
+    Uint8 *row = hidden->pattern;
+    switch (hidden->spec.format) {
+    case SDL_PIXELFORMAT_XRGB8888:
+        for (x = 0; x < pw; ++x) {
+            const Uint8 *rgb = DummyColorBars[GetColorBar(x, w)];
+            ((Uint32 *)row)[x] = 0xFF000000 | ((Uint32)rgb[0] << 16) | ((Uint32)rgb[1] << 8) | rgb[2];
+        }
+        break;
+    case SDL_PIXELFORMAT_YUY2:
+        for (x = 0; x < pw; x += 2) {
+            Uint8 y1, u, v;
+            ColorBarToYUV(GetColorBar(x + 1, w), &y1, &u, &v);
+            ColorBarToYUV(GetColorBar(x, w), &row[x * 2], &u, &v);
+            row[x * 2 + 1] = u;
+            row[x * 2 + 2] = y1;
+            row[x * 2 + 3] = v;
+        }
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    {
+        Uint8 *uvrow = hidden->pattern + (size_t)hidden->pattern_pitch * h;
+        for (x = 0; x < pw; ++x) {
+            Uint8 u, v;
+            ColorBarToYUV(GetColorBar(x, w), &row[x], &u, &v);
+            if ((x & 1) == 0) {
+                uvrow[x] = u;
+                uvrow[x + 1] = v;
+            }
+        }
+        for (y = 1; y < h / 2; ++y) {
+            SDL_memcpy(uvrow + (size_t)hidden->pattern_pitch * y, uvrow, hidden->pattern_pitch);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    for (y = 1; y < h; ++y) {
+        SDL_memcpy(row + (size_t)hidden->pattern_pitch * y, row, hidden->pattern_pitch);
+    }
+
+    return true;
+}
+
+// MJPG: a minimal baseline JPEG encoder. The color bars are flat across each
+//  8x8 block, so every block only needs its DC coefficient, followed by an
+//  end-of-block code.
+
+#define DUMMY_JPEG_HEADER_LEN 1024
+#define DUMMY_JPEG_MAX_BLOCK_LEN 6  // 17 bits at most, doubled for 0xFF byte stuffing.
+
+// The standard luminance DC table, used for all three components.
+static const Uint8 DummyJPEGDCBits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const Uint16 DummyJPEGDCCodes[12] = { 0x0, 0x2, 0x3, 0x4, 0x5, 0x6, 0xE, 0x1E, 0x3E, 0x7E, 0xFE, 0x1FE };
+static const Uint8 DummyJPEGDCCodeLens[12] = { 2, 3, 3, 3, 3, 3, 4, 5, 6, 7, 8, 9 };
+
+typedef struct DummyJPEGWriter
+{
+    Uint8 *dst;
+    size_t len;
+    Uint32 accum;
+    int count;
+} DummyJPEGWriter;
+
+static void JPEGPutBytes(DummyJPEGWriter *writer, const Uint8 *bytes, size_t len)
+{
+    SDL_memcpy(writer->dst + writer->len, bytes, len);
+    writer->len += len;
+}
+
+static void JPEGPutBits(DummyJPEGWriter *writer, Uint32 value, int count)
+{
+    writer->accum = (writer->accum << count) | (value & ((1u << count) - 1));
+    writer->count += count;
+    while (writer->count >= 8) {
+        const Uint8 byte = (Uint8)(writer->accum >> (writer->count - 8));
+        writer->dst[writer->len++] = byte;
+        if (byte == 0xFF) {
+            writer->dst[writer->len++] = 0x00;
+        }
+        writer->count -= 8;
+    }
+}
+
+static void JPEGPutDC(DummyJPEGWriter *writer, int value, int *prediction)
+{
+    const int diff = value - *prediction;
+    int category = 0;
+    for (int magnitude = SDL_abs(diff); magnitude; magnitude >>= 1) {
+        ++category;
+    }
+    *prediction = value;
+
+    JPEGPutBits(writer, DummyJPEGDCCodes[category], DummyJPEGDCCodeLens[category]);
+    if (category) {
+        JPEGPutBits(writer, (Uint32)((diff < 0) ? (diff - 1) : diff), category);
+    }
+    JPEGPutBits(writer, 0, 1);  // end of block.
+}
+
+static size_t GetJPEGMaxLen(const SDL_CameraSpec *spec)
+{
+    const size_t blocks = (size_t)((spec->width + 7) / 8) * (size_t)((spec->height + 7) / 8);
+    return DUMMY_JPEG_HEADER_LEN + blocks * 3 * DUMMY_JPEG_MAX_BLOCK_LEN;
+}
+
+static size_t EncodeJPEG(const SDL_CameraSpec *spec, int offset, Uint8 *dst)
+{
+    const int w = spec->width;
+    const int h = spec->height;
+    const int blocks_wide = (w + 7) / 8;
+    const int blocks_high = (h + 7) / 8;
+    DummyJPEGWriter writer = { dst, 0, 0, 0 };
+    int prediction[3] = { 0, 0, 0 };
+    int i;
+
+    static const Uint8 soi[] = { 0xFF, 0xD8 };
+    JPEGPutBytes(&writer, soi, sizeof(soi));
+
+    // One quantization table: the DC coefficient of a flat block is 8 * (value - 128), so divide by 8.
+    Uint8 dqt[5 + 64];
+    dqt[0] = 0xFF;
+    dqt[1] = 0xDB;
+    dqt[2] = 0;
+    dqt[3] = 67;
+    dqt[4] = 0;
+    dqt[5] = 8;
+    SDL_memset(&dqt[6], 1, 63);
+    JPEGPutBytes(&writer, dqt, sizeof(dqt));
+
+    const Uint8 sof[] = {
+        0xFF, 0xC0, 0, 17, 8,
+        (Uint8)(h >> 8), (Uint8)h, (Uint8)(w >> 8), (Uint8)w,
+        3, 1, 0x11, 0, 2, 0x11, 0, 3, 0x11, 0
+    };
+    JPEGPutBytes(&writer, sof, sizeof(sof));
+
+    static const Uint8 dht_dc[] = { 0xFF, 0xC4, 0, 31, 0x00 };
+    static const Uint8 dc_symbols[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    JPEGPutBytes(&writer, dht_dc, sizeof(dht_dc));
+    JPEGPutBytes(&writer, DummyJPEGDCBits, sizeof(DummyJPEGDCBits));
+    JPEGPutBytes(&writer, dc_symbols, sizeof(dc_symbols));
+
+    // The AC table only has the end-of-block symbol, with a one bit code.
+    static const Uint8 dht_ac[] = { 0xFF, 0xC4, 0, 20, 0x10 };
+    static const Uint8 ac_bits[16] = { 1 };
+    static const Uint8 ac_symbols[] = { 0x00 };
+    JPEGPutBytes(&writer, dht_ac, sizeof(dht_ac));
+    JPEGPutBytes(&writer, ac_bits, sizeof(ac_bits));
+    JPEGPutBytes(&writer, ac_symbols, sizeof(ac_symbols));
+
+    static const Uint8 sos[] = { 0xFF, 0xDA, 0, 12, 3, 1, 0x00, 2, 0x00, 3, 0x00, 0, 63, 0 };
+    JPEGPutBytes(&writer, sos, sizeof(sos));
+
+    for (int by = 0; by < blocks_high; ++by) {
+        for (int bx = 0; bx < blocks_wide; ++bx) {
+            const int x = SDL_min(bx * 8 + 4, w - 1);
+            Uint8 ycc[3];
+            ColorBarToYUV(GetColorBar(x + offset, w), &ycc[0], &ycc[1], &ycc[2]);
+            for (i = 0; i < 3; ++i) {
+                JPEGPutDC(&writer, (int)ycc[i] - 128, &prediction[i]);
+            }
+        }
+    }
+
+    if (writer.count) {
+        JPEGPutBits(&writer, 0xFF, 8 - writer.count);  // pad the last byte with 1 bits.
+    }
+
+    static const Uint8 eoi[] = { 0xFF, 0xD9 };
+    JPEGPutBytes(&writer, eoi, sizeof(eoi));
+
+    return writer.len;
+}
+
+static bool FindJPEG(const Uint8 *data, size_t len, size_t pos, size_t *start, size_t *end)
+{
+    size_t i;
+
+    for (i = pos; (i + 1) < len; ++i) {
+        if (data[i] == 0xFF && data[i + 1] == 0xD8) {
+            break;
+        }
+    }
+    *start = i;
+    for (i += 2; (i + 1) < len; ++i) {
+        if (data[i] == 0xFF && data[i + 1] == 0xD9) {
+            *end = i + 2;
+            return true;
+        }
+    }
+    return false;
+}
+
+static Uint8 *AcquireFrameBuffer(struct SDL_PrivateCameraData *hidden)
+{
+    for (int i = 0; i < SDL_arraysize(hidden->frames); ++i) {
+        DummyCameraFrame *frame = &hidden->frames[i];
+        if (!frame->in_use) {
+            if (!frame->pixels) {
+                frame->pixels = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), hidden->frame_len);
+                if (!frame->pixels) {
+                    return NULL;
+                }
+            }
+            frame->in_use = true;
+            return frame->pixels;
+        }
+    }
+    return NULL;
+}
+
+static void ReleaseFrameBuffer(struct SDL_PrivateCameraData *hidden, void *pixels)
+{
+    for (int i = 0; i < SDL_arraysize(hidden->frames); ++i) {
+        DummyCameraFrame *frame = &hidden->frames[i];
+        if (frame->in_use && frame->pixels == pixels) {
+            frame->in_use = false;
+            break;
+        }
+    }
+}
 
 static bool DUMMYCAMERA_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
 {
-    return SDL_Unsupported();
+    const DummyCameraDevice *config = (const DummyCameraDevice *)device->handle;
+    struct SDL_PrivateCameraData *hidden = (struct SDL_PrivateCameraData *)SDL_calloc(1, sizeof(*hidden));
+    if (!hidden) {
+        return false;
+    }
+    device->hidden = hidden;
+
+    hidden->config = config;
+    SDL_copyp(&hidden->spec, spec);
+
+    if (config->path) {
+        if (spec->format == SDL_PIXELFORMAT_MJPG) {
+            size_t start, end;
+            hidden->mjpg_file = (Uint8 *)SDL_LoadFile(config->path, &hidden->mjpg_file_len);
+            if (!hidden->mjpg_file) {
+                return false;
+            }
+            if (!FindJPEG(hidden->mjpg_file, hidden->mjpg_file_len, 0, &start, &end)) {
+                return SDL_SetError("No JPEG images in '%s'", config->path);
+            }
+        } else {
+            hidden->frame_len = GetRawFrameLen(spec);
+            hidden->io = SDL_IOFromFile(config->path, "rb");
+            if (!hidden->io) {
+                return false;
+            }
+            const Sint64 size = SDL_GetIOSize(hidden->io);
+            if (size >= 0 && (Uint64)size < hidden->frame_len) {
+                return SDL_SetError("'%s' doesn't hold a whole frame", config->path);
+            }
+        }
+    } else if (spec->format == SDL_PIXELFORMAT_MJPG) {
+        hidden->frame_len = GetJPEGMaxLen(spec);
+    } else if (!CreatePattern(hidden)) {
+        return false;
+    }
+
+    hidden->frame_ns = SDL_NS_PER_SECOND * (Uint64)spec->framerate_denominator / (Uint64)spec->framerate_numerator;
+    hidden->next_frame_ns = SDL_GetTicksNS();
+
+    SDL_CameraPermissionOutcome(device, true);  // there's no one to ask, it's always approved.
+
+    return true;
 }
 
 static void DUMMYCAMERA_CloseDevice(SDL_Camera *device)
 {
+    struct SDL_PrivateCameraData *hidden = device->hidden;
+    if (hidden) {
+        SDL_CloseIO(hidden->io);
+        SDL_free(hidden->mjpg_file);
+        SDL_aligned_free(hidden->pattern);
+        for (int i = 0; i < SDL_arraysize(hidden->frames); ++i) {
+            SDL_aligned_free(hidden->frames[i].pixels);
+        }
+        SDL_free(hidden);
+        device->hidden = NULL;
+    }
 }
 
 static bool DUMMYCAMERA_WaitDevice(SDL_Camera *device)
 {
-    return SDL_Unsupported();
+    struct SDL_PrivateCameraData *hidden = device->hidden;
+
+    if (hidden->config->free_run) {
+        // produce a new frame as soon as the app has somewhere to put it.
+        while (!SDL_GetAtomicInt(&device->shutdown)) {
+            SDL_LockMutex(device->lock);
+            const bool ready = (device->empty_output_surfaces.next != NULL);
+            SDL_UnlockMutex(device->lock);
+            if (ready) {
+                break;
+            }
+            SDL_DelayNS(DUMMY_FREE_RUN_POLL_NS);
+        }
+    } else {
+        const Uint64 now = SDL_GetTicksNS();
+        if (now < hidden->next_frame_ns) {
+            SDL_DelayPrecise(hidden->next_frame_ns - now);
+        }
+    }
+    return true;
 }
 
 static SDL_CameraFrameResult DUMMYCAMERA_AcquireFrame(SDL_Camera *device, SDL_Surface *frame, Uint64 *timestampNS)
 {
-    SDL_Unsupported();
-    return SDL_CAMERA_FRAME_ERROR;
+    struct SDL_PrivateCameraData *hidden = device->hidden;
+    const SDL_CameraSpec *spec = &hidden->spec;
+    const int offset = (int)((hidden->frame_count * DUMMY_SCROLL_PIXELS) % (Uint64)spec->width);
+    const Uint64 now = SDL_GetTicksNS();
+
+    if (hidden->config->free_run) {
+        *timestampNS = now;
+    } else {
+        *timestampNS = hidden->next_frame_ns;
+        hidden->next_frame_ns += hidden->frame_ns;
+        if (hidden->next_frame_ns < now) {
+            hidden->next_frame_ns = now;  // we fell behind; carry on from here instead of bursting frames to catch up.
+        }
+    }
+
+    if (hidden->pattern) {
+        frame->pixels = hidden->pattern + (size_t)offset * SDL_BYTESPERPIXEL(spec->format);
+        frame->pitch = hidden->pattern_pitch;
+    } else if (hidden->mjpg_file) {
+        size_t start, end;
+        if (!FindJPEG(hidden->mjpg_file, hidden->mjpg_file_len, hidden->mjpg_file_pos, &start, &end)) {
+            FindJPEG(hidden->mjpg_file, hidden->mjpg_file_len, 0, &start, &end);  // start over, we know there's at least one.
+        }
+        hidden->mjpg_file_pos = end;
+        frame->pixels = hidden->mjpg_file + start;
+        frame->pitch = (int)(end - start);
+    } else {
+        Uint8 *pixels = AcquireFrameBuffer(hidden);
+        if (!pixels) {
+            return SDL_CAMERA_FRAME_SKIP;  // try again later, maybe the app will have released a frame.
+        }
+
+        if (hidden->io) {
+            if (SDL_ReadIO(hidden->io, pixels, hidden->frame_len) != hidden->frame_len) {
+                if (SDL_SeekIO(hidden->io, 0, SDL_IO_SEEK_SET) < 0 ||
+                    SDL_ReadIO(hidden->io, pixels, hidden->frame_len) != hidden->frame_len) {
+                    ReleaseFrameBuffer(hidden, pixels);
+                    SDL_SetError("Couldn't read a frame from '%s'", hidden->config->path);
+                    return SDL_CAMERA_FRAME_ERROR;
+                }
+            }
+            frame->pitch = spec->width * SDL_BYTESPERPIXEL(spec->format);  // NV12 counts as one byte per pixel, for the Y plane.
+        } else {
+            frame->pitch = (int)EncodeJPEG(spec, offset, pixels);
+        }
+        frame->pixels = pixels;
+    }
+
+    ++hidden->frame_count;
+
+    return SDL_CAMERA_FRAME_READY;
 }
 
 static void DUMMYCAMERA_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
 {
+    // the pattern and MJPG files are never written after opening, so only pooled buffers need to come back.
+    ReleaseFrameBuffer(device->hidden, frame->pixels);
+}
+
+static bool ParseDeviceSize(const char *str, SDL_CameraSpec *spec)
+{
+    char *end;
+
+    spec->width = (int)SDL_strtol(str, &end, 10);
+    if (*end != 'x') {
+        return false;
+    }
+    spec->height = (int)SDL_strtol(end + 1, &end, 10);
+    spec->framerate_numerator = 30;
+    spec->framerate_denominator = 1;
+    if (*end == '@') {
+        spec->framerate_numerator = (int)SDL_strtol(end + 1, &end, 10);
+        if (*end == '/') {
+            spec->framerate_denominator = (int)SDL_strtol(end + 1, &end, 10);
+        }
+    }
+    return (*end == '\0' && spec->width > 0 && spec->height > 0 &&
+            spec->framerate_numerator > 0 && spec->framerate_denominator > 0);
+}
+
+// Parses one device from SDL_HINT_CAMERA_DUMMY_DEVICES, like "NV12 1280x720@30 free file=frames.nv12"
+static bool ParseDevice(char *desc, DummyCameraDevice *config)
+{
+    SDL_CameraSpec *spec = &config->spec;
+    int num_tokens = 0;
+
+    while (*desc) {
+        while (*desc && SDL_isspace(*desc)) {
+            ++desc;
+        }
+        if (!*desc) {
+            break;
+        }
+
+        if (SDL_strncasecmp(desc, "file=", 5) == 0) {
+            char *end = desc + SDL_strlen(desc);
+            while (end > desc + 5 && SDL_isspace(end[-1])) {
+                --end;
+            }
+            *end = '\0';
+            config->path = SDL_strdup(desc + 5);
+            if (!config->path) {
+                return false;
+            }
+            break;
+        }
+
+        const char *token = desc;
+        while (*desc && !SDL_isspace(*desc)) {
+            ++desc;
+        }
+        if (*desc) {
+            *(desc++) = '\0';
+        }
+
+        if (num_tokens == 0) {
+            for (int i = 0; i < SDL_arraysize(DummyCameraFormats); ++i) {
+                if (SDL_strcasecmp(token, DummyCameraFormats[i].name) == 0) {
+                    spec->format = DummyCameraFormats[i].format;
+                    break;
+                }
+            }
+        } else if (num_tokens == 1) {
+            if (!ParseDeviceSize(token, spec)) {
+                return false;
+            }
+        } else if (SDL_strcasecmp(token, "free") == 0) {
+            config->free_run = true;
+        } else {
+            return false;
+        }
+        ++num_tokens;
+    }
+
+    if (spec->format == SDL_PIXELFORMAT_UNKNOWN || spec->width <= 0) {
+        return false;
+    }
+
+    switch (spec->format) {
+    case SDL_PIXELFORMAT_YUY2:
+        if (spec->width & 1) {
+            return false;
+        }
+        break;
+    case SDL_PIXELFORMAT_NV12:
+        if ((spec->width & 1) || (spec->height & 1)) {
+            return false;
+        }
+        break;
+    case SDL_PIXELFORMAT_MJPG:
+        if (spec->width > 0xFFFF || spec->height > 0xFFFF) {
+            return false;
+        }
+        break;
+    default:
+        break;
+    }
+
+    spec->colorspace = SDL_GetDefaultColorspaceForFormat(spec->format);
+    return true;
 }
 
 static void DUMMYCAMERA_DetectDevices(void)
 {
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_DUMMY_DEVICES);
+    if (!hint || !*hint) {
+        hint = DUMMY_DEFAULT_DEVICES;
+    }
+
+    char *devices = SDL_strdup(hint);
+    if (!devices) {
+        return;
+    }
+
+    int num_devices = 0;
+    char *desc = devices;
+    while (desc) {
+        char *next = SDL_strchr(desc, ',');
+        if (next) {
+            *(next++) = '\0';
+        }
+
+        DummyCameraDevice *config = (DummyCameraDevice *)SDL_calloc(1, sizeof(*config));
+        if (config) {
+            // invalid descriptions are skipped, there's nowhere to report them.
+            bool added = false;
+            if (ParseDevice(desc, config)) {
+                const SDL_CameraSpec *spec = &config->spec;
+                const char *format_name = "";
+                char name[128];
+
+                for (int i = 0; i < SDL_arraysize(DummyCameraFormats); ++i) {
+                    if (DummyCameraFormats[i].format == spec->format) {
+                        format_name = DummyCameraFormats[i].name;
+                        break;
+                    }
+                }
+                SDL_snprintf(name, sizeof(name), "Dummy Camera %d (%s %dx%d)", ++num_devices, format_name, spec->width, spec->height);
+                added = (SDL_AddCamera(name, SDL_CAMERA_POSITION_UNKNOWN, 1, spec, config) != NULL);
+            }
+            if (!added) {
+                SDL_free(config->path);
+                SDL_free(config);
+            }
+        }
+
+        desc = next;
+    }
+
+    SDL_free(devices);
 }
 
 static void DUMMYCAMERA_FreeDeviceHandle(SDL_Camera *device)
 {
+    DummyCameraDevice *config = (DummyCameraDevice *)device->handle;
+    if (config) {
+        SDL_free(config->path);
+        SDL_free(config);
+        device->handle = NULL;
+    }
 }
 
 static void DUMMYCAMERA_Deinitialize(void)
@@ -1279,3 +1279,26 @@
 #define SDL_SetAudioIterationCallbacks SDL_SetAudioIterationCallbacks_REAL
 #define SDL_GetEventDescription SDL_GetEventDescription_REAL
 #define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_SaveGamepadMappingsToIO SDL_SaveGamepadMappingsToIO_REAL
+#define SDL_WaitAtomicInt SDL_WaitAtomicInt_REAL
+#define SDL_WakeAtomicInt SDL_WakeAtomicInt_REAL
+#define SDL_CreateJobSystem SDL_CreateJobSystem_REAL
+#define SDL_GetJobSystemWorkers SDL_GetJobSystemWorkers_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJob SDL_WaitJob_REAL
+#define SDL_DetachJob SDL_DetachJob_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_DestroyJobSystem SDL_DestroyJobSystem_REAL
+#define SDL_OpenWAVStream_IO SDL_OpenWAVStream_IO_REAL
+#define SDL_OpenWAVStream SDL_OpenWAVStream_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_SetAudioStreamSingleProducer SDL_SetAudioStreamSingleProducer_REAL
+#define SDL_StepAudioDevice SDL_StepAudioDevice_REAL
+#define SDL_FlushLogMessages SDL_FlushLogMessages_REAL
+#define SDL_radixsort SDL_radixsort_REAL
+#define SDL_StartTracing SDL_StartTracing_REAL
+#define SDL_StopTracing SDL_StopTracing_REAL
+#define SDL_BeginTraceScope SDL_BeginTraceScope_REAL
+#define SDL_EndTraceScope SDL_EndTraceScope_REAL
+#define SDL_SaveTrace_IO SDL_SaveTrace_IO_REAL
+#define SDL_SaveTrace SDL_SaveTrace_REAL
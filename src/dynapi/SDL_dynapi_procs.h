@@ -1287,3 +1287,26 @@ SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamPlanarData,(SDL_AudioStream *a,const void
 SDL_DYNAPI_PROC(bool,SDL_SetAudioIterationCallbacks,(SDL_AudioDeviceID a,SDL_AudioIterationCallback b,SDL_AudioIterationCallback c,void *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_GetEventDescription,(const SDL_Event *a,char *b,int c),(a,b,c),return)
 SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a,const void *b,int c,SDL_AudioStreamDataCompleteCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_SaveGamepadMappingsToIO,(SDL_IOStream *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_WaitAtomicInt,(SDL_AtomicInt *a,int b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_WakeAtomicInt,(SDL_AtomicInt *a,bool b),(a,b),)
+SDL_DYNAPI_PROC(SDL_JobSystem*,SDL_CreateJobSystem,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetJobSystemWorkers,(SDL_JobSystem *a),(a),return)
+SDL_DYNAPI_PROC(SDL_Job*,SDL_SubmitJob,(SDL_JobSystem *a, SDL_JobCallback b, void *c, SDL_Job * const *d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJob,(SDL_Job *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DetachJob,(SDL_Job *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_ParallelFor,(SDL_JobSystem *a, int b, int c, int d, SDL_ParallelForCallback e, void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobSystem,(SDL_JobSystem *a),(a),)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream_IO,(SDL_IOStream *a, bool b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream,(const char *a, SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SeekWAVStream,(SDL_AudioStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamSingleProducer,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_StepAudioDevice,(SDL_AudioDeviceID a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_FlushLogMessages,(void),(),)
+SDL_DYNAPI_PROC(bool,SDL_radixsort,(void *a,size_t b,size_t c,size_t d,SDL_SortKeyType e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_StartTracing,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_StopTracing,(void),(),)
+SDL_DYNAPI_PROC(void,SDL_BeginTraceScope,(const char *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_EndTraceScope,(void),(),)
+SDL_DYNAPI_PROC(bool,SDL_SaveTrace_IO,(SDL_IOStream *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SaveTrace,(const char *a),(a),return)
@@ -131,10 +131,18 @@ typedef struct SDL_EventEntry
 {
     SDL_Event event;
     SDL_TemporaryMemory *memory;
+    int coalesce_slot;
     struct SDL_EventEntry *prev;
     struct SDL_EventEntry *next;
 } SDL_EventEntry;
 
+// The number of pending motion events that can be coalesced, must be a power of two
+#define SDL_COALESCE_SLOTS 64
+
+static bool SDL_coalesce_events;
+static bool SDL_coalesce_slots_used;  // true if anything may be in SDL_coalesce_slots
+static SDL_EventEntry *SDL_coalesce_slots[SDL_COALESCE_SLOTS];
+
 static struct
 {
     SDL_Mutex *lock;
@@ -430,6 +438,11 @@ static void SDLCALL SDL_EventLoggingChanged(void *userdata, const char *name, co
     SDL_EventLoggingVerbosity = (hint && *hint) ? SDL_clamp(SDL_atoi(hint), 0, 3) : 0;
 }
 
+static void SDLCALL SDL_EventCoalescingChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_coalesce_events = SDL_GetStringBoolean(hint, false);
+}
+
 int SDL_GetEventDescription(const SDL_Event *event, char *buf, int buflen)
 {
     if (!event) {
@@ -947,6 +960,8 @@ void SDL_StopEventLoop(void)
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
     SDL_SetAtomicInt(&SDL_sentinel_pending, 0);
+    SDL_zeroa(SDL_coalesce_slots);
+    SDL_coalesce_slots_used = false;
 
     // Clear disabled event state
     for (i = 0; i < SDL_arraysize(SDL_disabled_events); ++i) {
@@ -1005,13 +1020,108 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
+// Get the coalescing slot for an event, or -1 if the event can't be coalesced
+static int SDL_GetCoalesceSlot(const SDL_Event *event)
+{
+    Uint32 key[3];
+
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        key[1] = event->motion.which;
+        key[2] = event->motion.windowID;
+        break;
+    case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        key[1] = event->jaxis.which;
+        key[2] = event->jaxis.axis;
+        break;
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        key[1] = event->gaxis.which;
+        key[2] = event->gaxis.axis;
+        break;
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        key[1] = event->gsensor.which;
+        key[2] = (Uint32)event->gsensor.sensor;
+        break;
+    case SDL_EVENT_SENSOR_UPDATE:
+        key[1] = event->sensor.which;
+        key[2] = 0;
+        break;
+    default:
+        return -1;
+    }
+    key[0] = event->type;
+
+    return (int)(SDL_murmur3_32(key, sizeof(key), 0) & (SDL_COALESCE_SLOTS - 1));
+}
+
+// Check whether a queued event is for the same device and axis as a new one
+static bool SDL_IsSameCoalesceSource(const SDL_Event *queued, const SDL_Event *event)
+{
+    if (queued->type != event->type) {
+        return false;
+    }
+
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        return queued->motion.which == event->motion.which && queued->motion.windowID == event->motion.windowID;
+    case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        return queued->jaxis.which == event->jaxis.which && queued->jaxis.axis == event->jaxis.axis;
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        return queued->gaxis.which == event->gaxis.which && queued->gaxis.axis == event->gaxis.axis;
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        return queued->gsensor.which == event->gsensor.which && queued->gsensor.sensor == event->gsensor.sensor;
+    case SDL_EVENT_SENSOR_UPDATE:
+        return queued->sensor.which == event->sensor.which;
+    default:
+        return false;
+    }
+}
+
+/* Replace a motion event that hasn't been consumed yet with a newer one for the same source,
+   keeping its place in the queue -- called with the queue locked */
+static bool SDL_CoalesceEvent(SDL_Event *event, int slot)
+{
+    SDL_EventEntry *entry = SDL_coalesce_slots[slot];
+
+    if (!entry || !SDL_IsSameCoalesceSource(&entry->event, event)) {
+        return false;
+    }
+
+    if (event->type == SDL_EVENT_MOUSE_MOTION) {
+        // Relative motion is accumulated so no movement is lost
+        const float xrel = entry->event.motion.xrel + event->motion.xrel;
+        const float yrel = entry->event.motion.yrel + event->motion.yrel;
+        SDL_copyp(&entry->event, event);
+        entry->event.motion.xrel = xrel;
+        entry->event.motion.yrel = yrel;
+    } else {
+        SDL_copyp(&entry->event, event);
+    }
+
+    if (SDL_EventLoggingVerbosity > 0) {
+        SDL_LogEvent(event);
+    }
+    return true;
+}
+
 // Add an event to the event queue -- called with the queue locked
 static int SDL_AddEvent(SDL_Event *event)
 {
     SDL_EventEntry *entry;
     const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
+    const int coalesce_slot = SDL_coalesce_events ? SDL_GetCoalesceSlot(event) : -1;
     int final_count;
 
+    if (coalesce_slot >= 0 && SDL_CoalesceEvent(event, coalesce_slot)) {
+        ++SDL_last_event_id;
+        return 1;
+    }
+    if (coalesce_slot < 0 && SDL_coalesce_slots_used && event->type != SDL_EVENT_POLL_SENTINEL) {
+        // Motion can't be moved past other events, e.g. a mouse button press has to see the position before it
+        SDL_zeroa(SDL_coalesce_slots);
+        SDL_coalesce_slots_used = false;
+    }
+
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
@@ -1038,6 +1148,13 @@ static int SDL_AddEvent(SDL_Event *event)
     entry->memory = NULL;
     SDL_TransferTemporaryMemoryToEvent(entry);
 
+    entry->coalesce_slot = coalesce_slot;
+    if (coalesce_slot >= 0) {
+        // This replaces any older event in the slot, which just won't be coalesced anymore
+        SDL_coalesce_slots[coalesce_slot] = entry;
+        SDL_coalesce_slots_used = true;
+    }
+
     if (SDL_EventQ.tail) {
         SDL_EventQ.tail->next = entry;
         entry->prev = SDL_EventQ.tail;
@@ -1066,6 +1183,10 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
 {
     SDL_TransferTemporaryMemoryFromEvent(entry);
 
+    if (entry->coalesce_slot >= 0 && SDL_coalesce_slots[entry->coalesce_slot] == entry) {
+        SDL_coalesce_slots[entry->coalesce_slot] = NULL;
+    }
+
     if (entry->prev) {
         entry->prev->next = entry->next;
     }
@@ -1453,6 +1574,8 @@ void SDL_PumpEventMaintenance(void)
 // Run the system dependent event loops
 static void SDL_PumpEventsInternal(bool push_sentinel)
 {
+    SDL_TRACE_BEGIN("SDL_PumpEvents");
+
     // Free any temporary memory from old events
     SDL_FreeTemporaryMemory();
 
@@ -1487,6 +1610,8 @@ static void SDL_PumpEventsInternal(bool push_sentinel)
         sentinel.common.timestamp = 0;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_END();
 }
 
 void SDL_PumpEvents(void)
@@ -1962,9 +2087,11 @@ bool SDL_InitEvents(void)
     SDL_AddHintCallback(SDL_HINT_AUTO_UPDATE_SENSORS, SDL_AutoUpdateSensorsChanged, NULL);
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     SDL_InitMainThreadCallbacks();
     if (!SDL_StartEventLoop()) {
+        SDL_RemoveHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
         SDL_RemoveHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return false;
     }
@@ -1980,6 +2107,7 @@ void SDL_QuitEvents(void)
     SDL_StopEventLoop();
     SDL_QuitMainThreadCallbacks();
     SDL_RemoveHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_RemoveHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
     SDL_RemoveHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #ifndef SDL_JOYSTICK_DISABLED
     SDL_RemoveHintCallback(SDL_HINT_AUTO_UPDATE_JOYSTICKS, SDL_AutoUpdateJoysticksChanged, NULL);
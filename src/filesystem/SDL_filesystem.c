@@ -114,14 +114,31 @@ bool SDL_CreateDirectory(const char *path)
     return retval;
 }
 
+typedef struct EnumerateDirectoryData
+{
+    SDL_EnumerateDirectoryCallback callback;
+    void *userdata;
+} EnumerateDirectoryData;
+
+static SDL_EnumerationResult SDLCALL EnumerateDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
+{
+    const EnumerateDirectoryData *data = (const EnumerateDirectoryData *)userdata;
+    return data->callback(data->userdata, dirname, fname);
+}
+
 bool SDL_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata)
 {
+    EnumerateDirectoryData data;
+
     if (!path) {
         return SDL_InvalidParamError("path");
     } else if (!callback) {
         return SDL_InvalidParamError("callback");
     }
-    return SDL_SYS_EnumerateDirectory(path, callback, userdata);
+
+    data.callback = callback;
+    data.userdata = userdata;
+    return SDL_SYS_EnumerateDirectory(path, EnumerateDirectoryCallback, &data);
 }
 
 bool SDL_GetPathInfo(const char *path, SDL_PathInfo *info)
@@ -243,19 +260,14 @@ static size_t EncodeCodepointToUtf8(char *ptr, Uint32 cp, size_t remaining)
     return 0;
 }
 
-static char *CaseFoldUtf8String(const char *fname)
+// Casefolds `str` into `dst`, which needs room for (SDL_strlen(str) + 1) * 3 * 4 bytes in the worst case.
+// Returns the length of the folded string, not counting the null terminator.
+static size_t CaseFoldUtf8Into(char *dst, size_t allocation, const char *str)
 {
-    SDL_assert(fname != NULL);
-    const size_t allocation = (SDL_strlen(fname) + 1) * 3 * 4;
-    char *result = (char *) SDL_malloc(allocation);  // lazy: just allocating the max needed.
-    if (!result) {
-        return NULL;
-    }
-
     Uint32 codepoint;
-    char *ptr = result;
+    char *ptr = dst;
     size_t remaining = allocation;
-    while ((codepoint = SDL_StepUTF8(&fname, NULL)) != 0) {
+    while ((codepoint = SDL_StepUTF8(&str, NULL)) != 0) {
         Uint32 folded[3];
         const int num_folded = SDL_CaseFoldUnicode(codepoint, folded);
         SDL_assert(num_folded > 0);
@@ -271,12 +283,23 @@ static char *CaseFoldUtf8String(const char *fname)
     }
 
     SDL_assert(remaining > 0);
-    remaining--;
     *ptr = '\0';
 
-    if (remaining > 0) {
-        SDL_assert(allocation > remaining);
-        ptr = (char *)SDL_realloc(result, allocation - remaining);  // shrink it down.
+    return (size_t)(ptr - dst);
+}
+
+static char *CaseFoldUtf8String(const char *fname)
+{
+    SDL_assert(fname != NULL);
+    const size_t allocation = (SDL_strlen(fname) + 1) * 3 * 4;
+    char *result = (char *) SDL_malloc(allocation);  // lazy: just allocating the max needed.
+    if (!result) {
+        return NULL;
+    }
+
+    const size_t len = CaseFoldUtf8Into(result, allocation, fname);
+    if ((len + 1) < allocation) {
+        char *ptr = (char *)SDL_realloc(result, len + 1);  // shrink it down.
         if (ptr) {  // shouldn't fail, but if it does, `result` is still valid.
             result = ptr;
         }
@@ -297,9 +320,36 @@ typedef struct GlobDirCallbackData
     void *fsuserdata;
     size_t basedirlen;
     SDL_IOStream *string_stream;
+
+    // The path of the directory being enumerated. Entries are pushed onto the end of it as we walk the tree.
+    char *path;
+    size_t path_allocation;
+    size_t dirlen;  // includes the path separator at the end.
+
+    // The same thing casefolded, relative to the base directory, for SDL_GLOB_CASEINSENSITIVE.
+    char *folded;
+    size_t folded_allocation;
+    size_t folded_dirlen;
 } GlobDirCallbackData;
 
-static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+static bool GlobReserveBuffer(char **buffer, size_t *allocation, size_t needed)
+{
+    if (needed > *allocation) {
+        size_t newsize = *allocation ? *allocation : 256;
+        while (newsize < needed) {
+            newsize *= 2;
+        }
+        char *ptr = (char *)SDL_realloc(*buffer, newsize);
+        if (!ptr) {
+            return false;
+        }
+        *buffer = ptr;
+        *allocation = newsize;
+    }
+    return true;
+}
+
+static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
 {
     SDL_assert(userdata != NULL);
     SDL_assert(dirname != NULL);
@@ -308,33 +358,43 @@ static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const
     //SDL_Log("GlobDirectoryCallback('%s', '%s')", dirname, fname);
 
     GlobDirCallbackData *data = (GlobDirCallbackData *) userdata;
+    const size_t dirlen = data->dirlen;
+    const size_t folded_dirlen = data->folded_dirlen;
+    const size_t fnamelen = SDL_strlen(fname);
 
-    // !!! FIXME: if we're careful, we can keep a single buffer in `data` that we push and pop paths off the end of as we walk the tree,
-    // !!! FIXME: and only casefold the new pieces instead of allocating and folding full paths for all of this.
-
-    char *fullpath = NULL;
-    if (SDL_asprintf(&fullpath, "%s%s", dirname, fname) < 0) {
+    // push this entry onto the end of the current directory's path.
+    if (!GlobReserveBuffer(&data->path, &data->path_allocation, dirlen + fnamelen + 2)) {  // +2 for a path separator and null terminator.
         return SDL_ENUM_FAILURE;
     }
+    if (dirlen > 0) {
+        data->path[dirlen - 1] = dirname[dirlen - 1];  // use the same path separator that the enumerator did.
+    }
+    SDL_memcpy(data->path + dirlen, fname, fnamelen + 1);
+    const size_t pathlen = dirlen + fnamelen;
 
-    char *folded = NULL;
+    const char *matchpath = data->path + data->basedirlen;
+    size_t foldedlen = 0;
     if (data->flags & SDL_GLOB_CASEINSENSITIVE) {
-        folded = CaseFoldUtf8String(fullpath);
-        if (!folded) {
+        // everything up to this entry was folded on the way down, so we only have to fold the new piece.
+        const size_t fold_allocation = (fnamelen + 1) * 3 * 4;
+        if (!GlobReserveBuffer(&data->folded, &data->folded_allocation, folded_dirlen + fold_allocation + 1)) {
             return SDL_ENUM_FAILURE;
         }
+        if (folded_dirlen > 0) {
+            data->folded[folded_dirlen - 1] = dirname[dirlen - 1];
+        }
+        foldedlen = folded_dirlen + CaseFoldUtf8Into(data->folded + folded_dirlen, fold_allocation, fname);
+        matchpath = data->folded;
     }
 
     bool matched_to_dir = false;
-    const bool matched = data->matcher(data->pattern, (folded ? folded : fullpath) + data->basedirlen, &matched_to_dir);
-    //SDL_Log("GlobDirectoryCallback: Considered %spath='%s' vs pattern='%s': %smatched (matched_to_dir=%s)", folded ? "(folded) " : "", (folded ? folded : fullpath) + data->basedirlen, data->pattern, matched ? "" : "NOT ", matched_to_dir ? "TRUE" : "FALSE");
-    SDL_free(folded);
+    const bool matched = data->matcher(data->pattern, matchpath, &matched_to_dir);
+    //SDL_Log("GlobDirectoryCallback: Considered %spath='%s' vs pattern='%s': %smatched (matched_to_dir=%s)", (data->flags & SDL_GLOB_CASEINSENSITIVE) ? "(folded) " : "", matchpath, data->pattern, matched ? "" : "NOT ", matched_to_dir ? "TRUE" : "FALSE");
 
     if (matched) {
-        const char *subpath = fullpath + data->basedirlen;
-        const size_t slen = SDL_strlen(subpath) + 1;
+        const char *subpath = data->path + data->basedirlen;
+        const size_t slen = (pathlen - data->basedirlen) + 1;
         if (SDL_WriteIO(data->string_stream, subpath, slen) != slen) {
-            SDL_free(fullpath);
             return SDL_ENUM_FAILURE;  // stop enumerating, return failure to the app.
         }
         data->num_entries++;
@@ -342,17 +402,24 @@ static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const
 
     SDL_EnumerationResult result = SDL_ENUM_CONTINUE;  // keep enumerating by default.
     if (matched_to_dir) {
-        SDL_PathInfo info;
-        if (data->getpathinfo(fullpath, &info, data->fsuserdata) && (info.type == SDL_PATHTYPE_DIRECTORY)) {
+        // only ask the filesystem if the enumerator couldn't tell us what this is.
+        bool isdir = (type == SDL_PATHTYPE_DIRECTORY);
+        if (type == SDL_PATHTYPE_NONE) {
+            SDL_PathInfo info;
+            isdir = (data->getpathinfo(data->path, &info, data->fsuserdata) && (info.type == SDL_PATHTYPE_DIRECTORY));
+        }
+        if (isdir) {
             //SDL_Log("GlobDirectoryCallback: Descending into subdir '%s'", fname);
-            if (!data->enumerator(fullpath, GlobDirectoryCallback, data, data->fsuserdata)) {
+            data->dirlen = pathlen + 1;
+            data->folded_dirlen = foldedlen + 1;
+            if (!data->enumerator(data->path, GlobDirectoryCallback, data, data->fsuserdata)) {
                 result = SDL_ENUM_FAILURE;
             }
+            data->dirlen = dirlen;  // pop back out to the directory we're enumerating.
+            data->folded_dirlen = folded_dirlen;
         }
     }
 
-    SDL_free(fullpath);
-
     return result;
 }
 
@@ -423,7 +490,25 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
     data.enumerator = enumerator;
     data.getpathinfo = getpathinfo;
     data.fsuserdata = userdata;
-    data.basedirlen = *path ? (SDL_strlen(path) + 1) : 0;  // +1 for the '/' we'll be adding.
+
+    // start the path buffer off with the base directory, with a path separator at the end.
+    pathlen = SDL_strlen(path);
+    data.basedirlen = pathlen;
+    if ((pathlen > 0) && (path[pathlen-1] != '/') && (path[pathlen-1] != '\\')) {
+        data.basedirlen++;  // +1 for the '/' we'll be adding.
+    }
+    data.dirlen = data.basedirlen;
+    if (!GlobReserveBuffer(&data.path, &data.path_allocation, data.basedirlen + 1)) {
+        SDL_CloseIO(data.string_stream);
+        SDL_free(folded);
+        SDL_free(pathcpy);
+        return NULL;
+    }
+    SDL_memcpy(data.path, path, pathlen);
+    if (data.basedirlen > pathlen) {
+        data.path[pathlen] = '/';
+    }
+    data.path[data.basedirlen] = '\0';
 
 
     char **result = NULL;
@@ -449,6 +534,8 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
     }
 
     SDL_CloseIO(data.string_stream);
+    SDL_free(data.path);
+    SDL_free(data.folded);
     SDL_free(folded);
     SDL_free(pathcpy);
 
@@ -460,9 +547,9 @@ static bool GlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void
     return SDL_GetPathInfo(path, info);
 }
 
-static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+static bool GlobDirectoryEnumerator(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
 {
-    return SDL_EnumerateDirectory(path, cb, cbuserdata);
+    return SDL_SYS_EnumerateDirectory(path, cb, cbuserdata);
 }
 
 char **SDL_GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
@@ -28,14 +28,18 @@ extern char *SDL_SYS_GetPrefPath(const char *org, const char *app);
 extern char *SDL_SYS_GetUserFolder(SDL_Folder folder);
 extern char *SDL_SYS_GetCurrentDirectory(void);
 
-extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata);
+// Like SDL_EnumerateDirectoryCallback, but also gets the type of each entry when the OS reports it for free, SDL_PATHTYPE_NONE otherwise.
+typedef SDL_EnumerationResult (SDLCALL *SDL_SYS_EnumerateDirectoryCallback)(void *userdata, const char *dirname, const char *fname, SDL_PathType type);
+
+extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *userdata);
 extern bool SDL_SYS_RemovePath(const char *path);
 extern bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath);
 extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath);
 extern bool SDL_SYS_CreateDirectory(const char *path);
 extern bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info);
 
-typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
+// Globbing reuses the memory behind `path` while walking the tree, so enumerators must not look at it after their first callback.
+typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
 typedef bool (*SDL_GlobGetPathInfoFunc)(const char *path, SDL_PathInfo *info, void *userdata);
 extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata);
 
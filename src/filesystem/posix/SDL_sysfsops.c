@@ -32,10 +32,14 @@
 #include <string.h>
 #include <errno.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#ifdef HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *userdata)
 {
     char *pathwithsep = NULL;
     int pathwithseplen = SDL_asprintf(&pathwithsep, "%s/", path);
@@ -66,7 +70,17 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         if ((SDL_strcmp(name, ".") == 0) || (SDL_strcmp(name, "..") == 0)) {
             continue;
         }
-        result = cb(userdata, pathwithsep, name);
+        SDL_PathType type = SDL_PATHTYPE_NONE;  // symlinks and filesystems without d_type need a stat() by the caller.
+#ifdef DT_DIR
+        if (ent->d_type == DT_DIR) {
+            type = SDL_PATHTYPE_DIRECTORY;
+        } else if (ent->d_type == DT_REG) {
+            type = SDL_PATHTYPE_FILE;
+        } else if ((ent->d_type != DT_UNKNOWN) && (ent->d_type != DT_LNK)) {
+            type = SDL_PATHTYPE_OTHER;
+        }
+#endif
+        result = cb(userdata, pathwithsep, name, type);
     }
 
     closedir(dir);
@@ -97,7 +111,12 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+// Copy through SDL_IOStream, which understands paths that open() doesn't, like Android assets and content:// URIs
+static bool CopyFileWithIOStreams(const char *oldpath, const char *newpath)
 {
     char *buffer = NULL;
     SDL_IOStream *input = NULL;
@@ -152,6 +171,150 @@ done:
     return result;
 }
 
+#ifndef SDL_PLATFORM_ANDROID
+// Buffer size used when the kernel can't copy the file for us
+#define COPY_BUFFER_SIZE (1024 * 1024)
+
+#ifdef HAVE_COPY_FILE_RANGE
+// Returns true if the copy should be retried with a slower method
+static bool CopyFallbackNeeded(int err)
+{
+    return (err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP || err == EPERM || err == EBADF);
+}
+#endif
+
+// Copy `size` bytes, or until EOF, from the current position of `in` to `out`
+static bool CopyFileContents(int in, int out, off_t size)
+{
+    Uint8 *buffer;
+    off_t remaining = size;
+
+#ifdef HAVE_COPY_FILE_RANGE
+    // This lets the filesystem clone the data or copy it without it ever leaving the kernel
+    while (remaining > 0) {
+        const size_t count = (size_t)SDL_min(remaining, (off_t)SDL_MAX_SINT32);
+        const ssize_t rc = copy_file_range(in, NULL, out, NULL, count, 0);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if (CopyFallbackNeeded(errno)) {
+                break;
+            }
+            return SDL_SetError("Can't copy file: %s", strerror(errno));
+        } else if (rc == 0) {
+            break;
+        }
+        remaining -= rc;
+    }
+#endif
+
+#ifdef HAVE_SENDFILE
+    while (remaining > 0) {
+        const size_t count = (size_t)SDL_min(remaining, (off_t)SDL_MAX_SINT32);
+        const ssize_t rc = sendfile(out, in, NULL, count);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if (errno == EINVAL || errno == ENOSYS) {
+                break;
+            }
+            return SDL_SetError("Can't copy file: %s", strerror(errno));
+        } else if (rc == 0) {
+            break;
+        }
+        remaining -= rc;
+    }
+#endif
+
+    (void)remaining;
+
+    // Copy whatever is left, which is everything if the kernel couldn't do it for us.
+    buffer = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), COPY_BUFFER_SIZE);
+    if (!buffer) {
+        return false;
+    }
+    for (;;) {
+        ssize_t len = read(in, buffer, COPY_BUFFER_SIZE);
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SDL_aligned_free(buffer);
+            return SDL_SetError("Can't read file: %s", strerror(errno));
+        } else if (len == 0) {
+            break;
+        }
+
+        ssize_t written = 0;
+        while (written < len) {
+            const ssize_t rc = write(out, buffer + written, (size_t)(len - written));
+            if (rc < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                SDL_aligned_free(buffer);
+                return SDL_SetError("Can't write file: %s", strerror(errno));
+            }
+            written += rc;
+        }
+    }
+    SDL_aligned_free(buffer);
+
+    return true;
+}
+#endif // !SDL_PLATFORM_ANDROID
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+{
+#ifdef SDL_PLATFORM_ANDROID
+    // Paths may be relative to internal storage, APK assets or content:// URIs, which only SDL_IOFromFile() handles
+    return CopyFileWithIOStreams(oldpath, newpath);
+#else
+    struct stat statbuf;
+    int input = -1;
+    int output = -1;
+    bool result = false;
+
+    // Copy between file descriptors when both paths are plain files, otherwise let SDL_IOStream sort it out
+    input = open(oldpath, O_RDONLY | O_CLOEXEC);
+    if (input < 0) {
+        return CopyFileWithIOStreams(oldpath, newpath);
+    }
+
+    if (fstat(input, &statbuf) < 0) {
+        SDL_SetError("Can't stat %s: %s", oldpath, strerror(errno));
+        goto done;
+    }
+
+    output = open(newpath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (output < 0) {
+        close(input);
+        return CopyFileWithIOStreams(oldpath, newpath);
+    }
+
+    // Only regular files report a size we can hand to the kernel; anything else is read until EOF.
+    if (!CopyFileContents(input, output, S_ISREG(statbuf.st_mode) ? statbuf.st_size : 0)) {
+        goto done;
+    }
+
+    result = (close(output) == 0);
+    if (!result) {
+        SDL_SetError("Can't close %s: %s", newpath, strerror(errno));
+    }
+    output = -1;  // it's gone, even if it failed.
+
+done:
+    if (output >= 0) {
+        close(output);
+    }
+    if (input >= 0) {
+        close(input);
+    }
+
+    return result;
+#endif // SDL_PLATFORM_ANDROID
+}
+
 bool SDL_SYS_CreateDirectory(const char *path)
 {
     const int rc = mkdir(path, 0770);
@@ -29,7 +29,7 @@
 #include "../../core/windows/SDL_windows.h"
 #include "../SDL_sysfilesystem.h"
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *userdata)
 {
     SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
     if (*path == '\0') {  // if empty (completely at the root), we need to enumerate drive letters.
@@ -38,7 +38,7 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         for (int i = 'A'; (result == SDL_ENUM_CONTINUE) && (i <= 'Z'); i++) {
             if (drives & (1 << (i - 'A'))) {
                 name[0] = (char) i;
-                result = cb(userdata, "", name);
+                result = cb(userdata, "", name, SDL_PATHTYPE_DIRECTORY);
             }
         }
     } else {
@@ -89,7 +89,14 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
             if (!utf8fn) {
                 result = SDL_ENUM_FAILURE;
             } else {
-                result = cb(userdata, pattern, utf8fn);
+                // classify this the same way SDL_SYS_GetPathInfo() would.
+                SDL_PathType type = SDL_PATHTYPE_FILE;
+                if (entw.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                    type = SDL_PATHTYPE_DIRECTORY;
+                } else if (entw.dwFileAttributes & (FILE_ATTRIBUTE_OFFLINE | FILE_ATTRIBUTE_DEVICE)) {
+                    type = SDL_PATHTYPE_OTHER;
+                }
+                result = cb(userdata, pattern, utf8fn, type);
                 SDL_free(utf8fn);
             }
         } while ((result == SDL_ENUM_CONTINUE) && (FindNextFileW(dir, &entw) != 0));
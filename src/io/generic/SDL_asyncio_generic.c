@@ -66,6 +66,8 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
 {
     SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
 
+    SDL_TRACE_BEGIN("SynchronousIO");
+
     GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
     SDL_IOStream *io = data->io;
     const size_t size = (size_t) task->requested_size;
@@ -103,6 +105,8 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
     SDL_UnlockMutex(data->lock);
 
     AsyncIOTaskComplete(task);
+
+    SDL_TRACE_END();
 }
 
 #if SDL_ASYNCIO_USE_THREADPOOL
@@ -75,6 +75,9 @@ typedef enum
     SDL_GAMEPAD_MAPPING_PRIORITY_USER,
 } SDL_GamepadMappingPriority;
 
+// The number of hash buckets used to look up mappings by GUID, must be a power of two
+#define SDL_GAMEPAD_MAPPING_BUCKETS 1024
+
 #define _guarded SDL_GUARDED_BY(SDL_joystick_lock)
 
 typedef struct GamepadMapping_t
@@ -82,8 +85,11 @@ typedef struct GamepadMapping_t
     SDL_GUID guid _guarded;
     char *name _guarded;
     char *mapping _guarded;
+    Uint16 crc _guarded;  // the value of the crc: field in the mapping, if has_crc is set
+    bool has_crc _guarded;
     SDL_GamepadMappingPriority priority _guarded;
     struct GamepadMapping_t *next _guarded;
+    struct GamepadMapping_t *next_in_bucket _guarded;
 } GamepadMapping_t;
 
 typedef struct
@@ -101,6 +107,8 @@ typedef struct
 
 static SDL_GUID s_zeroGUID;
 static GamepadMapping_t *s_pSupportedGamepads SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static GamepadMapping_t *s_pSupportedGamepadsTail SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static GamepadMapping_t *s_pMappingBuckets[SDL_GAMEPAD_MAPPING_BUCKETS] SDL_GUARDED_BY(SDL_joystick_lock);
 static GamepadMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static MappingChangeTracker *s_mappingChangeTracker SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
@@ -916,6 +924,18 @@ static GamepadMapping_t *SDL_CreateMappingForWGIGamepad(SDL_GUID guid)
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT);
 }
 
+/*
+ * Helper function to find the hash bucket for mappings with the specified GUID
+ */
+static GamepadMapping_t **SDL_PrivateGetMappingBucket(SDL_GUID guid)
+{
+    // Mappings never include the CRC in the GUID and may be matched without the version
+    SDL_SetJoystickGUIDCRC(&guid, 0);
+    SDL_SetJoystickGUIDVersion(&guid, 0);
+
+    return &s_pMappingBuckets[SDL_murmur3_32(&guid, sizeof(guid), 0) & (SDL_GAMEPAD_MAPPING_BUCKETS - 1)];
+}
+
 /*
  * Helper function to scan the mappings database for a gamepad with the specified GUID
  */
@@ -935,23 +955,18 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
         SDL_SetJoystickGUIDVersion(&guid, 0);
     }
 
-    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
+    // The bucket holds the mappings in the order they were added, so this finds the same match as walking the whole list
+    for (mapping = *SDL_PrivateGetMappingBucket(guid); mapping; mapping = mapping->next_in_bucket) {
         SDL_GUID mapping_guid;
 
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
-            continue;
-        }
-
         SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
         if (!match_version) {
             SDL_SetJoystickGUIDVersion(&mapping_guid, 0);
         }
 
         if (SDL_memcmp(&guid, &mapping_guid, sizeof(guid)) == 0) {
-            const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
-            if (crc_string) {
-                Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
-                if (mapping_crc != crc) {
+            if (mapping->has_crc) {
+                if (mapping->crc != crc) {
                     // This mapping specified a CRC and they don't match
                     continue;
                 }
@@ -1663,6 +1678,84 @@ static char *SDL_PrivateGetGamepadMappingFromMappingString(const char *pMapping)
     return result;
 }
 
+/*
+ * Helper function to add an already parsed mapping for a guid, taking ownership of the name and mapping
+ */
+static GamepadMapping_t *SDL_PrivateInsertMapping(SDL_GUID jGUID, char *pchName, char *pchMapping, bool has_crc, Uint16 crc, bool *existing, SDL_GamepadMappingPriority priority)
+{
+    GamepadMapping_t *pGamepadMapping;
+
+    SDL_AssertJoysticksLocked();
+
+    PushMappingChangeTracking();
+
+    pGamepadMapping = SDL_PrivateGetGamepadMappingForGUID(jGUID, true);
+    if (pGamepadMapping) {
+        // Only overwrite the mapping if the priority is the same or higher.
+        if (pGamepadMapping->priority <= priority) {
+            // Update existing mapping
+            SDL_free(pGamepadMapping->name);
+            pGamepadMapping->name = pchName;
+            SDL_free(pGamepadMapping->mapping);
+            pGamepadMapping->mapping = pchMapping;
+            pGamepadMapping->crc = crc;
+            pGamepadMapping->has_crc = has_crc;
+            pGamepadMapping->priority = priority;
+        } else {
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+        }
+        if (existing) {
+            *existing = true;
+        }
+        AddMappingChangeTracking(pGamepadMapping);
+    } else {
+        pGamepadMapping = (GamepadMapping_t *)SDL_malloc(sizeof(*pGamepadMapping));
+        if (!pGamepadMapping) {
+            PopMappingChangeTracking();
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+            return NULL;
+        }
+        // Clear the CRC, we've already added it to the mapping
+        if (crc) {
+            SDL_SetJoystickGUIDCRC(&jGUID, 0);
+        }
+        pGamepadMapping->guid = jGUID;
+        pGamepadMapping->name = pchName;
+        pGamepadMapping->mapping = pchMapping;
+        pGamepadMapping->crc = crc;
+        pGamepadMapping->has_crc = has_crc;
+        pGamepadMapping->next = NULL;
+        pGamepadMapping->next_in_bucket = NULL;
+        pGamepadMapping->priority = priority;
+
+        // Add the mapping to the end of the list
+        if (s_pSupportedGamepadsTail) {
+            s_pSupportedGamepadsTail->next = pGamepadMapping;
+        } else {
+            s_pSupportedGamepads = pGamepadMapping;
+        }
+        s_pSupportedGamepadsTail = pGamepadMapping;
+
+        // Add the mapping to the end of its hash bucket, mappings without a GUID are never looked up
+        if (SDL_memcmp(&jGUID, &s_zeroGUID, sizeof(jGUID)) != 0) {
+            GamepadMapping_t **ppBucketMapping = SDL_PrivateGetMappingBucket(jGUID);
+            while (*ppBucketMapping) {
+                ppBucketMapping = &(*ppBucketMapping)->next_in_bucket;
+            }
+            *ppBucketMapping = pGamepadMapping;
+        }
+        if (existing) {
+            *existing = false;
+        }
+    }
+
+    PopMappingChangeTracking();
+
+    return pGamepadMapping;
+}
+
 /*
  * Helper function to add a mapping for a guid
  */
@@ -1670,7 +1763,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
 {
     char *pchName;
     char *pchMapping;
-    GamepadMapping_t *pGamepadMapping;
+    bool has_crc = false;
     Uint16 crc;
 
     SDL_AssertJoysticksLocked();
@@ -1691,6 +1784,8 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
     // Fix up the GUID and the mapping with the CRC, if needed
     SDL_GetJoystickGUIDInfo(jGUID, NULL, NULL, NULL, &crc);
     if (crc) {
+        has_crc = true;
+
         // Make sure the mapping has the CRC
         char *new_mapping;
         const char *optional_comma;
@@ -1723,6 +1818,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         // Make sure the GUID has the CRC, for matching purposes
         char *crc_string = SDL_strstr(pchMapping, SDL_GAMEPAD_CRC_FIELD);
         if (crc_string) {
+            has_crc = true;
             crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
             if (crc) {
                 SDL_SetJoystickGUIDCRC(&jGUID, crc);
@@ -1730,65 +1826,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         }
     }
 
-    PushMappingChangeTracking();
-
-    pGamepadMapping = SDL_PrivateGetGamepadMappingForGUID(jGUID, true);
-    if (pGamepadMapping) {
-        // Only overwrite the mapping if the priority is the same or higher.
-        if (pGamepadMapping->priority <= priority) {
-            // Update existing mapping
-            SDL_free(pGamepadMapping->name);
-            pGamepadMapping->name = pchName;
-            SDL_free(pGamepadMapping->mapping);
-            pGamepadMapping->mapping = pchMapping;
-            pGamepadMapping->priority = priority;
-        } else {
-            SDL_free(pchName);
-            SDL_free(pchMapping);
-        }
-        if (existing) {
-            *existing = true;
-        }
-        AddMappingChangeTracking(pGamepadMapping);
-    } else {
-        pGamepadMapping = (GamepadMapping_t *)SDL_malloc(sizeof(*pGamepadMapping));
-        if (!pGamepadMapping) {
-            PopMappingChangeTracking();
-            SDL_free(pchName);
-            SDL_free(pchMapping);
-            return NULL;
-        }
-        // Clear the CRC, we've already added it to the mapping
-        if (crc) {
-            SDL_SetJoystickGUIDCRC(&jGUID, 0);
-        }
-        pGamepadMapping->guid = jGUID;
-        pGamepadMapping->name = pchName;
-        pGamepadMapping->mapping = pchMapping;
-        pGamepadMapping->next = NULL;
-        pGamepadMapping->priority = priority;
-
-        if (s_pSupportedGamepads) {
-            // Add the mapping to the end of the list
-            GamepadMapping_t *pCurrMapping, *pPrevMapping;
-
-            for (pPrevMapping = s_pSupportedGamepads, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                // continue;
-            }
-            pPrevMapping->next = pGamepadMapping;
-        } else {
-            s_pSupportedGamepads = pGamepadMapping;
-        }
-        if (existing) {
-            *existing = false;
-        }
-    }
-
-    PopMappingChangeTracking();
-
-    return pGamepadMapping;
+    return SDL_PrivateInsertMapping(jGUID, pchName, pchMapping, has_crc, crc, existing, priority);
 }
 
 /*
@@ -1938,6 +1976,119 @@ static GamepadMapping_t *SDL_PrivateGetGamepadMapping(SDL_JoystickID instance_id
     return mapping;
 }
 
+/*
+ * The binary mappings database, all values are little endian:
+ *
+ *   header:  "SDLGPDB" + '\0', Uint32 SDL version, Uint32 mapping count, Uint32 string table size, Uint32 platform offset
+ *   records: SDL_GUID guid (without CRC), Uint16 crc, Uint16 flags, Uint32 name offset, Uint32 mapping offset
+ *   strings: NUL terminated strings, referenced by offset
+ */
+#define SDL_GAMEPAD_DB_MAGIC       "SDLGPDB"
+#define SDL_GAMEPAD_DB_HEADER_SIZE 24
+#define SDL_GAMEPAD_DB_RECORD_SIZE 28
+
+#define SDL_GAMEPAD_DB_FLAG_CRC     0x01
+#define SDL_GAMEPAD_DB_FLAG_DEFAULT 0x02
+#define SDL_GAMEPAD_DB_FLAG_XINPUT  0x04
+
+static Uint16 SDL_PrivateReadGamepadDB16(const Uint8 *data)
+{
+    Uint16 value;
+    SDL_memcpy(&value, data, sizeof(value));
+    return SDL_Swap16LE(value);
+}
+
+static Uint32 SDL_PrivateReadGamepadDB32(const Uint8 *data)
+{
+    Uint32 value;
+    SDL_memcpy(&value, data, sizeof(value));
+    return SDL_Swap32LE(value);
+}
+
+static bool SDL_PrivateIsGamepadDB(const Uint8 *db, size_t db_size)
+{
+    return db_size >= SDL_GAMEPAD_DB_HEADER_SIZE && SDL_memcmp(db, SDL_GAMEPAD_DB_MAGIC, sizeof(SDL_GAMEPAD_DB_MAGIC)) == 0;
+}
+
+/*
+ * Add the entries of a binary mappings database, which need no parsing
+ */
+static int SDL_PrivateAddGamepadMappingsFromDB(const Uint8 *db, size_t db_size)
+{
+    const Uint8 *record;
+    const char *strings;
+    Uint32 i, num_mappings, strings_size;
+    int gamepads = 0;
+
+    SDL_AssertJoysticksLocked();
+
+    num_mappings = SDL_PrivateReadGamepadDB32(db + 12);
+    strings_size = SDL_PrivateReadGamepadDB32(db + 16);
+    if (num_mappings > (db_size - SDL_GAMEPAD_DB_HEADER_SIZE) / SDL_GAMEPAD_DB_RECORD_SIZE ||
+        strings_size != db_size - SDL_GAMEPAD_DB_HEADER_SIZE - num_mappings * SDL_GAMEPAD_DB_RECORD_SIZE ||
+        strings_size == 0) {
+        SDL_SetError("Invalid gamepad mapping database");
+        return -1;
+    }
+    strings = (const char *)db + (db_size - strings_size);
+    if (strings[strings_size - 1] != '\0' ||
+        SDL_PrivateReadGamepadDB32(db + 20) >= strings_size) {
+        SDL_SetError("Invalid gamepad mapping database");
+        return -1;
+    }
+
+    // The mappings have been processed for a specific platform and version of SDL
+    if (SDL_PrivateReadGamepadDB32(db + 8) != SDL_VERSION ||
+        SDL_strcasecmp(strings + SDL_PrivateReadGamepadDB32(db + 20), SDL_GetPlatform()) != 0) {
+        return 0;
+    }
+
+    PushMappingChangeTracking();
+
+    record = db + SDL_GAMEPAD_DB_HEADER_SIZE;
+    for (i = 0; i < num_mappings; ++i, record += SDL_GAMEPAD_DB_RECORD_SIZE) {
+        GamepadMapping_t *pGamepadMapping;
+        SDL_GUID guid;
+        Uint16 crc = SDL_PrivateReadGamepadDB16(record + 16);
+        Uint16 flags = SDL_PrivateReadGamepadDB16(record + 18);
+        Uint32 name_offset = SDL_PrivateReadGamepadDB32(record + 20);
+        Uint32 mapping_offset = SDL_PrivateReadGamepadDB32(record + 24);
+        char *pchName, *pchMapping;
+        bool existing = false;
+
+        if (name_offset >= strings_size || mapping_offset >= strings_size) {
+            continue;
+        }
+
+        SDL_memcpy(guid.data, record, sizeof(guid.data));
+        if (crc) {
+            SDL_SetJoystickGUIDCRC(&guid, crc);
+        }
+
+        pchName = SDL_strdup(strings + name_offset);
+        pchMapping = SDL_strdup(strings + mapping_offset);
+        if (!pchName || !pchMapping) {
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+            continue;
+        }
+
+        pGamepadMapping = SDL_PrivateInsertMapping(guid, pchName, pchMapping, (flags & SDL_GAMEPAD_DB_FLAG_CRC) != 0, crc, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_API);
+        if (pGamepadMapping && !existing) {
+            if (flags & SDL_GAMEPAD_DB_FLAG_DEFAULT) {
+                s_pDefaultMapping = pGamepadMapping;
+            } else if (flags & SDL_GAMEPAD_DB_FLAG_XINPUT) {
+                s_pXInputMapping = pGamepadMapping;
+            }
+            gamepads++;
+        }
+    }
+
+    PopMappingChangeTracking();
+
+    return gamepads;
+}
+
 /*
  * Add or update an entry into the Mappings Database
  */
@@ -1949,6 +2100,26 @@ int SDL_AddGamepadMappingsFromIO(SDL_IOStream *src, bool closeio)
     size_t db_size;
     size_t platform_len;
 
+    if (src) {
+        // A binary database in memory, e.g. a memory mapped file, can be used in place
+        const Uint8 *mem = (const Uint8 *)SDL_GetPointerProperty(SDL_GetIOProperties(src), SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+        if (mem) {
+            Sint64 offset = SDL_TellIO(src);
+            Sint64 size = SDL_GetIOSize(src);
+            if (offset >= 0 && size >= offset && SDL_PrivateIsGamepadDB(mem + offset, (size_t)(size - offset))) {
+                SDL_LockJoysticks();
+                gamepads = SDL_PrivateAddGamepadMappingsFromDB(mem + offset, (size_t)(size - offset));
+                SDL_UnlockJoysticks();
+
+                SDL_SeekIO(src, 0, SDL_IO_SEEK_END);
+                if (closeio) {
+                    SDL_CloseIO(src);
+                }
+                return gamepads;
+            }
+        }
+    }
+
     buf = (char *)SDL_LoadFile_IO(src, &db_size, closeio);
     if (!buf) {
         SDL_SetError("Could not allocate space to read DB into memory");
@@ -1958,6 +2129,15 @@ int SDL_AddGamepadMappingsFromIO(SDL_IOStream *src, bool closeio)
 
     SDL_LockJoysticks();
 
+    if (SDL_PrivateIsGamepadDB((const Uint8 *)buf, db_size)) {
+        gamepads = SDL_PrivateAddGamepadMappingsFromDB((const Uint8 *)buf, db_size);
+
+        SDL_UnlockJoysticks();
+
+        SDL_free(buf);
+        return gamepads;
+    }
+
     PushMappingChangeTracking();
 
     while (line < buf + db_size) {
@@ -1996,6 +2176,102 @@ int SDL_AddGamepadMappingsFromIO(SDL_IOStream *src, bool closeio)
     return gamepads;
 }
 
+static bool SDL_PrivateShouldSaveGamepadMapping(GamepadMapping_t *mapping)
+{
+    SDL_AssertJoysticksLocked();
+
+    if (mapping->priority == SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT) {
+        // This is built in or generated on demand
+        return false;
+    }
+    if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0 &&
+        mapping != s_pDefaultMapping && mapping != s_pXInputMapping) {
+        return false;
+    }
+    return true;
+}
+
+bool SDL_SaveGamepadMappingsToIO(SDL_IOStream *dst, bool closeio)
+{
+    const char *platform = SDL_GetPlatform();
+    GamepadMapping_t *mapping;
+    Uint32 num_mappings = 0;
+    size_t strings_size = SDL_strlen(platform) + 1;
+    size_t offset;
+    bool result = true;
+
+    if (!dst) {
+        result = SDL_InvalidParamError("dst");
+        goto done;
+    }
+
+    SDL_LockJoysticks();
+
+    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
+        if (SDL_PrivateShouldSaveGamepadMapping(mapping)) {
+            ++num_mappings;
+            strings_size += SDL_strlen(mapping->name) + 1 + SDL_strlen(mapping->mapping) + 1;
+        }
+    }
+
+    if (strings_size > SDL_MAX_UINT32) {
+        result = SDL_SetError("Gamepad mappings are too large to save");
+    }
+
+    if (result) {
+        result = (SDL_WriteIO(dst, SDL_GAMEPAD_DB_MAGIC, sizeof(SDL_GAMEPAD_DB_MAGIC)) == sizeof(SDL_GAMEPAD_DB_MAGIC) &&
+                  SDL_WriteU32LE(dst, SDL_VERSION) &&
+                  SDL_WriteU32LE(dst, num_mappings) &&
+                  SDL_WriteU32LE(dst, (Uint32)strings_size) &&
+                  SDL_WriteU32LE(dst, 0));
+    }
+
+    offset = SDL_strlen(platform) + 1;
+    for (mapping = s_pSupportedGamepads; mapping && result; mapping = mapping->next) {
+        Uint16 flags = 0;
+
+        if (!SDL_PrivateShouldSaveGamepadMapping(mapping)) {
+            continue;
+        }
+        if (mapping->has_crc) {
+            flags |= SDL_GAMEPAD_DB_FLAG_CRC;
+        }
+        if (mapping == s_pDefaultMapping) {
+            flags |= SDL_GAMEPAD_DB_FLAG_DEFAULT;
+        } else if (mapping == s_pXInputMapping) {
+            flags |= SDL_GAMEPAD_DB_FLAG_XINPUT;
+        }
+
+        result = (SDL_WriteIO(dst, mapping->guid.data, sizeof(mapping->guid.data)) == sizeof(mapping->guid.data) &&
+                  SDL_WriteU16LE(dst, mapping->crc) &&
+                  SDL_WriteU16LE(dst, flags) &&
+                  SDL_WriteU32LE(dst, (Uint32)offset) &&
+                  SDL_WriteU32LE(dst, (Uint32)(offset + SDL_strlen(mapping->name) + 1)));
+        offset += SDL_strlen(mapping->name) + 1 + SDL_strlen(mapping->mapping) + 1;
+    }
+
+    if (result) {
+        result = (SDL_WriteIO(dst, platform, SDL_strlen(platform) + 1) == SDL_strlen(platform) + 1);
+    }
+    for (mapping = s_pSupportedGamepads; mapping && result; mapping = mapping->next) {
+        if (!SDL_PrivateShouldSaveGamepadMapping(mapping)) {
+            continue;
+        }
+        result = (SDL_WriteIO(dst, mapping->name, SDL_strlen(mapping->name) + 1) == SDL_strlen(mapping->name) + 1 &&
+                  SDL_WriteIO(dst, mapping->mapping, SDL_strlen(mapping->mapping) + 1) == SDL_strlen(mapping->mapping) + 1);
+    }
+
+    SDL_UnlockJoysticks();
+
+done:
+    if (closeio && dst) {
+        if (!SDL_CloseIO(dst)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 int SDL_AddGamepadMappingsFromFile(const char *file)
 {
     return SDL_AddGamepadMappingsFromIO(SDL_IOFromFile(file, "rb"), true);
@@ -3900,6 +4176,8 @@ void SDL_QuitGamepadMappings(void)
         SDL_free(pGamepadMap->mapping);
         SDL_free(pGamepadMap);
     }
+    s_pSupportedGamepadsTail = NULL;
+    SDL_zeroa(s_pMappingBuckets);
 
     SDL_FreeVIDPIDList(&SDL_allowed_gamepads);
     SDL_FreeVIDPIDList(&SDL_ignored_gamepads);
@@ -120,6 +120,8 @@ SDL_AppResult SDL_InitMainCallbacks(int argc, char *argv[], SDL_AppInit_func app
 
 SDL_AppResult SDL_IterateMainCallbacks(bool pump_events)
 {
+    SDL_TRACE_BEGIN("SDL_IterateMainCallbacks");
+
     if (pump_events) {
         SDL_PumpEvents();
     }
@@ -127,11 +129,15 @@ SDL_AppResult SDL_IterateMainCallbacks(bool pump_events)
 
     SDL_AppResult rc = (SDL_AppResult)SDL_GetAtomicInt(&apprc);
     if (rc == SDL_APP_CONTINUE) {
+        SDL_TRACE_BEGIN("SDL_AppIterate");
         rc = SDL_main_iteration_callback(SDL_main_appstate);
+        SDL_TRACE_END();
         if (!SDL_CompareAndSwapAtomicInt(&apprc, SDL_APP_CONTINUE, rc)) {
             rc = (SDL_AppResult)SDL_GetAtomicInt(&apprc); // something else already set a quit result, keep that.
         }
     }
+
+    SDL_TRACE_END();
     return rc;
 }
 
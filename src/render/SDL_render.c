@@ -49,6 +49,10 @@ this should probably be removed at some point in the future.  --ryan. */
 #define SDL_PROP_WINDOW_RENDERER_POINTER "SDL.internal.window.renderer"
 #define SDL_PROP_TEXTURE_PARENT_POINTER "SDL.internal.texture.parent"
 
+// The number of presented frames over which peak command and vertex usage is measured before trimming
+#define SDL_RENDER_RETENTION_FRAMES         120
+#define SDL_RENDER_MIN_VERTEX_ALLOCATION    2048
+
 #define CHECK_RENDERER_MAGIC_BUT_NOT_DESTROYED_FLAG(renderer, result)   \
     if (!SDL_ObjectValid(renderer, SDL_OBJECT_TYPE_RENDERER)) {         \
         SDL_InvalidParamError("renderer");                              \
@@ -320,15 +324,28 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_TRACE_BEGIN("FlushRenderCommands");
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_END();
 
-    // Move the whole render command queue to the unused pool so we can reuse them next time.
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        renderer->render_commands_pool = renderer->render_commands;
-        renderer->render_commands_tail = NULL;
-        renderer->render_commands = NULL;
+    // Track the peak usage so the command and vertex arenas can be trimmed after a spike.
+    renderer->frame_vertex_bytes += renderer->vertex_data_used;
+    renderer->frame_render_commands += renderer->num_render_commands;
+    if (renderer->vertex_data_used > renderer->window_vertex_bytes) {
+        renderer->window_vertex_bytes = renderer->vertex_data_used;
+    }
+    if (renderer->num_render_commands > renderer->window_render_commands) {
+        renderer->window_render_commands = renderer->num_render_commands;
+    }
+
+    // Every queued command has been consumed, so recycle the command chunks from the start.
+    renderer->render_commands = NULL;
+    renderer->render_commands_tail = NULL;
+    renderer->render_command_chunk = renderer->render_command_chunks;
+    if (renderer->render_command_chunk) {
+        renderer->render_command_chunk->used = 0;
     }
+    renderer->num_render_commands = 0;
     renderer->vertex_data_used = 0;
     renderer->render_command_generation++;
     renderer->color_queued = false;
@@ -375,14 +392,21 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     const size_t aligned = current_offset + aligner;
 
     if (renderer->vertex_data_allocation < needed) {
-        const size_t current_allocation = renderer->vertex_data ? renderer->vertex_data_allocation : 1024;
-        size_t newsize = current_allocation * 2;
+        size_t newsize = renderer->vertex_data ? (renderer->vertex_data_allocation * 2) : SDL_RENDER_MIN_VERTEX_ALLOCATION;
         void *ptr;
         while (newsize < needed) {
             newsize *= 2;
         }
 
-        ptr = SDL_realloc(renderer->vertex_data, newsize);
+        if (current_offset == 0) {
+            // Nothing is queued yet, so skip copying the old contents
+            ptr = SDL_malloc(newsize);
+            if (ptr) {
+                SDL_free(renderer->vertex_data);
+            }
+        } else {
+            ptr = SDL_realloc(renderer->vertex_data, newsize);
+        }
 
         if (!ptr) {
             return NULL;
@@ -402,19 +426,34 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
 
 static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 {
+    SDL_RenderCommandChunk *chunk = renderer->render_command_chunk;
     SDL_RenderCommand *result = NULL;
 
-    result = renderer->render_commands_pool;
-    if (result) {
-        renderer->render_commands_pool = result->next;
-        result->next = NULL;
-    } else {
-        result = (SDL_RenderCommand *)SDL_calloc(1, sizeof(*result));
-        if (!result) {
-            return NULL;
+    if (!chunk || chunk->used == SDL_RENDER_COMMANDS_PER_CHUNK) {
+        if (chunk && chunk->next) {
+            chunk = chunk->next;
+        } else {
+            SDL_RenderCommandChunk *new_chunk = (SDL_RenderCommandChunk *)SDL_malloc(sizeof(*new_chunk));
+            if (!new_chunk) {
+                return NULL;
+            }
+            new_chunk->next = NULL;
+            if (chunk) {
+                chunk->next = new_chunk;
+            } else {
+                renderer->render_command_chunks = new_chunk;
+            }
+            ++renderer->num_render_command_chunks;
+            chunk = new_chunk;
         }
+        chunk->used = 0;
+        renderer->render_command_chunk = chunk;
     }
 
+    result = &chunk->commands[chunk->used++];
+    SDL_zerop(result);
+    ++renderer->num_render_commands;
+
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
     if (renderer->render_commands_tail) {
         renderer->render_commands_tail->next = result;
@@ -426,6 +465,66 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
     return result;
 }
 
+static void TrimRenderMemory(SDL_Renderer *renderer)
+{
+    const int chunks_needed = SDL_max(1, (renderer->window_render_commands + SDL_RENDER_COMMANDS_PER_CHUNK - 1) / SDL_RENDER_COMMANDS_PER_CHUNK);
+    size_t vertex_bytes_needed = SDL_RENDER_MIN_VERTEX_ALLOCATION;
+
+    // This only runs right after a flush, when nothing is using the arenas
+    SDL_assert(renderer->render_commands == NULL);
+    SDL_assert(renderer->vertex_data_used == 0);
+
+    if (renderer->num_render_command_chunks > chunks_needed) {
+        SDL_RenderCommandChunk *chunk = renderer->render_command_chunks;
+        SDL_RenderCommandChunk *next;
+        int i;
+
+        for (i = 1; i < chunks_needed; ++i) {
+            chunk = chunk->next;
+        }
+        next = chunk->next;
+        chunk->next = NULL;
+        while (next) {
+            chunk = next;
+            next = chunk->next;
+            SDL_free(chunk);
+            --renderer->num_render_command_chunks;
+        }
+    }
+
+    while (vertex_bytes_needed < renderer->window_vertex_bytes) {
+        vertex_bytes_needed *= 2;
+    }
+    if (renderer->vertex_data_allocation > (vertex_bytes_needed * 2)) {
+        void *ptr = SDL_malloc(vertex_bytes_needed);
+        if (ptr) {
+            SDL_free(renderer->vertex_data);
+            renderer->vertex_data = ptr;
+            renderer->vertex_data_allocation = vertex_bytes_needed;
+        }
+    }
+}
+
+static void UpdateRenderMemoryStats(SDL_Renderer *renderer)
+{
+    SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+
+    if (++renderer->window_frames >= SDL_RENDER_RETENTION_FRAMES) {
+        // Release memory that wasn't needed during the last window, keeping enough for its peak.
+        TrimRenderMemory(renderer);
+        renderer->window_render_commands = 0;
+        renderer->window_vertex_bytes = 0;
+        renderer->window_frames = 0;
+    }
+
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COMMANDS_NUMBER, renderer->frame_render_commands);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER, (Sint64)renderer->frame_vertex_bytes);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER, renderer->num_render_command_chunks);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BYTES_ALLOCATED_NUMBER, (Sint64)renderer->vertex_data_allocation);
+    renderer->frame_render_commands = 0;
+    renderer->frame_vertex_bytes = 0;
+}
+
 static void UpdatePixelViewport(SDL_Renderer *renderer, SDL_RenderViewState *view)
 {
     view->pixel_viewport.x = (int)SDL_floorf((view->viewport.x * view->current_scale.x) + view->logical_offset.x);
@@ -5394,6 +5493,7 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
     }
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
+    UpdateRenderMemoryStats(renderer);
 
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
@@ -5471,24 +5571,20 @@ void SDL_DestroyTexture(SDL_Texture *texture)
 
 static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *cmd;
-
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        cmd = renderer->render_commands;
-    } else {
-        cmd = renderer->render_commands_pool;
-    }
+    SDL_RenderCommandChunk *chunk = renderer->render_command_chunks;
 
-    renderer->render_commands_pool = NULL;
+    renderer->render_command_chunks = NULL;
+    renderer->render_command_chunk = NULL;
+    renderer->num_render_command_chunks = 0;
+    renderer->num_render_commands = 0;
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
     renderer->vertex_data_used = 0;
 
-    while (cmd) {
-        SDL_RenderCommand *next = cmd->next;
-        SDL_free(cmd);
-        cmd = next;
+    while (chunk) {
+        SDL_RenderCommandChunk *next = chunk->next;
+        SDL_free(chunk);
+        chunk = next;
     }
 }
 
@@ -5519,6 +5615,10 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_DestroyTexture(renderer->debug_char_texture_atlas);
         renderer->debug_char_texture_atlas = NULL;
     }
+    SDL_free(renderer->debug_text.xy);
+    SDL_free(renderer->debug_text.uv);
+    SDL_free(renderer->debug_text.indices);
+    SDL_zero(renderer->debug_text);
 
     // Free existing textures for this renderer
     while (renderer->textures) {
@@ -5828,17 +5928,49 @@ static bool CreateDebugTextAtlas(SDL_Renderer *renderer)
     return texture != NULL;
 }
 
-static bool DrawDebugCharacter(SDL_Renderer *renderer, float x, float y, Uint32 c)
+// Consecutive strings are merged into one batch until it has this many glyphs
+#define SDL_DEBUG_TEXT_MAX_BATCH_GLYPHS 1024
+
+static bool ReserveDebugTextGlyphs(SDL_DebugTextBatch *batch, int glyphs)
 {
-    SDL_assert(renderer->debug_char_texture_atlas != NULL);   // should have been created by now!
+    if (glyphs > batch->max_glyphs) {
+        int max_glyphs = SDL_max(batch->max_glyphs * 2, 128);
+        while (max_glyphs < glyphs) {
+            max_glyphs *= 2;
+        }
 
+        float *xy = (float *)SDL_realloc(batch->xy, max_glyphs * 4 * 2 * sizeof(float));
+        if (!xy) {
+            return false;
+        }
+        batch->xy = xy;
+
+        float *uv = (float *)SDL_realloc(batch->uv, max_glyphs * 4 * 2 * sizeof(float));
+        if (!uv) {
+            return false;
+        }
+        batch->uv = uv;
+
+        int *indices = (int *)SDL_realloc(batch->indices, max_glyphs * 6 * sizeof(int));
+        if (!indices) {
+            return false;
+        }
+        batch->indices = indices;
+
+        batch->max_glyphs = max_glyphs;
+    }
+    return true;
+}
+
+static void AddDebugCharacter(SDL_DebugTextBatch *batch, const SDL_Texture *atlas, float x, float y, Uint32 c)
+{
     const int charWidth = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
     const int charHeight = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
 
     // Character index in cache
     Uint32 ci = c;
     if ((ci <= 32) || ((ci >= 127) && (ci <= 160))) {
-        return true;  // these are just completely blank chars, don't bother doing anything.
+        return;  // these are just completely blank chars, don't bother doing anything.
     } else if (ci >= SDL_DEBUG_FONT_NUM_GLYPHS) {
         ci = SDL_DEBUG_FONT_NUM_GLYPHS - 1;  // use our "not a valid/supported character" glyph.
     } else if (ci < 127) {
@@ -5849,11 +5981,112 @@ static bool DrawDebugCharacter(SDL_Renderer *renderer, float x, float y, Uint32
 
     const float src_x = (float) (((ci % SDL_DEBUG_FONT_GLYPHS_PER_ROW) * (charWidth + 2)) + 1);
     const float src_y = (float) (((ci / SDL_DEBUG_FONT_GLYPHS_PER_ROW) * (charHeight + 2)) + 1);
+    const float minu = src_x / atlas->w;
+    const float minv = src_y / atlas->h;
+    const float maxu = (src_x + charWidth) / atlas->w;
+    const float maxv = (src_y + charHeight) / atlas->h;
+    const float maxx = x + charWidth;
+    const float maxy = y + charHeight;
+
+    const int glyph = batch->num_glyphs++;
+    const int vertex = glyph * 4;
+    float *xy = &batch->xy[vertex * 2];
+    float *uv = &batch->uv[vertex * 2];
+    int i;
 
-    // Draw texture onto destination
-    const SDL_FRect srect = { src_x, src_y, (float) charWidth, (float) charHeight };
-    const SDL_FRect drect = { x, y, (float) charWidth, (float) charHeight };
-    return SDL_RenderTexture(renderer, renderer->debug_char_texture_atlas, &srect, &drect);
+    // The corners go in the same order as a single SDL_RenderTexture() quad
+    uv[0] = minu;
+    uv[1] = minv;
+    uv[2] = maxu;
+    uv[3] = minv;
+    uv[4] = maxu;
+    uv[5] = maxv;
+    uv[6] = minu;
+    uv[7] = maxv;
+
+    xy[0] = x;
+    xy[1] = y;
+    xy[2] = maxx;
+    xy[3] = y;
+    xy[4] = maxx;
+    xy[5] = maxy;
+    xy[6] = x;
+    xy[7] = maxy;
+
+    for (i = 0; i < 6; ++i) {
+        batch->indices[glyph * 6 + i] = vertex + rect_index_order[i];
+    }
+}
+
+static bool CanMergeDebugText(SDL_Renderer *renderer, int num_glyphs)
+{
+    const SDL_DebugTextBatch *batch = &renderer->debug_text;
+
+    return batch->num_glyphs > 0 &&
+           batch->num_glyphs + num_glyphs <= SDL_DEBUG_TEXT_MAX_BATCH_GLYPHS &&
+           batch->generation == renderer->render_command_generation &&
+           batch->tail != batch->prev_tail &&
+           batch->tail == renderer->render_commands_tail &&
+           batch->view == renderer->view &&
+           batch->scale.x == renderer->view->current_scale.x &&
+           batch->scale.y == renderer->view->current_scale.y &&
+           SDL_memcmp(&batch->color, &renderer->color, sizeof(batch->color)) == 0 &&
+           batch->color_scale == renderer->color_scale &&
+           batch->texture_address_mode_u == renderer->texture_address_mode_u &&
+           batch->texture_address_mode_v == renderer->texture_address_mode_v &&
+           batch->gpu_render_state == renderer->gpu_render_state;
+}
+
+// Drop the previous batch from the end of the queue, so it can be queued again with more glyphs
+static void RewindDebugText(SDL_Renderer *renderer)
+{
+    SDL_DebugTextBatch *batch = &renderer->debug_text;
+
+    renderer->render_commands_tail = batch->prev_tail;
+    if (batch->prev_tail) {
+        batch->prev_tail->next = NULL;
+    } else {
+        renderer->render_commands = NULL;
+    }
+    if (batch->prev_chunk) {
+        renderer->render_command_chunk = batch->prev_chunk;
+        renderer->render_command_chunk->used = batch->prev_chunk_used;
+    } else {
+        // Nothing was queued before the batch, so start over from the first chunk rather than allocating a new list
+        renderer->render_command_chunk = renderer->render_command_chunks;
+        if (renderer->render_command_chunk) {
+            renderer->render_command_chunk->used = 0;
+        }
+    }
+    renderer->num_render_commands = batch->prev_num_render_commands;
+    renderer->vertex_data_used = batch->prev_vertex_data_used;
+    renderer->last_queued_color = batch->prev_last_queued_color;
+    renderer->last_queued_color_scale = batch->prev_last_queued_color_scale;
+    renderer->color_queued = batch->prev_color_queued;
+}
+
+static bool QueueDebugTextCopies(SDL_Renderer *renderer, SDL_Texture *atlas)
+{
+    const SDL_DebugTextBatch *batch = &renderer->debug_text;
+    int i;
+
+    SDL_SetTextureColorModFloat(atlas, renderer->color.r, renderer->color.g, renderer->color.b);
+    SDL_SetTextureAlphaModFloat(atlas, renderer->color.a);
+
+    for (i = 0; i < batch->num_glyphs; ++i) {
+        const float *xy = &batch->xy[i * 4 * 2];
+        const float *uv = &batch->uv[i * 4 * 2];
+        const SDL_FRect srect = {
+            SDL_roundf(uv[0] * atlas->w), SDL_roundf(uv[1] * atlas->h),
+            (float)SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE, (float)SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE
+        };
+        const SDL_FRect drect = { xy[0], xy[1], xy[4] - xy[0], xy[5] - xy[1] };
+
+        if (!SDL_RenderTextureInternal(renderer, atlas, &srect, &drect)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool SDL_RenderDebugText(SDL_Renderer *renderer, float x, float y, const char *s)
@@ -5867,21 +6100,83 @@ bool SDL_RenderDebugText(SDL_Renderer *renderer, float x, float y, const char *s
         }
     }
 
-    bool result = true;
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (renderer->hidden) {
+        return true;
+    }
+#endif
 
-    Uint8 r, g, b, a;
-    result &= SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
-    result &= SDL_SetTextureColorMod(renderer->debug_char_texture_atlas, r, g, b);
-    result &= SDL_SetTextureAlphaMod(renderer->debug_char_texture_atlas, a);
+    SDL_DebugTextBatch *batch = &renderer->debug_text;
+    SDL_Texture *atlas = renderer->debug_char_texture_atlas;
+    if (atlas->native) {
+        atlas = atlas->native;
+    }
+    atlas->last_command_generation = renderer->render_command_generation;
+
+    // Every character takes at most one glyph quad.
+    const int max_glyphs = (int)SDL_strlen(s);
+
+    /* Renderers that blit copies don't gain anything from a batch, so they get one copy per glyph,
+     * everyone else gets the whole string, and any strings drawn right before it, in one draw. */
+    const bool use_copies = (renderer->QueueCopy != NULL);
+
+    // Make sure any viewport or clip rect changes are queued, so they don't land between merged strings.
+    if (!use_copies && (!QueueCmdSetViewport(renderer) || !QueueCmdSetClipRect(renderer))) {
+        return false;
+    }
+
+    const bool merge = !use_copies && CanMergeDebugText(renderer, max_glyphs);
+    if (!ReserveDebugTextGlyphs(batch, (merge ? batch->num_glyphs : 0) + max_glyphs)) {
+        return false;
+    }
+
+    if (merge) {
+        RewindDebugText(renderer);
+    } else {
+        batch->num_glyphs = 0;
+        batch->generation = renderer->render_command_generation;
+        batch->prev_tail = renderer->render_commands_tail;
+        batch->prev_chunk = renderer->render_command_chunk;
+        batch->prev_chunk_used = renderer->render_command_chunk ? renderer->render_command_chunk->used : 0;
+        batch->prev_num_render_commands = renderer->num_render_commands;
+        batch->prev_vertex_data_used = renderer->vertex_data_used;
+        batch->prev_last_queued_color = renderer->last_queued_color;
+        batch->prev_last_queued_color_scale = renderer->last_queued_color_scale;
+        batch->prev_color_queued = renderer->color_queued;
+        batch->view = renderer->view;
+        batch->scale = renderer->view->current_scale;
+        batch->color = renderer->color;
+        batch->color_scale = renderer->color_scale;
+        batch->texture_address_mode_u = renderer->texture_address_mode_u;
+        batch->texture_address_mode_v = renderer->texture_address_mode_v;
+        batch->gpu_render_state = renderer->gpu_render_state;
+    }
 
     float curx = x;
     Uint32 ch;
 
-    while (result && ((ch = SDL_StepUTF8(&s, NULL)) != 0)) {
-        result &= DrawDebugCharacter(renderer, curx, y, ch);
+    while ((ch = SDL_StepUTF8(&s, NULL)) != 0) {
+        AddDebugCharacter(batch, atlas, curx, y, ch);
         curx += SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
     }
 
+    bool result = true;
+    if (use_copies) {
+        result = QueueDebugTextCopies(renderer, atlas);
+        batch->num_glyphs = 0;
+    } else if (batch->num_glyphs > 0) {
+        result = SDL_RenderGeometryRaw(renderer, atlas,
+                                       batch->xy, 2 * sizeof(float),
+                                       &batch->color, 0,
+                                       batch->uv, 2 * sizeof(float),
+                                       batch->num_glyphs * 4,
+                                       batch->indices, batch->num_glyphs * 6, sizeof(int));
+        batch->tail = renderer->render_commands_tail;
+        if (!result) {
+            batch->num_glyphs = 0;
+        }
+    }
     return result;
 }
 
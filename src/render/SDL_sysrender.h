@@ -193,6 +193,48 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+// Render commands are carved out of fixed-size chunks, which are recycled as a whole after each flush.
+#define SDL_RENDER_COMMANDS_PER_CHUNK   128
+
+typedef struct SDL_RenderCommandChunk
+{
+    struct SDL_RenderCommandChunk *next;
+    int used;
+    SDL_RenderCommand commands[SDL_RENDER_COMMANDS_PER_CHUNK];
+} SDL_RenderCommandChunk;
+
+// Glyph quads for SDL_RenderDebugText(), reused between calls
+typedef struct SDL_DebugTextBatch
+{
+    float *xy;
+    float *uv;
+    int *indices;
+    int num_glyphs;
+    int max_glyphs;
+
+    /* The queue as it was before the batch was queued, so a following call with
+     * the same state can replace the batch with one that has both strings in it. */
+    Uint32 generation;
+    SDL_RenderCommand *tail;
+    SDL_RenderCommand *prev_tail;
+    SDL_RenderCommandChunk *prev_chunk;
+    int prev_chunk_used;
+    int prev_num_render_commands;
+    size_t prev_vertex_data_used;
+    SDL_FColor prev_last_queued_color;
+    float prev_last_queued_color_scale;
+    bool prev_color_queued;
+
+    // The state the batch was queued with
+    const SDL_RenderViewState *view;
+    SDL_FPoint scale;
+    SDL_FColor color;
+    float color_scale;
+    SDL_TextureAddressMode texture_address_mode_u;
+    SDL_TextureAddressMode texture_address_mode_v;
+    SDL_GPURenderState *gpu_render_state;
+} SDL_DebugTextBatch;
+
 typedef struct SDL_VertexSolid
 {
     SDL_FPoint position;
@@ -311,7 +353,10 @@ struct SDL_Renderer
 
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
-    SDL_RenderCommand *render_commands_pool;
+    SDL_RenderCommandChunk *render_command_chunks;
+    SDL_RenderCommandChunk *render_command_chunk;  // the chunk currently being filled
+    int num_render_command_chunks;
+    int num_render_commands;  // commands queued since the last flush
     Uint32 render_command_generation;
     SDL_FColor last_queued_color;
     float last_queued_color_scale;
@@ -326,6 +371,13 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    // Per-frame memory statistics and the high-water marks used to trim the command and vertex arenas
+    size_t frame_vertex_bytes;
+    int frame_render_commands;
+    size_t window_vertex_bytes;
+    int window_render_commands;
+    int window_frames;
+
     // Shaped window support
     bool transparent_window;
     SDL_Surface *shape_surface;
@@ -334,6 +386,7 @@ struct SDL_Renderer
     SDL_PropertiesID props;
 
     SDL_Texture *debug_char_texture_atlas;
+    SDL_DebugTextBatch debug_text;
 
     bool destroyed;   // already destroyed by SDL_DestroyWindow; just free this struct in SDL_DestroyRenderer.
 
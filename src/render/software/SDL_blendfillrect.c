@@ -25,6 +25,258 @@
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
 
+static Uint32 SDL_BlendPixel8888(const SDL_BlendSpan8888 *span, Uint32 pixel)
+{
+    Uint32 result = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        unsigned d = (pixel >> shift) & 0xFF;
+        unsigned v = DRAW_MUL(d, (span->mul >> shift) & 0xFF) +
+                     DRAW_MUL(d, (span->mul2 >> shift) & 0xFF) +
+                     ((span->add >> shift) & 0xFF);
+        if (v > 0xFF) {
+            v = 0xFF;
+        }
+        result |= (Uint32)v << shift;
+    }
+    return result;
+}
+
+/* The SIMD kernels divide by 255 with (x * 0x8081) >> 23, which matches
+ * DRAW_MUL() exactly for every product of two 8-bit values.
+ */
+#ifdef SDL_SSE2_INTRINSICS
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SDL_BlendMul8888_SSE2(__m128i pixels, __m128i mul)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i div255 = _mm_set1_epi16((short)0x8081);
+    __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), mul);
+    __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), mul);
+
+    lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, div255), 7);
+    hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, div255), 7);
+    return _mm_packus_epi16(lo, hi);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse2") SDL_BlendSpan8888_SSE2_Impl(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width, const bool mul2)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mul = _mm_unpacklo_epi8(_mm_set1_epi32((int)span->mul), zero);
+    const __m128i mul_2 = _mm_unpacklo_epi8(_mm_set1_epi32((int)span->mul2), zero);
+    const __m128i add = _mm_set1_epi32((int)span->add);
+
+    for (; width >= 4; width -= 4, pixels += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *)pixels);
+        __m128i v = SDL_BlendMul8888_SSE2(d, mul);
+        if (mul2) {
+            v = _mm_adds_epu8(v, SDL_BlendMul8888_SSE2(d, mul_2));
+        }
+        _mm_storeu_si128((__m128i *)pixels, _mm_adds_epu8(v, add));
+    }
+    for (; width > 0; --width, ++pixels) {
+        *pixels = SDL_BlendPixel8888(span, *pixels);
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_BlendSpan8888_SSE2(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_SSE2_Impl(span, pixels, width, false);
+}
+
+static void SDL_TARGETING("sse2") SDL_BlendSpan8888_MUL_SSE2(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_SSE2_Impl(span, pixels, width, true);
+}
+
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_BlendMul8888_AVX2(__m256i pixels, __m256i mul)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i div255 = _mm256_set1_epi16((short)0x8081);
+    __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(pixels, zero), mul);
+    __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(pixels, zero), mul);
+
+    lo = _mm256_srli_epi16(_mm256_mulhi_epu16(lo, div255), 7);
+    hi = _mm256_srli_epi16(_mm256_mulhi_epu16(hi, div255), 7);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") SDL_BlendSpan8888_AVX2_Impl(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width, const bool mul2)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mul = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)span->mul), zero);
+    const __m256i mul_2 = _mm256_unpacklo_epi8(_mm256_set1_epi32((int)span->mul2), zero);
+    const __m256i add = _mm256_set1_epi32((int)span->add);
+
+    for (; width >= 8; width -= 8, pixels += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)pixels);
+        __m256i v = SDL_BlendMul8888_AVX2(d, mul);
+        if (mul2) {
+            v = _mm256_adds_epu8(v, SDL_BlendMul8888_AVX2(d, mul_2));
+        }
+        _mm256_storeu_si256((__m256i *)pixels, _mm256_adds_epu8(v, add));
+    }
+    for (; width > 0; --width, ++pixels) {
+        *pixels = SDL_BlendPixel8888(span, *pixels);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_BlendSpan8888_AVX2(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_AVX2_Impl(span, pixels, width, false);
+}
+
+static void SDL_TARGETING("avx2") SDL_BlendSpan8888_MUL_AVX2(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_AVX2_Impl(span, pixels, width, true);
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+
+static SDL_INLINE uint8x16_t SDL_BlendMul8888_NEON(uint8x16_t pixels, uint8x16_t mul)
+{
+    uint16x8_t lo = vmull_u8(vget_low_u8(pixels), vget_low_u8(mul));
+    uint16x8_t hi = vmull_u8(vget_high_u8(pixels), vget_high_u8(mul));
+
+    // (x + (x >> 8) + 1) >> 8 is the same truncated division by 255
+    lo = vaddq_u16(vsraq_n_u16(lo, lo, 8), vdupq_n_u16(1));
+    hi = vaddq_u16(vsraq_n_u16(hi, hi, 8), vdupq_n_u16(1));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+static SDL_INLINE void SDL_BlendSpan8888_NEON_Impl(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width, const bool mul2)
+{
+    const uint8x16_t mul = vreinterpretq_u8_u32(vdupq_n_u32(span->mul));
+    const uint8x16_t mul_2 = vreinterpretq_u8_u32(vdupq_n_u32(span->mul2));
+    const uint8x16_t add = vreinterpretq_u8_u32(vdupq_n_u32(span->add));
+
+    for (; width >= 4; width -= 4, pixels += 4) {
+        uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(pixels));
+        uint8x16_t v = SDL_BlendMul8888_NEON(d, mul);
+        if (mul2) {
+            v = vqaddq_u8(v, SDL_BlendMul8888_NEON(d, mul_2));
+        }
+        vst1q_u32(pixels, vreinterpretq_u32_u8(vqaddq_u8(v, add)));
+    }
+    for (; width > 0; --width, ++pixels) {
+        *pixels = SDL_BlendPixel8888(span, *pixels);
+    }
+}
+
+static void SDL_BlendSpan8888_NEON(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_NEON_Impl(span, pixels, width, false);
+}
+
+static void SDL_BlendSpan8888_MUL_NEON(const SDL_BlendSpan8888 *span, Uint32 *pixels, int width)
+{
+    SDL_BlendSpan8888_NEON_Impl(span, pixels, width, true);
+}
+
+#endif // SDL_NEON_INTRINSICS
+
+bool SDL_GetBlendSpan8888(const SDL_PixelFormatDetails *fmt, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a, SDL_BlendSpan8888 *span)
+{
+    const unsigned inva = 0xff - a;
+    unsigned mr, mg, mb, ma, m2r, m2g, m2b, ar, ag, ab, aa;
+    bool mul2 = false;
+
+    if (fmt->bytes_per_pixel != 4 ||
+        fmt->Rbits != 8 || fmt->Gbits != 8 || fmt->Bbits != 8 ||
+        (fmt->Abits != 8 && fmt->Abits != 0)) {
+        return false;
+    }
+
+    m2r = m2g = m2b = 0;
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        mr = mg = mb = ma = inva;
+        ar = r;
+        ag = g;
+        ab = b;
+        aa = a;
+        break;
+    case SDL_BLENDMODE_ADD:
+    case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+        mr = mg = mb = ma = 0xFF;
+        ar = r;
+        ag = g;
+        ab = b;
+        aa = 0;
+        break;
+    case SDL_BLENDMODE_MOD:
+        mr = r;
+        mg = g;
+        mb = b;
+        ma = 0xFF;
+        ar = ag = ab = aa = 0;
+        break;
+    case SDL_BLENDMODE_MUL:
+        mr = r;
+        mg = g;
+        mb = b;
+        ma = 0xFF;
+        m2r = m2g = m2b = inva;
+        ar = ag = ab = aa = 0;
+        mul2 = true;
+        break;
+    default:
+        mr = mg = mb = ma = 0;
+        ar = r;
+        ag = g;
+        ab = b;
+        aa = a;
+        break;
+    }
+
+    span->mul = ((Uint32)mr << fmt->Rshift) | ((Uint32)mg << fmt->Gshift) | ((Uint32)mb << fmt->Bshift);
+    span->mul2 = ((Uint32)m2r << fmt->Rshift) | ((Uint32)m2g << fmt->Gshift) | ((Uint32)m2b << fmt->Bshift);
+    span->add = ((Uint32)ar << fmt->Rshift) | ((Uint32)ag << fmt->Gshift) | ((Uint32)ab << fmt->Bshift);
+    // Formats without alpha get zero in the unused byte, like the scalar code
+    if (fmt->Amask) {
+        span->mul |= (Uint32)ma << fmt->Ashift;
+        span->add |= (Uint32)aa << fmt->Ashift;
+    }
+    span->BlendSpan = NULL;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (!span->BlendSpan && SDL_HasAVX2()) {
+        span->BlendSpan = mul2 ? SDL_BlendSpan8888_MUL_AVX2 : SDL_BlendSpan8888_AVX2;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (!span->BlendSpan && SDL_HasSSE2()) {
+        span->BlendSpan = mul2 ? SDL_BlendSpan8888_MUL_SSE2 : SDL_BlendSpan8888_SSE2;
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (!span->BlendSpan && SDL_HasNEON()) {
+        span->BlendSpan = mul2 ? SDL_BlendSpan8888_MUL_NEON : SDL_BlendSpan8888_NEON;
+    }
+#endif
+    (void)mul2;
+    return span->BlendSpan != NULL;
+}
+
+static void SDL_BlendFillRect_8888(SDL_Surface *dst, const SDL_Rect *rect, const SDL_BlendSpan8888 *span)
+{
+    Uint8 *pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch + rect->x * 4;
+    int height = rect->h;
+
+    while (height--) {
+        span->BlendSpan(span, (Uint32 *)pixels, rect->w);
+        pixels += dst->pitch;
+    }
+}
+
 static bool SDL_BlendFillRect_RGB555(SDL_Surface *dst, const SDL_Rect *rect,
                                     SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
@@ -237,6 +489,7 @@ static bool SDL_BlendFillRect_RGBA(SDL_Surface *dst, const SDL_Rect *rect,
 bool SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     SDL_Rect clipped;
+    SDL_BlendSpan8888 span;
 
     if (!SDL_SurfaceValid(dst)) {
         return SDL_InvalidParamError("SDL_BlendFillRect(): dst");
@@ -264,6 +517,11 @@ bool SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode ble
         b = DRAW_MUL(b, a);
     }
 
+    if (SDL_GetBlendSpan8888(dst->fmt, blendMode, r, g, b, a, &span)) {
+        SDL_BlendFillRect_8888(dst, rect, &span);
+        return true;
+    }
+
     switch (dst->fmt->bits_per_pixel) {
     case 15:
         switch (dst->fmt->Rmask) {
@@ -304,6 +562,7 @@ bool SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count, SDL_
     SDL_Rect rect;
     int i;
     bool (*func)(SDL_Surface * dst, const SDL_Rect *rect, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a) = NULL;
+    SDL_BlendSpan8888 span;
     bool result = true;
 
     if (!SDL_SurfaceValid(dst)) {
@@ -321,6 +580,17 @@ bool SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count, SDL_
         b = DRAW_MUL(b, a);
     }
 
+    if (SDL_GetBlendSpan8888(dst->fmt, blendMode, r, g, b, a, &span)) {
+        for (i = 0; i < count; ++i) {
+            // Perform clipping
+            if (!SDL_GetRectIntersection(&rects[i], &dst->clip_rect, &rect)) {
+                continue;
+            }
+            SDL_BlendFillRect_8888(dst, &rect, &span);
+        }
+        return true;
+    }
+
     // FIXME: Does this function pointer slow things down significantly?
     switch (dst->fmt->bits_per_pixel) {
     case 15:
@@ -24,6 +24,22 @@
 
 #include "SDL_internal.h"
 
+/* A solid color blended into 32-bit pixels with 8-bit channels, one byte lane at a time:
+ * dst = min(255, dst * mul / 255 + dst * mul2 / 255 + add)
+ */
+typedef struct SDL_BlendSpan8888
+{
+    Uint32 mul;
+    Uint32 mul2;
+    Uint32 add;
+    void (*BlendSpan)(const struct SDL_BlendSpan8888 *span, Uint32 *pixels, int width);
+} SDL_BlendSpan8888;
+
+/* Returns false if the format isn't 8888 or there is no SIMD kernel for it,
+ * r, g and b should already be premultiplied for the blend and add modes.
+ */
+extern bool SDL_GetBlendSpan8888(const SDL_PixelFormatDetails *fmt, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a, SDL_BlendSpan8888 *span);
+
 extern bool SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 extern bool SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
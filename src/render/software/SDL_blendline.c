@@ -23,6 +23,7 @@
 #ifdef SDL_VIDEO_RENDER_SW
 
 #include "SDL_draw.h"
+#include "SDL_blendfillrect.h"
 #include "SDL_blendline.h"
 #include "SDL_blendpoint.h"
 
@@ -883,6 +884,35 @@ static void SDL_BlendLine_ARGB8888(SDL_Surface *dst, int x1, int y1, int x2, int
     }
 }
 
+static bool SDL_GetBlendLineSpan8888(SDL_Surface *dst, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a, SDL_BlendSpan8888 *span)
+{
+    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
+        r = DRAW_MUL(r, a);
+        g = DRAW_MUL(g, a);
+        b = DRAW_MUL(b, a);
+    }
+    return SDL_GetBlendSpan8888(dst->fmt, blendMode, r, g, b, a, span);
+}
+
+// Horizontal lines are the same spans as filled rectangles
+static void SDL_BlendHLine8888(SDL_Surface *dst, int x1, int y1, int x2, const SDL_BlendSpan8888 *span, bool draw_end)
+{
+    Uint32 *pixels;
+    int length;
+
+    if (x1 <= x2) {
+        pixels = (Uint32 *)((Uint8 *)dst->pixels + y1 * dst->pitch) + x1;
+        length = draw_end ? (x2 - x1 + 1) : (x2 - x1);
+    } else {
+        pixels = (Uint32 *)((Uint8 *)dst->pixels + y1 * dst->pitch) + x2;
+        if (!draw_end) {
+            ++pixels;
+        }
+        length = draw_end ? (x1 - x2 + 1) : (x1 - x2);
+    }
+    span->BlendSpan(span, pixels, length);
+}
+
 typedef void (*BlendLineFunc)(SDL_Surface *dst,
                               int x1, int y1, int x2, int y2,
                               SDL_BlendMode blendMode,
@@ -922,6 +952,7 @@ static BlendLineFunc SDL_CalculateBlendLineFunc(const SDL_PixelFormatDetails *fm
 bool SDL_BlendLine(SDL_Surface *dst, int x1, int y1, int x2, int y2, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     BlendLineFunc func;
+    SDL_BlendSpan8888 span;
 
     if (!SDL_SurfaceValid(dst)) {
         return SDL_InvalidParamError("SDL_BlendLine(): dst");
@@ -938,6 +969,11 @@ bool SDL_BlendLine(SDL_Surface *dst, int x1, int y1, int x2, int y2, SDL_BlendMo
         return true;
     }
 
+    if (y1 == y2 && SDL_GetBlendLineSpan8888(dst, blendMode, r, g, b, a, &span)) {
+        SDL_BlendHLine8888(dst, x1, y1, x2, &span, true);
+        return true;
+    }
+
     func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, true);
     return true;
 }
@@ -949,6 +985,8 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
     int x2, y2;
     bool draw_end;
     BlendLineFunc func;
+    SDL_BlendSpan8888 span;
+    bool have_span;
 
     if (!SDL_SurfaceValid(dst)) {
         return SDL_SetError("SDL_BlendLines(): Passed NULL destination surface");
@@ -958,6 +996,7 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
     if (!func) {
         return SDL_SetError("SDL_BlendLines(): Unsupported surface format");
     }
+    have_span = SDL_GetBlendLineSpan8888(dst, blendMode, r, g, b, a, &span);
 
     for (i = 1; i < count; ++i) {
         x1 = points[i - 1].x;
@@ -974,6 +1013,10 @@ bool SDL_BlendLines(SDL_Surface *dst, const SDL_Point *points, int count, SDL_Bl
         // Draw the end if it was clipped
         draw_end = (x2 != points[i].x || y2 != points[i].y);
 
+        if (y1 == y2 && have_span) {
+            SDL_BlendHLine8888(dst, x1, y1, x2, &span, draw_end);
+            continue;
+        }
         func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, draw_end);
     }
     if (points[0].x != points[count - 1].x || points[0].y != points[count - 1].y) {
@@ -325,6 +325,7 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
     int applyModulation = false;
     int blitRequired = false;
     int isOpaque = false;
+    bool rotate90;
 
     if (!SDL_SurfaceValid(surface)) {
         return false;
@@ -354,24 +355,38 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
         }
         return false;
     }
+    if (src->palette) {
+        SDL_SetSurfacePalette(src_clone, src->palette);
+    }
 
     SDL_GetSurfaceBlendMode(src, &blendmode);
     SDL_GetSurfaceAlphaMod(src, &alphaMod);
     SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
 
-    // SDLgfx_rotateSurface only accepts 32-bit surfaces with a 8888 layout. Everything else has to be converted.
-    if (src->fmt->bits_per_pixel != 32 || SDL_PIXELLAYOUT(src->format) != SDL_PACKEDLAYOUT_8888 || !SDL_ISPIXELFORMAT_ALPHA(src->format)) {
+    /* SDLgfx_rotateSurface reads 8888, RGB565 and indexed surfaces directly, and crops and scales them
+     * while rotating. Everything else has to be converted.
+     */
+    if (!SDLgfx_rotateSurfaceSupported(src_clone)) {
         blitRequired = true;
     }
 
-    // If scaling and cropping is necessary, it has to be taken care of before the rotation.
-    if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
+    /* Rotations by multiples of 90 degrees take a fast path that copies 32-bit surfaces with alpha
+     * in their final size, and the pixel art scale mode is only implemented by the scaled blit.
+     */
+    rotate90 = ((int)(angle / 90) == angle / 90);
+    if (rotate90 && (src->fmt->bits_per_pixel != 32 || SDL_PIXELLAYOUT(src->format) != SDL_PACKEDLAYOUT_8888 || !SDL_ISPIXELFORMAT_ALPHA(src->format))) {
         blitRequired = true;
     }
+    if (rotate90 || scaleMode == SDL_SCALEMODE_PIXELART) {
+        // If scaling and cropping is necessary, it has to be taken care of before the rotation.
+        if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
+            blitRequired = true;
+        }
 
-    // srcrect is not selecting the whole src surface, so cropping is needed
-    if (!(srcrect->w == src->w && srcrect->h == src->h && srcrect->x == 0 && srcrect->y == 0)) {
-        blitRequired = true;
+        // srcrect is not selecting the whole src surface, so cropping is needed
+        if (!(srcrect->w == src->w && srcrect->h == src->h && srcrect->x == 0 && srcrect->y == 0)) {
+            blitRequired = true;
+        }
     }
 
     // The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes.
@@ -424,7 +439,8 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
 
         SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, center,
                                        &rect_dest, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle,
+        // After a conversion the source surface already has the final size
+        src_rotated = SDLgfx_rotateSurface(src_clone, (blitRequired || applyModulation) ? NULL : srcrect, tmp_rect.w, tmp_rect.h, angle,
                                            (scaleMode == SDL_SCALEMODE_NEAREST || scaleMode == SDL_SCALEMODE_PIXELART) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
                                            &rect_dest, cangle, sangle, center);
         if (!src_rotated) {
@@ -432,7 +448,7 @@ static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Te
         }
         if (result && mask) {
             // The mask needed for the NONE blend mode gets rotated with the same parameters.
-            mask_rotated = SDLgfx_rotateSurface(mask, angle,
+            mask_rotated = SDLgfx_rotateSurface(mask, NULL, mask->w, mask->h, angle,
                                                 false, 0, 0,
                                                 &rect_dest, cangle, sangle, center);
             if (!mask_rotated) {
@@ -676,6 +692,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         return false;
     }
 
+    SDL_TRACE_BEGIN("SW_RunCommandQueue");
+
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = true;
@@ -957,6 +975,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         cmd = cmd->next;
     }
 
+    SDL_TRACE_END();
+
     return true;
 }
 
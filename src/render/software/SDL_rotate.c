@@ -73,18 +73,6 @@ to a situation where the program can segfault.
 */
 #define GUARD_ROWS (2)
 
-/**
-Returns colorkey info for a surface
-*/
-static Uint32 get_colorkey(SDL_Surface *src)
-{
-    Uint32 key = 0;
-    if (SDL_SurfaceHasColorKey(src)) {
-        SDL_GetSurfaceColorKey(src, &key);
-    }
-    return key;
-}
-
 // rotate (sx, sy) by (angle, center) into (dx, dy)
 static void rotate(double sx, double sy, double sinangle, double cosangle, const SDL_FPoint *center, double *dx, double *dy)
 {
@@ -248,231 +236,568 @@ static void transformSurfaceY90(SDL_Surface *src, SDL_Surface *dst, int angle, i
 #undef TRANSFORM_SURFACE_90
 
 /**
-Internal 32 bit rotozoomer with optional anti-aliasing.
+Source pixel layouts the transform routines read directly.
+*/
+typedef enum tRotateFormat
+{
+    ROTATE_FORMAT_Y,     // 8 bit pixels, copied as they are
+    ROTATE_FORMAT_8888,  // 32 bit pixels with an 8888 layout, copied with the alpha bits set
+    ROTATE_FORMAT_565,   // RGB565 pixels, expanded to ARGB8888
+    ROTATE_FORMAT_INDEX8 // palette indices, looked up as ARGB8888
+} tRotateFormat;
 
-Rotates and zooms 32 bit RGBA/ABGR 'src' surface to 'dst' surface based on the control
-parameters by scanning the destination surface and applying optionally anti-aliasing
-by bilinear interpolation.
-Assumes src and dst surfaces are of 32 bit depth.
-Assumes dst surface was allocated with the correct dimensions.
+/**
+The source rectangle read by the transform routines.
+*/
+typedef struct tRotateSource
+{
+    const Uint8 *pixels; // top left pixel of the source rectangle
+    int pitch;
+    int w;
+    int h;
+    tRotateFormat format;
+    Uint32 amask;         // alpha bits added to 8888 pixels without alpha
+    Uint32 palette[256 + 256 + 64]; // ARGB8888 colors for indexed pixels, or the red, blue and green of RGB565 pixels
+} tRotateSource;
 
-\param src Source surface.
-\param dst Destination surface.
-\param isin Integer version of sine of angle.
-\param icos Integer version of cosine of angle.
-\param flipx Flag indicating horizontal mirroring should be applied.
-\param flipy Flag indicating vertical mirroring should be applied.
-\param smooth Flag indicating anti-aliasing should be used.
-\param rect_dest destination coordinates
-\param center true center.
+/**
+Number of destination pixels interpolated per batch.
 */
-static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, int icos,
-                                 int flipx, int flipy, int smooth,
-                                 const SDL_Rect *rect_dest,
-                                 const SDL_FPoint *center)
-{
-    int sw, sh;
-    int cx, cy;
-    tColorRGBA c00, c01, c10, c11, cswap;
-    tColorRGBA *pc, *sp;
-    int gap;
-    const int fp_half = (1 << 15);
+#define ROTATE_BATCH 64
 
-    /*
-     * Variable setup
-     */
-    sw = src->w - 1;
-    sh = src->h - 1;
-    pc = (tColorRGBA *)dst->pixels;
-    gap = dst->pitch - dst->w * 4;
-    cx = (int)(center->x * 65536.0);
-    cy = (int)(center->y * 65536.0);
+/**
+The four source pixels and the 7 bit weights of a batch of interpolated destination pixels.
+*/
+typedef struct tRotateSamples
+{
+    Uint32 c00[ROTATE_BATCH];
+    Uint32 c01[ROTATE_BATCH];
+    Uint32 c10[ROTATE_BATCH];
+    Uint32 c11[ROTATE_BATCH];
+    Uint16 ex[ROTATE_BATCH];
+    Uint16 ey[ROTATE_BATCH];
+} tRotateSamples;
 
-    /*
-     * Switch between interpolating and non-interpolating code
-     */
-    if (smooth) {
-        int y;
-        for (y = 0; y < dst->h; y++) {
-            int x;
-            double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
-            double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
-            int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
-            int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
-                int dx = (sdx >> 16);
-                int dy = (sdy >> 16);
-                if (flipx) {
-                    dx = sw - dx;
-                }
-                if (flipy) {
-                    dy = sh - dy;
-                }
-                if ((dx > -1) && (dy > -1) && (dx < (src->w - 1)) && (dy < (src->h - 1))) {
-                    int ex, ey;
-                    int t1, t2;
-                    sp = (tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx;
-                    c00 = *sp;
-                    sp += 1;
-                    c01 = *sp;
-                    sp += (src->pitch / 4);
-                    c11 = *sp;
-                    sp -= 1;
-                    c10 = *sp;
-                    if (flipx) {
-                        cswap = c00;
-                        c00 = c01;
-                        c01 = cswap;
-                        cswap = c10;
-                        c10 = c11;
-                        c11 = cswap;
-                    }
-                    if (flipy) {
-                        cswap = c00;
-                        c00 = c10;
-                        c10 = cswap;
-                        cswap = c01;
-                        c01 = c11;
-                        c11 = cswap;
-                    }
-                    /*
-                     * Interpolate colors
-                     */
-                    ex = (sdx & 0xffff);
-                    ey = (sdy & 0xffff);
-                    t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
-                    t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
-                    pc->r = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
-                    t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
-                    pc->g = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
-                    t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
-                    pc->b = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                    t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
-                    t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
-                    pc->a = (Uint8)((((t2 - t1) * ey) >> 16) + t1);
-                }
-                sdx += icos;
-                sdy += isin;
-                pc++;
-            }
-            pc = (tColorRGBA *)((Uint8 *)pc + gap);
+typedef void (*tInterpolateFunc)(const tRotateSamples *samples, Uint32 *dst, int start, int count);
+
+static SDL_INLINE Uint32 fetchPixel(const tRotateSource *src, const tRotateFormat format, int x, int y)
+{
+    const Uint8 *row = src->pixels + (size_t)y * src->pitch;
+
+    switch (format) {
+    case ROTATE_FORMAT_8888:
+        return ((const Uint32 *)row)[x] | src->amask;
+    case ROTATE_FORMAT_565:
+    {
+        const Uint16 p = ((const Uint16 *)row)[x];
+        return src->palette[p >> 8] | src->palette[256 + (p & 0xff)] | src->palette[512 + ((p >> 5) & 0x3f)];
+    }
+    case ROTATE_FORMAT_INDEX8:
+        return src->palette[row[x]];
+    default:
+        return row[x];
+    }
+}
+
+/**
+Bilinear interpolation of the samples, one channel at a time.
+
+The SIMD versions below compute exactly the same values: the weights are 7 bit so that
+every intermediate result fits into a signed 16 bit lane.
+*/
+static void interpolateSpan(const tRotateSamples *samples, Uint32 *dst, int start, int count)
+{
+    int i;
+
+    for (i = start; i < count; i++) {
+        const int ex = samples->ex[i];
+        const int ey = samples->ey[i];
+        Uint32 pixel = 0;
+        int shift;
+
+        for (shift = 0; shift < 32; shift += 8) {
+            const int c00 = (samples->c00[i] >> shift) & 0xff;
+            const int c01 = (samples->c01[i] >> shift) & 0xff;
+            const int c10 = (samples->c10[i] >> shift) & 0xff;
+            const int c11 = (samples->c11[i] >> shift) & 0xff;
+            const int t1 = c00 + (((c01 - c00) * ex) >> 7);
+            const int t2 = c10 + (((c11 - c10) * ex) >> 7);
+            pixel |= (Uint32)(t1 + (((t2 - t1) * ey) >> 7)) << shift;
+        }
+        dst[i] = pixel;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") lerpSSE2(__m128i a, __m128i b, __m128i w)
+{
+    return _mm_add_epi16(a, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(b, a), w), 7));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") interpolateSSE2(__m128i c00, __m128i c01, __m128i c10, __m128i c11, __m128i ex, __m128i ey)
+{
+    return lerpSSE2(lerpSSE2(c00, c01, ex), lerpSSE2(c10, c11, ex), ey);
+}
+
+static void SDL_TARGETING("sse2") interpolateSpanSSE2(const tRotateSamples *samples, Uint32 *dst, int start, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    for (i = start; i + 4 <= count; i += 4) {
+        // Spread the weight of each pixel over its four channels
+        const __m128i ex = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&samples->ex[i]), _mm_loadl_epi64((const __m128i *)&samples->ex[i]));
+        const __m128i ey = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&samples->ey[i]), _mm_loadl_epi64((const __m128i *)&samples->ey[i]));
+        const __m128i c00 = _mm_loadu_si128((const __m128i *)&samples->c00[i]);
+        const __m128i c01 = _mm_loadu_si128((const __m128i *)&samples->c01[i]);
+        const __m128i c10 = _mm_loadu_si128((const __m128i *)&samples->c10[i]);
+        const __m128i c11 = _mm_loadu_si128((const __m128i *)&samples->c11[i]);
+        const __m128i lo = interpolateSSE2(_mm_unpacklo_epi8(c00, zero), _mm_unpacklo_epi8(c01, zero),
+                                           _mm_unpacklo_epi8(c10, zero), _mm_unpacklo_epi8(c11, zero),
+                                           _mm_unpacklo_epi32(ex, ex), _mm_unpacklo_epi32(ey, ey));
+        const __m128i hi = interpolateSSE2(_mm_unpackhi_epi8(c00, zero), _mm_unpackhi_epi8(c01, zero),
+                                           _mm_unpackhi_epi8(c10, zero), _mm_unpackhi_epi8(c11, zero),
+                                           _mm_unpackhi_epi32(ex, ex), _mm_unpackhi_epi32(ey, ey));
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+    interpolateSpan(samples, dst, i, count);
+}
+
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") lerpAVX2(__m256i a, __m256i b, __m256i w)
+{
+    return _mm256_add_epi16(a, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(b, a), w), 7));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") interpolateAVX2(__m256i c00, __m256i c01, __m256i c10, __m256i c11, __m256i ex, __m256i ey)
+{
+    return lerpAVX2(lerpAVX2(c00, c01, ex), lerpAVX2(c10, c11, ex), ey);
+}
+
+static void SDL_TARGETING("avx2") interpolateSpanAVX2(const tRotateSamples *samples, Uint32 *dst, int start, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    int i;
+
+    for (i = start; i + 8 <= count; i += 8) {
+        /* Put each weight into both halves of a 32 bit lane, the 128 bit lane unpacks below
+         * then line them up with the channels of pixels 0,1,4,5 and 2,3,6,7.
+         */
+        __m256i ex = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&samples->ex[i]));
+        __m256i ey = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&samples->ey[i]));
+        const __m256i c00 = _mm256_loadu_si256((const __m256i *)&samples->c00[i]);
+        const __m256i c01 = _mm256_loadu_si256((const __m256i *)&samples->c01[i]);
+        const __m256i c10 = _mm256_loadu_si256((const __m256i *)&samples->c10[i]);
+        const __m256i c11 = _mm256_loadu_si256((const __m256i *)&samples->c11[i]);
+        __m256i lo, hi;
+
+        ex = _mm256_or_si256(ex, _mm256_slli_epi32(ex, 16));
+        ey = _mm256_or_si256(ey, _mm256_slli_epi32(ey, 16));
+        lo = interpolateAVX2(_mm256_unpacklo_epi8(c00, zero), _mm256_unpacklo_epi8(c01, zero),
+                             _mm256_unpacklo_epi8(c10, zero), _mm256_unpacklo_epi8(c11, zero),
+                             _mm256_unpacklo_epi32(ex, ex), _mm256_unpacklo_epi32(ey, ey));
+        hi = interpolateAVX2(_mm256_unpackhi_epi8(c00, zero), _mm256_unpackhi_epi8(c01, zero),
+                             _mm256_unpackhi_epi8(c10, zero), _mm256_unpackhi_epi8(c11, zero),
+                             _mm256_unpackhi_epi32(ex, ex), _mm256_unpackhi_epi32(ey, ey));
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_packus_epi16(lo, hi));
+    }
+    interpolateSpan(samples, dst, i, count);
+}
+
+// Nearest neighbor sampling of 8888 pixels, eight at a time with a gather.
+static void SDL_TARGETING("avx2") nearestSpan8888AVX2(const tRotateSource *src, Uint32 *dst, int sdx, int sdy, int idx, int idy, int count)
+{
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch / 4);
+    const __m256i amask = _mm256_set1_epi32((int)src->amask);
+    const __m256i stepx = _mm256_set1_epi32(idx * 8);
+    const __m256i stepy = _mm256_set1_epi32(idy * 8);
+    __m256i vx = _mm256_add_epi32(_mm256_set1_epi32(sdx), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(idx)));
+    __m256i vy = _mm256_add_epi32(_mm256_set1_epi32(sdy), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(idy)));
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(vy, 16), pitch), _mm256_srai_epi32(vx, 16));
+        const __m256i pixels = _mm256_i32gather_epi32((const int *)src->pixels, offset, 4);
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_or_si256(pixels, amask));
+        vx = _mm256_add_epi32(vx, stepx);
+        vy = _mm256_add_epi32(vy, stepy);
+    }
+    sdx += i * idx;
+    sdy += i * idy;
+    for (; i < count; i++) {
+        dst[i] = fetchPixel(src, ROTATE_FORMAT_8888, sdx >> 16, sdy >> 16);
+        sdx += idx;
+        sdy += idy;
+    }
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+
+static SDL_INLINE int16x8_t lerpNEON(int16x8_t a, int16x8_t b, int16x8_t w)
+{
+    return vaddq_s16(a, vshrq_n_s16(vmulq_s16(vsubq_s16(b, a), w), 7));
+}
+
+static SDL_INLINE int16x8_t interpolateNEON(uint8x8_t c00, uint8x8_t c01, uint8x8_t c10, uint8x8_t c11, uint16x4_t ex, uint16x4_t ey)
+{
+    // Spread the weights of two pixels over their four channels
+    const uint16x4x2_t ex2 = vzip_u16(ex, ex);
+    const uint16x4x2_t ey2 = vzip_u16(ey, ey);
+    const int16x8_t wx = vreinterpretq_s16_u16(vcombine_u16(ex2.val[0], ex2.val[1]));
+    const int16x8_t wy = vreinterpretq_s16_u16(vcombine_u16(ey2.val[0], ey2.val[1]));
+
+    return lerpNEON(lerpNEON(vreinterpretq_s16_u16(vmovl_u8(c00)), vreinterpretq_s16_u16(vmovl_u8(c01)), wx),
+                    lerpNEON(vreinterpretq_s16_u16(vmovl_u8(c10)), vreinterpretq_s16_u16(vmovl_u8(c11)), wx), wy);
+}
+
+static void interpolateSpanNEON(const tRotateSamples *samples, Uint32 *dst, int start, int count)
+{
+    int i;
+
+    for (i = start; i + 4 <= count; i += 4) {
+        const uint16x4x2_t ex = vzip_u16(vld1_u16(&samples->ex[i]), vld1_u16(&samples->ex[i]));
+        const uint16x4x2_t ey = vzip_u16(vld1_u16(&samples->ey[i]), vld1_u16(&samples->ey[i]));
+        const uint8x16_t c00 = vreinterpretq_u8_u32(vld1q_u32(&samples->c00[i]));
+        const uint8x16_t c01 = vreinterpretq_u8_u32(vld1q_u32(&samples->c01[i]));
+        const uint8x16_t c10 = vreinterpretq_u8_u32(vld1q_u32(&samples->c10[i]));
+        const uint8x16_t c11 = vreinterpretq_u8_u32(vld1q_u32(&samples->c11[i]));
+        const int16x8_t lo = interpolateNEON(vget_low_u8(c00), vget_low_u8(c01), vget_low_u8(c10), vget_low_u8(c11), ex.val[0], ey.val[0]);
+        const int16x8_t hi = interpolateNEON(vget_high_u8(c00), vget_high_u8(c01), vget_high_u8(c10), vget_high_u8(c11), ex.val[1], ey.val[1]);
+        vst1q_u32(&dst[i], vreinterpretq_u32_u8(vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi))));
+    }
+    interpolateSpan(samples, dst, i, count);
+}
+
+#endif // SDL_NEON_INTRINSICS
+
+SDL_FORCE_INLINE void nearestSpanImpl(const tRotateSource *src, const tRotateFormat format, Uint8 *dst, int sdx, int sdy, int idx, int idy, int count)
+{
+    int i;
+
+    if (format == ROTATE_FORMAT_Y) {
+        for (i = 0; i < count; i++) {
+            dst[i] = (Uint8)fetchPixel(src, format, sdx >> 16, sdy >> 16);
+            sdx += idx;
+            sdy += idy;
         }
     } else {
-        int y;
-        for (y = 0; y < dst->h; y++) {
-            int x;
-            double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
-            double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
-            int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
-            int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
-                int dx = (sdx >> 16);
-                int dy = (sdy >> 16);
-                if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                    if (flipx) {
-                        dx = sw - dx;
-                    }
-                    if (flipy) {
-                        dy = sh - dy;
-                    }
-                    *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
-                }
-                sdx += icos;
-                sdy += isin;
-                pc++;
-            }
-            pc = (tColorRGBA *)((Uint8 *)pc + gap);
+        Uint32 *pc = (Uint32 *)dst;
+        for (i = 0; i < count; i++) {
+            pc[i] = fetchPixel(src, format, sdx >> 16, sdy >> 16);
+            sdx += idx;
+            sdy += idy;
+        }
+    }
+}
+
+static void nearestSpan(const tRotateSource *src, Uint8 *dst, int sdx, int sdy, int idx, int idy, int count)
+{
+    switch (src->format) {
+    case ROTATE_FORMAT_8888:
+#ifdef SDL_AVX2_INTRINSICS
+        if (SDL_HasAVX2() && (src->pitch % 4) == 0) {
+            nearestSpan8888AVX2(src, (Uint32 *)dst, sdx, sdy, idx, idy, count);
+            break;
+        }
+#endif
+        nearestSpanImpl(src, ROTATE_FORMAT_8888, dst, sdx, sdy, idx, idy, count);
+        break;
+    case ROTATE_FORMAT_565:
+        nearestSpanImpl(src, ROTATE_FORMAT_565, dst, sdx, sdy, idx, idy, count);
+        break;
+    case ROTATE_FORMAT_INDEX8:
+        nearestSpanImpl(src, ROTATE_FORMAT_INDEX8, dst, sdx, sdy, idx, idy, count);
+        break;
+    default:
+        nearestSpanImpl(src, ROTATE_FORMAT_Y, dst, sdx, sdy, idx, idy, count);
+        break;
+    }
+}
+
+SDL_FORCE_INLINE void smoothSpanImpl(const tRotateSource *src, const tRotateFormat format, tInterpolateFunc interpolate,
+                                            Uint32 *dst, int sdx, int sdy, int idx, int idy, int count)
+{
+    tRotateSamples samples;
+
+    while (count > 0) {
+        const int batch = SDL_min(count, ROTATE_BATCH);
+        int i;
+
+        for (i = 0; i < batch; i++) {
+            const int dx = (sdx >> 16);
+            const int dy = (sdy >> 16);
+            samples.c00[i] = fetchPixel(src, format, dx, dy);
+            samples.c01[i] = fetchPixel(src, format, dx + 1, dy);
+            samples.c10[i] = fetchPixel(src, format, dx, dy + 1);
+            samples.c11[i] = fetchPixel(src, format, dx + 1, dy + 1);
+            samples.ex[i] = (Uint16)((sdx & 0xffff) >> 9);
+            samples.ey[i] = (Uint16)((sdy & 0xffff) >> 9);
+            sdx += idx;
+            sdy += idy;
+        }
+        interpolate(&samples, dst, 0, batch);
+        dst += batch;
+        count -= batch;
+    }
+}
+
+static void smoothSpan(const tRotateSource *src, tInterpolateFunc interpolate, Uint32 *dst, int sdx, int sdy, int idx, int idy, int count)
+{
+    switch (src->format) {
+    case ROTATE_FORMAT_565:
+        smoothSpanImpl(src, ROTATE_FORMAT_565, interpolate, dst, sdx, sdy, idx, idy, count);
+        break;
+    case ROTATE_FORMAT_INDEX8:
+        smoothSpanImpl(src, ROTATE_FORMAT_INDEX8, interpolate, dst, sdx, sdy, idx, idy, count);
+        break;
+    default:
+        smoothSpanImpl(src, ROTATE_FORMAT_8888, interpolate, dst, sdx, sdy, idx, idy, count);
+        break;
+    }
+}
+
+static Sint64 floorDiv(Sint64 a, Sint64 b)
+{
+    Sint64 q = a / b;
+    if ((a % b) != 0 && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return q;
+}
+
+/**
+Narrows [*x0, *x1) to the pixels x where 0 <= start + x * step <= max.
+*/
+static void clipSpan(Sint64 start, Sint64 step, Sint64 max, int *x0, int *x1)
+{
+    Sint64 first, last;
+
+    if (step == 0) {
+        if (start < 0 || start > max) {
+            *x1 = *x0;
         }
+        return;
+    }
+    if (step > 0) {
+        first = -floorDiv(start, step);
+        last = floorDiv(max - start, step);
+    } else {
+        first = -floorDiv(start - max, step);
+        last = floorDiv(-start, step);
+    }
+    if (first > *x0) {
+        *x0 = (int)SDL_min(first, (Sint64)*x1);
+    }
+    if (last + 1 < *x1) {
+        *x1 = (int)SDL_max(last + 1, (Sint64)*x0);
     }
 }
 
 /**
+Internal rotozoomer with optional anti-aliasing.
 
-Rotates and zooms 8 bit palette/Y 'src' surface to 'dst' surface without smoothing.
+Rotates and zooms the 'src' rectangle to 'dst' surface based on the control parameters
+by scanning the destination surface and applying optionally anti-aliasing by bilinear
+interpolation. 8 bit sources are copied as palette indices, 8888 sources keep their
+layout and 565 and indexed sources are converted to ARGB8888.
+Assumes dst surface was allocated with the correct dimensions and format.
 
-Rotates and zooms 8 bit RGBA/ABGR 'src' surface to 'dst' surface based on the control
-parameters by scanning the destination surface.
-Assumes src and dst surfaces are of 8 bit depth.
-Assumes dst surface was allocated with the correct dimensions.
+The source positions are linear along each destination row, so the range of pixels that
+lands inside the source is computed up front, and that range is sampled without any bounds
+checks, several pixels at a time when SIMD is available.
 
-\param src Source surface.
+\param src Source rectangle.
 \param dst Destination surface.
 \param isin Integer version of sine of angle.
 \param icos Integer version of cosine of angle.
+\param zoomx Horizontal source pixels per zoomed pixel.
+\param zoomy Vertical source pixels per zoomed pixel.
 \param flipx Flag indicating horizontal mirroring should be applied.
 \param flipy Flag indicating vertical mirroring should be applied.
+\param smooth Flag indicating anti-aliasing should be used.
 \param rect_dest destination coordinates
 \param center true center.
 */
-static void transformSurfaceY(SDL_Surface *src, SDL_Surface *dst, int isin, int icos, int flipx, int flipy,
-                              const SDL_Rect *rect_dest,
-                              const SDL_FPoint *center)
-{
-    int sw, sh;
-    int cx, cy;
-    tColorY *pc;
-    int gap;
+static void transformSurface(const tRotateSource *src, SDL_Surface *dst, int isin, int icos, double zoomx, double zoomy,
+                             int flipx, int flipy, int smooth,
+                             const SDL_Rect *rect_dest,
+                             const SDL_FPoint *center)
+{
     const int fp_half = (1 << 15);
+    const int cx = (int)(center->x * 65536.0);
+    const int cy = (int)(center->y * 65536.0);
+    const int bpp = SDL_BYTESPERPIXEL(dst->format);
+    int idx = (int)(icos * zoomx);
+    int idy = (int)(isin * zoomy);
+    // The interpolation reads one pixel to the right of and below the sampled position
+    const int sw = smooth ? src->w - 1 : src->w;
+    const int sh = smooth ? src->h - 1 : src->h;
+    tInterpolateFunc interpolate;
     int y;
 
-    /*
-     * Variable setup
-     */
-    sw = src->w - 1;
-    sh = src->h - 1;
-    pc = (tColorY *)dst->pixels;
-    gap = dst->pitch - dst->w;
-    cx = (int)(center->x * 65536.0);
-    cy = (int)(center->y * 65536.0);
+    if (sw <= 0 || sh <= 0) {
+        return;
+    }
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        interpolate = interpolateSpanAVX2;
+    } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        interpolate = interpolateSpanSSE2;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        interpolate = interpolateSpanNEON;
+    } else
+#endif
+    {
+        interpolate = interpolateSpan;
+    }
+
+    if (flipx) {
+        idx = -idx;
+    }
+    if (flipy) {
+        idy = -idy;
+    }
 
-    /*
-     * Clear surface to colorkey
-     */
-    SDL_memset(pc, (int)(get_colorkey(src) & 0xff), (size_t)dst->pitch * dst->h);
-    /*
-     * Iterate through destination surface
-     */
     for (y = 0; y < dst->h; y++) {
-        int x;
         double src_x = ((double)rect_dest->x + 0 + 0.5 - center->x);
         double src_y = ((double)rect_dest->y + y + 0.5 - center->y);
-        int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
-        int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-        for (x = 0; x < dst->w; x++) {
-            int dx = (sdx >> 16);
-            int dy = (sdy >> 16);
-            if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
-                if (flipx) {
-                    dx = sw - dx;
-                }
-                if (flipy) {
-                    dy = sh - dy;
-                }
-                *pc = *((tColorY *)src->pixels + src->pitch * dy + dx);
+        int sdx = (int)(((icos * src_x - isin * src_y) + cx) * zoomx - fp_half);
+        int sdy = (int)(((isin * src_x + icos * src_y) + cy) * zoomy - fp_half);
+        int x0 = 0, x1 = dst->w;
+
+        /* Mirror the source position. Without interpolation this maps source pixel n to
+         * w - 1 - n, with interpolation it mirrors around the pixel centers.
+         */
+        if (flipx) {
+            sdx = (smooth ? ((src->w - 1) << 16) : ((src->w << 16) - 1)) - sdx;
+        }
+        if (flipy) {
+            sdy = (smooth ? ((src->h - 1) << 16) : ((src->h << 16) - 1)) - sdy;
+        }
+
+        clipSpan(sdx, idx, ((Sint64)sw << 16) - 1, &x0, &x1);
+        clipSpan(sdy, idy, ((Sint64)sh << 16) - 1, &x0, &x1);
+        if (x0 < x1) {
+            Uint8 *pc = (Uint8 *)dst->pixels + (size_t)y * dst->pitch + (size_t)x0 * bpp;
+            sdx = (int)(sdx + (Sint64)x0 * idx);
+            sdy = (int)(sdy + (Sint64)x0 * idy);
+            if (smooth) {
+                smoothSpan(src, interpolate, (Uint32 *)pc, sdx, sdy, idx, idy, x1 - x0);
+            } else {
+                nearestSpan(src, pc, sdx, sdy, idx, idy, x1 - x0);
+            }
+        }
+    }
+}
+
+/**
+Sets up 'rsrc' to read the 'srcrect' area of 'src' and returns the pixel format of the rotated surface.
+*/
+static SDL_PixelFormat setupRotateSource(SDL_Surface *src, const SDL_Rect *srcrect, bool is8bit, tRotateSource *rsrc)
+{
+    SDL_PixelFormat format = SDL_PIXELFORMAT_UNKNOWN;
+
+    rsrc->w = srcrect->w;
+    rsrc->h = srcrect->h;
+    rsrc->pitch = src->pitch;
+    rsrc->pixels = NULL;
+    rsrc->amask = 0;
+
+    if (is8bit) {
+        rsrc->format = ROTATE_FORMAT_Y;
+        format = src->format;
+    } else if (SDL_SurfaceHasColorKey(src) && !SDL_ISPIXELFORMAT_ALPHA(src->format)) {
+        // The colorkey would have to be converted as well
+    } else if (!SDL_ISPIXELFORMAT_FOURCC(src->format) && src->fmt->bits_per_pixel == 32 && SDL_PIXELLAYOUT(src->format) == SDL_PACKEDLAYOUT_8888) {
+        rsrc->format = ROTATE_FORMAT_8888;
+        if (SDL_ISPIXELFORMAT_ALPHA(src->format)) {
+            format = src->format;
+        } else {
+            // Use the same layout with alpha, so the pixels outside of the rotated area can be transparent
+            rsrc->amask = ~(src->fmt->Rmask | src->fmt->Gmask | src->fmt->Bmask);
+            format = SDL_GetPixelFormatForMasks(32, src->fmt->Rmask, src->fmt->Gmask, src->fmt->Bmask, rsrc->amask);
+        }
+    } else if (src->format == SDL_PIXELFORMAT_RGB565) {
+        int i;
+
+        // Expand the channels the same way as the blitters, indexed by the high byte, low byte and green bits
+        rsrc->format = ROTATE_FORMAT_565;
+        for (i = 0; i < 256; i++) {
+            rsrc->palette[i] = 0xff000000 | ((Uint32)SDL_expand_byte[5][i >> 3] << 16);
+            rsrc->palette[256 + i] = SDL_expand_byte[5][i & 0x1f];
+        }
+        for (i = 0; i < 64; i++) {
+            rsrc->palette[512 + i] = (Uint32)SDL_expand_byte[6][i] << 8;
+        }
+        format = SDL_PIXELFORMAT_ARGB8888;
+    } else if (src->format == SDL_PIXELFORMAT_INDEX8 && src->palette) {
+        int i;
+
+        rsrc->format = ROTATE_FORMAT_INDEX8;
+        for (i = 0; i < 256; i++) {
+            if (i < src->palette->ncolors) {
+                const SDL_Color *color = &src->palette->colors[i];
+                rsrc->palette[i] = ((Uint32)color->a << 24) | ((Uint32)color->r << 16) | ((Uint32)color->g << 8) | color->b;
+            } else {
+                rsrc->palette[i] = 0xff000000;
             }
-            sdx += icos;
-            sdy += isin;
-            pc++;
         }
-        pc += gap;
+        format = SDL_PIXELFORMAT_ARGB8888;
     }
+    return format;
+}
+
+/**
+Returns true if SDLgfx_rotateSurface() can read the pixels of 'src' without a conversion.
+*/
+bool SDLgfx_rotateSurfaceSupported(SDL_Surface *src)
+{
+    tRotateSource rsrc;
+    SDL_Rect srcrect;
+    Uint32 colorkey = 0;
+    bool is8bit;
+
+    if (!SDL_SurfaceValid(src)) {
+        return false;
+    }
+
+    is8bit = src->fmt->bits_per_pixel == 8 && SDL_SurfaceHasColorKey(src) && SDL_GetSurfaceColorKey(src, &colorkey);
+    SDL_zero(srcrect);
+    return setupRotateSource(src, &srcrect, is8bit, &rsrc) != SDL_PIXELFORMAT_UNKNOWN;
 }
 
 /**
 Rotates and zooms a surface with different horizontal and vertival scaling factors and optional anti-aliasing.
 
-Rotates a 32-bit or 8-bit 'src' surface to newly created 'dst' surface.
+Rotates the 'srcrect' area of a 32-bit, 16-bit or 8-bit 'src' surface to newly created 'dst' surface.
 'angle' is the rotation in degrees, 'center' the rotation center. If 'smooth' is set
-then the destination 32-bit surface is anti-aliased. 8-bit surfaces must have a colorkey. 32-bit
-surfaces must have a 8888 layout with red, green, blue and alpha masks (any ordering goes).
+then the destination 32-bit surface is anti-aliased. 8-bit surfaces with a colorkey are rotated
+as palette indices, 8-bit surfaces without a colorkey and RGB565 surfaces are converted to ARGB8888.
+32-bit surfaces must have a 8888 layout (any ordering goes), the destination surface gets the same
+layout with alpha.
 The blend mode of the 'src' surface has some effects on generation of the 'dst' surface: The NONE
 mode will set the BLEND mode on the 'dst' surface. The MOD mode either generates a white 'dst'
 surface and sets the colorkey or fills the it with the colorkey before copying the pixels.
 When using the NONE and MOD modes, color and alpha modulation must be applied before using this function.
 
 \param src The surface to rotozoom.
+\param srcrect The area of the surface to rotozoom, or NULL for the entire surface.
+\param width The width 'srcrect' is zoomed to before the rotation.
+\param height The height 'srcrect' is zoomed to before the rotation.
 \param angle The angle to rotate in degrees.
 \param smooth Antialiasing flag; set to SMOOTHING_ON to enable.
 \param flipx Set to 1 to flip the image horizontally
@@ -485,8 +810,9 @@ When using the NONE and MOD modes, color and alpha modulation must be applied be
 
 */
 
-SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, int flipx, int flipy,
-                     const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center)
+SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, const SDL_Rect *srcrect, int width, int height,
+                                  double angle, int smooth, int flipx, int flipy,
+                                  const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center)
 {
     SDL_Surface *rz_dst;
     int is8bit, angle90;
@@ -494,42 +820,61 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     Uint32 colorkey = 0;
     bool colorKeyAvailable = false;
     double sangleinv, cangleinv;
+    SDL_Rect fullrect;
+    SDL_PixelFormat format;
+    tRotateSource *rsrc;
 
     // Sanity check
     if (!SDL_SurfaceValid(src)) {
         return NULL;
     }
 
+    if (!srcrect) {
+        fullrect.x = 0;
+        fullrect.y = 0;
+        fullrect.w = src->w;
+        fullrect.h = src->h;
+        srcrect = &fullrect;
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 || width <= 0 || height <= 0) {
+        return NULL;
+    }
+
     if (SDL_SurfaceHasColorKey(src)) {
         if (SDL_GetSurfaceColorKey(src, &colorkey)) {
             colorKeyAvailable = true;
         }
     }
-    // This function requires a 32-bit surface or 8-bit surface with a colorkey
+    // This function requires a 32-bit 8888, RGB565 or 8-bit surface
     is8bit = src->fmt->bits_per_pixel == 8 && colorKeyAvailable;
-    if (!(is8bit || (src->fmt->bits_per_pixel == 32 && SDL_ISPIXELFORMAT_ALPHA(src->format)))) {
+    rsrc = (tRotateSource *)SDL_malloc(sizeof(*rsrc));
+    if (!rsrc) {
+        return NULL;
+    }
+    format = setupRotateSource(src, srcrect, is8bit, rsrc);
+    if (format == SDL_PIXELFORMAT_UNKNOWN) {
+        SDL_free(rsrc);
         return NULL;
     }
+    if (format != src->format) {
+        // The colorkey only applies to the source pixel format
+        colorKeyAvailable = false;
+    }
 
     // Calculate target factors from sine/cosine and zoom
     sangleinv = sangle * 65536.0;
     cangleinv = cangle * 65536.0;
 
     // Alloc space to completely contain the rotated surface
-    rz_dst = NULL;
-    if (is8bit) {
+    rz_dst = SDL_CreateSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, format);
+    if (rz_dst && is8bit) {
         // Target surface is 8 bit
-        rz_dst = SDL_CreateSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
-        if (rz_dst) {
-            SDL_SetSurfacePalette(rz_dst, src->palette);
-        }
-    } else {
-        // Target surface is 32 bit with source RGBA ordering
-        rz_dst = SDL_CreateSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format);
+        SDL_SetSurfacePalette(rz_dst, src->palette);
     }
 
     // Check target
     if (!rz_dst) {
+        SDL_free(rsrc);
         return NULL;
     }
 
@@ -563,16 +908,20 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     if (SDL_MUSTLOCK(src)) {
         if (!SDL_LockSurface(src)) {
             SDL_DestroySurface(rz_dst);
+            SDL_free(rsrc);
             return NULL;
         }
     }
+    rsrc->pixels = (const Uint8 *)src->pixels + (size_t)srcrect->y * src->pitch + (size_t)srcrect->x * SDL_BYTESPERPIXEL(src->format);
 
     /* check if the rotation is a multiple of 90 degrees so we can take a fast path and also somewhat reduce
-     * the off-by-one problem in transformSurfaceRGBA that expresses itself when the rotation is near
-     * multiples of 90 degrees.
+     * the off-by-one problem in transformSurface that expresses itself when the rotation is near
+     * multiples of 90 degrees. The fast path copies whole surfaces without zooming or conversion.
      */
     angle90 = (int)(angle / 90);
-    if (angle90 == angle / 90) {
+    if (angle90 == angle / 90 && format == src->format &&
+        srcrect->x == 0 && srcrect->y == 0 && srcrect->w == src->w && srcrect->h == src->h &&
+        width == src->w && height == src->h) {
         angle90 %= 4;
         if (angle90 < 0) {
             angle90 += 4; // 0:0 deg, 1:90 deg, 2:180 deg, 3:270 deg
@@ -582,28 +931,24 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
         angle90 = -1;
     }
 
-    if (is8bit) {
-        // Call the 8-bit transformation routine to do the rotation
-        if (angle90 >= 0) {
+    if (angle90 >= 0) {
+        if (is8bit) {
             transformSurfaceY90(src, rz_dst, angle90, flipx, flipy);
         } else {
-            transformSurfaceY(src, rz_dst, (int)sangleinv, (int)cangleinv,
-                              flipx, flipy, rect_dest, center);
-        }
-    } else {
-        // Call the 32-bit transformation routine to do the rotation
-        if (angle90 >= 0) {
             transformSurfaceRGBA90(src, rz_dst, angle90, flipx, flipy);
-        } else {
-            transformSurfaceRGBA(src, rz_dst, (int)sangleinv, (int)cangleinv,
-                                 flipx, flipy, smooth, rect_dest, center);
         }
+    } else {
+        // Only 32-bit destinations are interpolated
+        transformSurface(rsrc, rz_dst, (int)sangleinv, (int)cangleinv,
+                         (double)srcrect->w / width, (double)srcrect->h / height,
+                         flipx, flipy, smooth && !is8bit, rect_dest, center);
     }
 
     // Unlock source surface
     if (SDL_MUSTLOCK(src)) {
         SDL_UnlockSurface(src);
     }
+    SDL_free(rsrc);
 
     // Return rotated surface
     return rz_dst;
@@ -22,7 +22,9 @@
 #ifndef SDL_rotate_h_
 #define SDL_rotate_h_
 
-extern SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, int flipx, int flipy,
+extern bool SDLgfx_rotateSurfaceSupported(SDL_Surface *src);
+extern SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, const SDL_Rect *srcrect, int width, int height,
+                                         double angle, int smooth, int flipx, int flipy,
                                          const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center);
 extern void SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle, const SDL_FPoint *center,
                                            SDL_Rect *rect_dest, double *cangle, double *sangle);
@@ -22,6 +22,8 @@
 
 // This file contains portable iconv functions for SDL
 
+#include "SDL_sysstdlib.h"
+
 #if defined(HAVE_ICONV) && defined(HAVE_ICONV_H)
 #ifndef SDL_USE_LIBICONV
 // Define LIBICONV_PLUG to use iconv from the base instead of ports and avoid linker errors.
@@ -231,6 +233,49 @@ SDL_iconv_t SDL_iconv_open(const char *tocode, const char *fromcode)
     return (SDL_iconv_t)-1;
 }
 
+static bool IsUnicode16(int fmt)
+{
+    return fmt == ENCODING_UTF16NATIVE || fmt == ENCODING_UCS2NATIVE;
+}
+
+static bool IsUnicode32(int fmt)
+{
+    return fmt == ENCODING_UTF32NATIVE || fmt == ENCODING_UCS4NATIVE;
+}
+
+// Converts a run of ASCII characters between UTF-8 and host order UTF-16 or UTF-32 in bulk, returning how many were converted
+static size_t ConvertASCII(SDL_iconv_t cd, const char **src, size_t *srclen, char **dst, size_t *dstlen)
+{
+    size_t count = 0;
+
+    if (cd->src_fmt == ENCODING_UTF8) {
+        if (IsUnicode16(cd->dst_fmt)) {
+            count = SDL_ASCIIToUTF16(*dst, *src, SDL_min(*srclen, *dstlen / 2));
+            *dst += count * 2;
+            *dstlen -= count * 2;
+        } else if (IsUnicode32(cd->dst_fmt)) {
+            count = SDL_ASCIIToUTF32(*dst, *src, SDL_min(*srclen, *dstlen / 4));
+            *dst += count * 4;
+            *dstlen -= count * 4;
+        }
+        *src += count;
+        *srclen -= count;
+    } else if (cd->dst_fmt == ENCODING_UTF8) {
+        if (IsUnicode16(cd->src_fmt)) {
+            count = SDL_UTF16ToASCII(*dst, *src, SDL_min(*srclen / 2, *dstlen));
+            *src += count * 2;
+            *srclen -= count * 2;
+        } else if (IsUnicode32(cd->src_fmt)) {
+            count = SDL_UTF32ToASCII(*dst, *src, SDL_min(*srclen / 4, *dstlen));
+            *src += count * 4;
+            *srclen -= count * 4;
+        }
+        *dst += count;
+        *dstlen -= count;
+    }
+    return count;
+}
+
 size_t SDL_iconv(SDL_iconv_t cd,
           const char **inbuf, size_t *inbytesleft,
           char **outbuf, size_t *outbytesleft)
@@ -331,6 +376,19 @@ size_t SDL_iconv(SDL_iconv_t cd,
 
     total = 0;
     while (srclen > 0) {
+        // Convert runs of ASCII characters in bulk
+        const size_t ascii = ConvertASCII(cd, &src, &srclen, &dst, &dstlen);
+        if (ascii > 0) {
+            *inbuf = src;
+            *inbytesleft = srclen;
+            *outbuf = dst;
+            *outbytesleft = dstlen;
+            total += ascii;
+            if (srclen == 0) {
+                break;
+            }
+        }
+
         // Decode a character
         switch (cd->src_fmt) {
         case ENCODING_ASCII:
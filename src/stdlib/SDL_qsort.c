@@ -181,16 +181,30 @@ static char _ID[]="<qsort.c gjm WITH CHANGES FOR SDL3 1.16 2021-02-20>";
  */
 #define PIVOT_THRESHOLD 40
 
-typedef struct { char * first; char * last; } stack_entry;
-#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop++].last=last;}
-#define pushRight {stack[stacktop].first=first;stack[stacktop++].last=llast;}
+/* BEGIN SDL CHANGE ... each stack entry remembers how many partitioning
+ * steps led to it, so that we can bail out to heapsort when pivots keep
+ * going badly (as introsort does). */
+typedef struct { char * first; char * last; int depth; } stack_entry;
+#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop].depth=depth;stack[stacktop++].last=last;}
+#define pushRight {stack[stacktop].first=first;stack[stacktop].depth=depth;stack[stacktop++].last=llast;}
 #define doLeft {first=ffirst;llast=last;continue;}
 #define doRight {ffirst=first;last=llast;continue;}
 #define pop {if (--stacktop<0) break;\
   first=ffirst=stack[stacktop].first;\
   last=llast=stack[stacktop].last;\
+  depth=stack[stacktop].depth;\
   continue;}
 
+/* No subarray should need more than twice log_2(n) partitioning steps
+ * unless the pivots are being chosen badly, in which case the rest of it
+ * is heapsorted. */
+#define TooDeep(sz)				\
+  if (++depth>depth_limit) {			\
+    heap_sort(first,last,sz,compare,userdata);	\
+    pop						\
+  }
+/* END SDL CHANGE ... */
+
 /* Some comments on the implementation.
  * 1. When we finish partitioning the array into "low"
  *    and "high", we forget entirely about short subarrays,
@@ -401,11 +415,70 @@ fprintf(stderr,"-> %d %d %d @ %p %p %p\n",*(int*)m1,*(int*)m2,*(int*)m3, m1,m2,m
 
 /* ---------------------------------------------------------------------- */
 
+/* BEGIN SDL CHANGE ... helpers for the heapsort fallback and for noticing
+ * input that is already sorted, or sorted backwards. */
+static void swap_elements(char *a, char *b, size_t size) {
+  if (((uintptr_t)a|(uintptr_t)b|size)&(WORD_BYTES-1)) {
+    do { char t=*a; *a++=*b; *b++=t; } while (--size);
+  } else {
+    do { int t=*(int*)a; *(int*)a=*(int*)b; *(int*)b=t;
+         a+=WORD_BYTES; b+=WORD_BYTES; } while (size-=WORD_BYTES);
+  }
+}
+
+static void sift_down(char *base, size_t root, size_t n, size_t size,
+                      int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
+  size_t child;
+  while ((child=2*root+1)<n) {
+    if (child+1<n && compare(userdata,base+child*size,base+(child+1)*size)<0) ++child;
+    if (compare(userdata,base+root*size,base+child*size)>=0) return;
+    swap_elements(base+root*size,base+child*size,size);
+    root=child;
+  }
+}
+
+/* note: last is inclusive */
+static void heap_sort(char *first, char *last, size_t size,
+                      int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
+  size_t n=(last-first)/size+1, i;
+  for (i=n/2;i-->0;) sift_down(first,i,n,size,compare,userdata);
+  while (--n>0) {
+    swap_elements(first,first+n*size,size);
+    sift_down(first,0,n,size,compare,userdata);
+  }
+}
+
+static int depth_limit_for(size_t nmemb) {
+  int limit=0;
+  while (nmemb>1) { nmemb>>=1; limit+=2; }
+  return limit;
+}
+
+/* Returns nonzero if the array was already in order, or was in strictly
+ * decreasing order and has been reversed. Random input bails out after a
+ * comparison or two. */
+static int presorted(char *base, size_t nmemb, size_t size,
+                     int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
+  char *last=base+(nmemb-1)*size, *p=base;
+  if (compare(userdata,p,p+size)<=0) {
+    for (p+=size;p!=last && compare(userdata,p,p+size)<=0;p+=size) ;
+    return p==last;
+  }
+  for (p+=size;p!=last && compare(userdata,p,p+size)>0;p+=size) ;
+  if (p!=last) return 0;
+  for (p=base;p<last;p+=size,last-=size) swap_elements(p,last,size);
+  return 1;
+}
+/* END SDL CHANGE ... */
+
+/* ---------------------------------------------------------------------- */
+
 static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
            int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=0, depth_limit=depth_limit_for(nmemb);
   char *first,*last;
   char *pivot=malloc(size);
   size_t trunc=TRUNC_nonaligned*size;
@@ -416,6 +489,7 @@ static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
   if ((size_t)(last-first)>=trunc) {
     char *ffirst=first, *llast=last;
     while (1) {
+      TooDeep(size)
       /* Select pivot */
       { char * mid=first+size*((last-first)/size >> 1);
         Pivot(SWAP_nonaligned,size);
@@ -437,6 +511,7 @@ static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=0, depth_limit=depth_limit_for(nmemb);
   char *first,*last;
   char *pivot=malloc(size);
   size_t trunc=TRUNC_aligned*size;
@@ -447,6 +522,7 @@ static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
   if ((size_t)(last-first)>=trunc) {
     char *ffirst=first,*llast=last;
     while (1) {
+      TooDeep(size)
       /* Select pivot */
       { char * mid=first+size*((last-first)/size >> 1);
         Pivot(SWAP_aligned,size);
@@ -468,6 +544,7 @@ static void qsort_r_words(void *base, size_t nmemb,
 
   stack_entry stack[STACK_SIZE];
   int stacktop=0;
+  int depth=0, depth_limit=depth_limit_for(nmemb);
   char *first,*last;
   char *pivot=malloc(WORD_BYTES);
   assert(pivot != NULL);
@@ -477,6 +554,7 @@ static void qsort_r_words(void *base, size_t nmemb,
   if (last-first>=TRUNC_words) {
     char *ffirst=first, *llast=last;
     while (1) {
+      TooDeep(WORD_BYTES)
 #ifdef DEBUG_QSORT
 fprintf(stderr,"Doing %d:%d: ",
         (first-(char*)base)/WORD_BYTES,
@@ -519,6 +597,7 @@ void SDL_qsort_r(void *base, size_t nmemb, size_t size,
            SDL_CompareCallback_r compare, void *userdata) {
 
   if (nmemb<=1) return;
+  if (presorted((char*)base,nmemb,size,compare,userdata)) return;
   if (((uintptr_t)base|size)&(WORD_BYTES-1))
     qsort_r_nonaligned(base,nmemb,size,compare,userdata);
   else if (size!=WORD_BYTES)
@@ -538,6 +617,229 @@ void SDL_qsort(void *base, size_t nmemb, size_t size, SDL_CompareCallback compar
     SDL_qsort_r(base, nmemb, size, qsort_non_r_bridge, compare);
 }
 
+// Everything from here on uses the SDL names directly
+#undef assert
+#undef malloc
+#undef free
+#undef memcpy
+#undef memmove
+
+/* SDL_radixsort() turns each key into an unsigned integer that sorts the
+ * same way, does a stable least significant digit first radix sort of those,
+ * carrying the element indices along, and then moves the elements into place.
+ */
+#define SDL_RADIX_BITS    8
+#define SDL_RADIX_BUCKETS (1 << SDL_RADIX_BITS)
+#define SDL_RADIX_SMALL   32 // insertion sort is faster than this
+
+static Uint64 SDL_GetSortKey(const Uint8 *element, SDL_SortKeyType key_type)
+{
+    Uint32 value32;
+    Uint64 value64;
+
+    if (key_type == SDL_SORTKEY_UINT32 || key_type == SDL_SORTKEY_SINT32 || key_type == SDL_SORTKEY_FLOAT) {
+        SDL_memcpy(&value32, element, sizeof(value32));
+        if (key_type == SDL_SORTKEY_SINT32) {
+            value32 ^= 0x80000000u;
+        } else if (key_type == SDL_SORTKEY_FLOAT) {
+            // Negative floats sort backwards, and before all the positive ones
+            value32 = (value32 & 0x80000000u) ? ~value32 : (value32 | 0x80000000u);
+        }
+        return value32;
+    }
+
+    SDL_memcpy(&value64, element, sizeof(value64));
+    if (key_type == SDL_SORTKEY_SINT64) {
+        value64 ^= SDL_UINT64_C(0x8000000000000000);
+    } else if (key_type == SDL_SORTKEY_DOUBLE) {
+        value64 = (value64 & SDL_UINT64_C(0x8000000000000000)) ? ~value64 : (value64 | SDL_UINT64_C(0x8000000000000000));
+    }
+    return value64;
+}
+
+static void SDL_PutSortKey(Uint8 *element, Uint64 key, SDL_SortKeyType key_type)
+{
+    if (key_type == SDL_SORTKEY_UINT32 || key_type == SDL_SORTKEY_SINT32 || key_type == SDL_SORTKEY_FLOAT) {
+        Uint32 value32 = (Uint32)key;
+        if (key_type == SDL_SORTKEY_SINT32) {
+            value32 ^= 0x80000000u;
+        } else if (key_type == SDL_SORTKEY_FLOAT) {
+            value32 = (value32 & 0x80000000u) ? (value32 & ~0x80000000u) : ~value32;
+        }
+        SDL_memcpy(element, &value32, sizeof(value32));
+    } else {
+        if (key_type == SDL_SORTKEY_SINT64) {
+            key ^= SDL_UINT64_C(0x8000000000000000);
+        } else if (key_type == SDL_SORTKEY_DOUBLE) {
+            key = (key & SDL_UINT64_C(0x8000000000000000)) ? (key & ~SDL_UINT64_C(0x8000000000000000)) : ~key;
+        }
+        SDL_memcpy(element, &key, sizeof(key));
+    }
+}
+
+static void SDL_InsertionSortKeys(Uint64 *keys, size_t *indices, size_t nmemb)
+{
+    size_t i, j;
+
+    for (i = 1; i < nmemb; ++i) {
+        const Uint64 key = keys[i];
+        const size_t index = indices ? indices[i] : 0;
+
+        for (j = i; j > 0 && keys[j - 1] > key; --j) {
+            keys[j] = keys[j - 1];
+            if (indices) {
+                indices[j] = indices[j - 1];
+            }
+        }
+        keys[j] = key;
+        if (indices) {
+            indices[j] = index;
+        }
+    }
+}
+
+// The sorted keys and indices end up in either the original or the temporary arrays, which are swapped to match
+static void SDL_RadixSortKeys(Uint64 **keys, Uint64 **keys_tmp, size_t **indices, size_t **indices_tmp, size_t nmemb, size_t *counts, int key_bytes)
+{
+    size_t i;
+    int pass;
+
+    SDL_memset(counts, 0, key_bytes * SDL_RADIX_BUCKETS * sizeof(*counts));
+    for (i = 0; i < nmemb; ++i) {
+        const Uint64 key = (*keys)[i];
+        for (pass = 0; pass < key_bytes; ++pass) {
+            ++counts[pass * SDL_RADIX_BUCKETS + (size_t)((key >> (pass * SDL_RADIX_BITS)) & (SDL_RADIX_BUCKETS - 1))];
+        }
+    }
+
+    for (pass = 0; pass < key_bytes; ++pass) {
+        const int shift = pass * SDL_RADIX_BITS;
+        size_t *count = &counts[pass * SDL_RADIX_BUCKETS];
+        const Uint64 *src = *keys;
+        Uint64 *dst = *keys_tmp;
+        size_t offset = 0;
+        int bucket;
+
+        if (count[(src[0] >> shift) & (SDL_RADIX_BUCKETS - 1)] == nmemb) {
+            continue;  // every key has the same digit here, so this pass wouldn't move anything
+        }
+        for (bucket = 0; bucket < SDL_RADIX_BUCKETS; ++bucket) {
+            const size_t n = count[bucket];
+            count[bucket] = offset;
+            offset += n;
+        }
+
+        if (*indices) {
+            const size_t *src_indices = *indices;
+            size_t *dst_indices = *indices_tmp;
+            for (i = 0; i < nmemb; ++i) {
+                const size_t slot = count[(src[i] >> shift) & (SDL_RADIX_BUCKETS - 1)]++;
+                dst[slot] = src[i];
+                dst_indices[slot] = src_indices[i];
+            }
+            *indices_tmp = *indices;
+            *indices = dst_indices;
+        } else {
+            for (i = 0; i < nmemb; ++i) {
+                dst[count[(src[i] >> shift) & (SDL_RADIX_BUCKETS - 1)]++] = src[i];
+            }
+        }
+        *keys_tmp = *keys;
+        *keys = dst;
+    }
+}
+
+bool SDL_radixsort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type)
+{
+    Uint8 *elements = (Uint8 *)base;
+    Uint8 *scratch = NULL;
+    Uint64 *keys, *keys_tmp;
+    size_t *indices = NULL, *indices_tmp = NULL;
+    size_t *counts;
+    size_t key_size, per_element, bytes, i;
+    bool keys_only, sorted = true;
+    void *memory;
+
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+    case SDL_SORTKEY_SINT32:
+    case SDL_SORTKEY_FLOAT:
+        key_size = sizeof(Uint32);
+        break;
+    case SDL_SORTKEY_UINT64:
+    case SDL_SORTKEY_SINT64:
+    case SDL_SORTKEY_DOUBLE:
+        key_size = sizeof(Uint64);
+        break;
+    default:
+        return SDL_InvalidParamError("key_type");
+    }
+    if (!base && nmemb > 0) {
+        return SDL_InvalidParamError("base");
+    }
+    if (key_offset > size || size - key_offset < key_size) {
+        return SDL_InvalidParamError("key_offset");
+    }
+    if (nmemb <= 1) {
+        return true;
+    }
+
+    // Plain arrays of numbers can be rebuilt from their keys, anything else needs to be moved
+    keys_only = (size == key_size);
+    per_element = 2 * sizeof(Uint64);
+    if (!keys_only) {
+        per_element += 2 * sizeof(size_t) + size;
+    }
+    if (!SDL_size_mul_check_overflow(nmemb, per_element, &bytes) ||
+        !SDL_size_add_check_overflow(bytes, sizeof(size_t) * SDL_RADIX_BUCKETS * key_size, &bytes)) {
+        return SDL_OutOfMemory();
+    }
+    memory = SDL_malloc(bytes);
+    if (!memory) {
+        return false;
+    }
+    keys = (Uint64 *)memory;
+    keys_tmp = keys + nmemb;
+    counts = (size_t *)(keys_tmp + nmemb);
+    if (!keys_only) {
+        indices = counts + SDL_RADIX_BUCKETS * key_size;
+        indices_tmp = indices + nmemb;
+        scratch = (Uint8 *)(indices_tmp + nmemb);
+    }
+
+    for (i = 0; i < nmemb; ++i) {
+        keys[i] = SDL_GetSortKey(elements + i * size + key_offset, key_type);
+        if (indices) {
+            indices[i] = i;
+        }
+        if (i > 0 && keys[i] < keys[i - 1]) {
+            sorted = false;
+        }
+    }
+
+    if (!sorted) {
+        if (nmemb <= SDL_RADIX_SMALL) {
+            SDL_InsertionSortKeys(keys, indices, nmemb);
+        } else {
+            SDL_RadixSortKeys(&keys, &keys_tmp, &indices, &indices_tmp, nmemb, counts, (int)key_size);
+        }
+
+        if (keys_only) {
+            for (i = 0; i < nmemb; ++i) {
+                SDL_PutSortKey(elements + i * size, keys[i], key_type);
+            }
+        } else {
+            for (i = 0; i < nmemb; ++i) {
+                SDL_memcpy(scratch + i * size, elements + indices[i] * size, size);
+            }
+            SDL_memcpy(elements, scratch, nmemb * size);
+        }
+    }
+
+    SDL_free(memory);
+    return true;
+}
+
 // Don't use the C runtime for such a simple function, since we want to allow SDLCALL callbacks and userdata.
 // SDL's replacement: Taken from the Public Domain C Library (PDCLib):
 // Permission is granted to use, modify, and / or redistribute at will.
@@ -240,7 +240,7 @@ static Uint32 StepUTF8(const char **_str, const size_t slen)
         const Uint8 str2 = str[2];
         const Uint8 str3 = str[3];
         if (((str1 & 0xC0) == 0x80) && ((str2 & 0xC0) == 0x80) && ((str3 & 0xC0) == 0x80)) {  // If trailing bytes aren't 10xxxxxx, sequence is bogus.
-            const Uint32 octet2 = ((Uint32) (str1 & 0x1F)) << 12;
+            const Uint32 octet2 = ((Uint32) (str1 & 0x3F)) << 12;
             const Uint32 octet3 = ((Uint32) (str2 & 0x3F)) << 6;
             const Uint32 octet4 = ((Uint32) (str3 & 0x3F));
             const Uint32 result = ((octet & 0x07) << 18) | octet2 | octet3 | octet4;
@@ -653,13 +653,355 @@ static size_t SDL_ScanUnsignedLongLong(const char *text, int count, int radix, u
 }
 #endif
 
+#if !defined(HAVE_VSSCANF) || !defined(HAVE_STRTOD) || !defined(HAVE_VSNPRINTF)
+static int SDL_LeadingZeroes64(Uint64 value)
+{
+    if (value >> 32) {
+        return 31 - SDL_MostSignificantBitIndex32((Uint32)(value >> 32));
+    }
+    return 63 - SDL_MostSignificantBitIndex32((Uint32)value);
+}
+
+static Uint64 SDL_Multiply64(Uint64 a, Uint64 b, Uint64 *high)
+{
+    const Uint64 ll = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    const Uint64 lh = (a & 0xFFFFFFFF) * (b >> 32);
+    const Uint64 hl = (a >> 32) * (b & 0xFFFFFFFF);
+    const Uint64 hh = (a >> 32) * (b >> 32);
+    const Uint64 middle = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+
+    *high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+    return (middle << 32) | (ll & 0xFFFFFFFF);
+}
+#endif
+
 #if !defined(HAVE_VSSCANF) || !defined(HAVE_STRTOD)
+/* Decimal numbers are converted with a single exact floating point
+ * operation when the digits and the power of ten both fit in a double, then
+ * by multiplying up to 19 digits by a 128-bit power of ten when that leaves
+ * no doubt about the rounding, and otherwise by scaling a decimal
+ * representation of the number by powers of two until the binary mantissa
+ * can be read off it, which is always correctly rounded.
+ */
+#define SDL_DECIMAL_MAX_DIGITS 800
+#define SDL_DECIMAL_MAX_SHIFT  60
+
+typedef struct
+{
+    Uint8 digits[SDL_DECIMAL_MAX_DIGITS + 20]; // a left shift can add up to 19 digits
+    int count;          // the number of digits used
+    int decimal_point;  // the value is 0.digits * 10^decimal_point
+    bool truncated;     // nonzero digits were dropped after the last one
+} SDL_Decimal;
+
+static const double SDL_exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static void SDL_TrimDecimal(SDL_Decimal *d)
+{
+    while (d->count > 0 && d->digits[d->count - 1] == 0) {
+        --d->count;
+    }
+    if (d->count == 0) {
+        d->decimal_point = 0;
+    }
+}
+
+static void SDL_ShiftDecimalRight(SDL_Decimal *d, unsigned int k)
+{
+    const Uint64 mask = ((Uint64)1 << k) - 1;
+    int r = 0;
+    int w = 0;
+    Uint64 n = 0;
+
+    // Pick up enough leading digits to cover the first shift
+    while ((n >> k) == 0) {
+        if (r >= d->count) {
+            if (n == 0) {
+                d->count = 0;
+                return;
+            }
+            while ((n >> k) == 0) {
+                n *= 10;
+                ++r;
+            }
+            break;
+        }
+        n = n * 10 + d->digits[r++];
+    }
+    d->decimal_point -= r - 1;
+
+    // Pick up a digit, put down a digit
+    for (; r < d->count; ++r) {
+        d->digits[w++] = (Uint8)(n >> k);
+        n = (n & mask) * 10 + d->digits[r];
+    }
+
+    // Put down the extra digits
+    while (n > 0) {
+        const Uint8 digit = (Uint8)(n >> k);
+        if (w < SDL_DECIMAL_MAX_DIGITS) {
+            d->digits[w++] = digit;
+        } else if (digit > 0) {
+            d->truncated = true;
+        }
+        n = (n & mask) * 10;
+    }
+    d->count = w;
+    SDL_TrimDecimal(d);
+}
+
+static void SDL_ShiftDecimalLeft(SDL_Decimal *d, unsigned int k)
+{
+    // Write the result right aligned after the digits, then move it down
+    int r = d->count;
+    int w = d->count + 20;
+    int count;
+    Uint64 n = 0;
+
+    while (r > 0) {
+        n += (Uint64)d->digits[--r] << k;
+        d->digits[--w] = (Uint8)(n % 10);
+        n /= 10;
+    }
+    while (n > 0) {
+        d->digits[--w] = (Uint8)(n % 10);
+        n /= 10;
+    }
+
+    count = d->count + 20 - w;
+    d->decimal_point += count - d->count;
+    SDL_memmove(d->digits, &d->digits[w], count);
+    for (; count > SDL_DECIMAL_MAX_DIGITS; --count) {
+        if (d->digits[count - 1] != 0) {
+            d->truncated = true;
+        }
+    }
+    d->count = count;
+    SDL_TrimDecimal(d);
+}
+
+static void SDL_ShiftDecimal(SDL_Decimal *d, int k)
+{
+    if (d->count == 0) {
+        return;
+    }
+    while (k > 0) {
+        const int shift = SDL_min(k, SDL_DECIMAL_MAX_SHIFT);
+        SDL_ShiftDecimalLeft(d, shift);
+        k -= shift;
+    }
+    while (k < 0) {
+        const int shift = SDL_min(-k, SDL_DECIMAL_MAX_SHIFT);
+        SDL_ShiftDecimalRight(d, shift);
+        k += shift;
+    }
+}
+
+// Rounds to the nearest integer, ties to even, assuming it fits in 64 bits
+static Uint64 SDL_RoundDecimal(const SDL_Decimal *d)
+{
+    Uint64 n = 0;
+    int i;
+
+    if (d->decimal_point < 0) {
+        return 0;
+    }
+    for (i = 0; i < d->decimal_point; ++i) {
+        n = n * 10 + ((i < d->count) ? d->digits[i] : 0);
+    }
+    if (i < d->count) {
+        const Uint8 digit = d->digits[i];
+        if (digit > 5 || (digit == 5 && (i + 1 < d->count || d->truncated || (n & 1)))) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+static double SDL_DecimalToDouble(SDL_Decimal *d)
+{
+    static const int powers_of_two[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    Uint64 bits;
+    Uint64 mantissa;
+    int exponent = 0;
+    double value;
+
+    if (d->count == 0 || d->decimal_point < -330) {
+        return 0.0;
+    }
+    if (d->decimal_point > 310) {
+        bits = SDL_UINT64_C(0x7FF0000000000000);
+        SDL_memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Scale by powers of two until the value is in [0.5, 1)
+    while (d->decimal_point > 0) {
+        const int n = (d->decimal_point < (int)SDL_arraysize(powers_of_two)) ? powers_of_two[d->decimal_point] : 27;
+        SDL_ShiftDecimal(d, -n);
+        exponent += n;
+    }
+    while (d->decimal_point < 0 || (d->decimal_point == 0 && d->digits[0] < 5)) {
+        const int n = (-d->decimal_point < (int)SDL_arraysize(powers_of_two)) ? powers_of_two[-d->decimal_point] : 27;
+        SDL_ShiftDecimal(d, n);
+        exponent -= n;
+    }
+
+    // The binary exponent is for [1, 2), and denormals stop at -1022
+    --exponent;
+    if (exponent < -1022) {
+        SDL_ShiftDecimal(d, exponent + 1022);
+        exponent = -1022;
+    }
+
+    // Read off 53 bits of mantissa, rounding might carry into a 54th
+    SDL_ShiftDecimal(d, 53);
+    mantissa = SDL_RoundDecimal(d);
+    if (mantissa == ((Uint64)1 << 53)) {
+        mantissa >>= 1;
+        ++exponent;
+    }
+    if (exponent > 1023) {
+        bits = SDL_UINT64_C(0x7FF0000000000000);
+    } else if (mantissa & ((Uint64)1 << 52)) {
+        bits = ((Uint64)(exponent + 1023) << 52) | (mantissa & (((Uint64)1 << 52) - 1));
+    } else {
+        bits = mantissa;  // denormal
+    }
+    SDL_memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/* Powers of five 5^q for q = -364, -336, ..., 308, as the top 128 bits
+ * (rounded down) and a binary exponent. Any power of ten in the range of a
+ * double is one of these times an exact small power of five and a power of two.
+ */
+typedef struct
+{
+    Uint64 high;
+    Uint64 low;
+    int exponent;
+} SDL_PowerOfFive;
+
+#define SDL_POWER_OF_FIVE_MIN  (-364)
+#define SDL_POWER_OF_FIVE_STEP 28
+
+static const SDL_PowerOfFive SDL_coarse_powers_of_five[] = {
+    { SDL_UINT64_C(0xE1AFA13AFBD14D6D), SDL_UINT64_C(0x82189C09A3A1EC21), -973 }, // 5^-364
+    { SDL_UINT64_C(0xE3E27A444D8D98B7), SDL_UINT64_C(0xFD1B1B2308169B25), -908 }, // 5^-336
+    { SDL_UINT64_C(0xE61ACF033D1A45DF), SDL_UINT64_C(0x6FB92487298E33BD), -843 }, // 5^-308
+    { SDL_UINT64_C(0xE858AD248F5C22C9), SDL_UINT64_C(0xD1B3400F8F9CFF68), -778 }, // 5^-280
+    { SDL_UINT64_C(0xEA9C227723EE8BCB), SDL_UINT64_C(0x465E15A979C1CADC), -713 }, // 5^-252
+    { SDL_UINT64_C(0xECE53CEC4A314EBD), SDL_UINT64_C(0xA4F8BF5635246428), -648 }, // 5^-224
+    { SDL_UINT64_C(0xEF340A98172AACE4), SDL_UINT64_C(0x86FB897116C87C34), -583 }, // 5^-196
+    { SDL_UINT64_C(0xF18899B1BC3F8CA1), SDL_UINT64_C(0xDC44E6C3CB279AC1), -518 }, // 5^-168
+    { SDL_UINT64_C(0xF3E2F893DEC3F126), SDL_UINT64_C(0x5A89DBA3C3EFCCFA), -453 }, // 5^-140
+    { SDL_UINT64_C(0xF64335BCF065D37D), SDL_UINT64_C(0x4D4617B5FF4A16D5), -388 }, // 5^-112
+    { SDL_UINT64_C(0xF8A95FCF88747D94), SDL_UINT64_C(0x75A44C6397CE912A), -323 }, // 5^-84
+    { SDL_UINT64_C(0xFB158592BE068D2E), SDL_UINT64_C(0xEED6E2F0F0D56712), -258 }, // 5^-56
+    { SDL_UINT64_C(0xFD87B5F28300CA0D), SDL_UINT64_C(0x8BCA9D6E188853FC), -193 }, // 5^-28
+    { SDL_UINT64_C(0x8000000000000000), SDL_UINT64_C(0x0000000000000000), -127 }, // 5^0
+    { SDL_UINT64_C(0x813F3978F8940984), SDL_UINT64_C(0x4000000000000000), -62 }, // 5^28
+    { SDL_UINT64_C(0x82818F1281ED449F), SDL_UINT64_C(0xBFF8F10E7A8921A4), 3 }, // 5^56
+    { SDL_UINT64_C(0x83C7088E1AAB65DB), SDL_UINT64_C(0x792667C6DA79E0FA), 68 }, // 5^84
+    { SDL_UINT64_C(0x850FADC09923329E), SDL_UINT64_C(0x03E2CF6BC604DDB0), 133 }, // 5^112
+    { SDL_UINT64_C(0x865B86925B9BC5C2), SDL_UINT64_C(0x0B8A2392BA45A9B2), 198 }, // 5^140
+    { SDL_UINT64_C(0x87AA9AFF79042286), SDL_UINT64_C(0x90FB44D2F05D0842), 263 }, // 5^168
+    { SDL_UINT64_C(0x88FCF317F22241E2), SDL_UINT64_C(0x441FECE3BDF81F03), 328 }, // 5^196
+    { SDL_UINT64_C(0x8A5296FFE33CC92F), SDL_UINT64_C(0x82BD6B70D99AAA6F), 393 }, // 5^224
+    { SDL_UINT64_C(0x8BAB8EEFB6409C1A), SDL_UINT64_C(0x1AD089B6C2F7548E), 458 }, // 5^252
+    { SDL_UINT64_C(0x8D07E33455637EB2), SDL_UINT64_C(0xDB0B487B6423E1E8), 523 }, // 5^280
+    { SDL_UINT64_C(0x8E679C2F5E44FF8F), SDL_UINT64_C(0x570F09EAA7EA7648), 588 }, // 5^308
+};
+
+static const Uint64 SDL_fine_powers_of_five[SDL_POWER_OF_FIVE_STEP] = {
+    SDL_UINT64_C(1), SDL_UINT64_C(5), SDL_UINT64_C(25), SDL_UINT64_C(125),
+    SDL_UINT64_C(625), SDL_UINT64_C(3125), SDL_UINT64_C(15625), SDL_UINT64_C(78125),
+    SDL_UINT64_C(390625), SDL_UINT64_C(1953125), SDL_UINT64_C(9765625), SDL_UINT64_C(48828125),
+    SDL_UINT64_C(244140625), SDL_UINT64_C(1220703125), SDL_UINT64_C(6103515625), SDL_UINT64_C(30517578125),
+    SDL_UINT64_C(152587890625), SDL_UINT64_C(762939453125), SDL_UINT64_C(3814697265625), SDL_UINT64_C(19073486328125),
+    SDL_UINT64_C(95367431640625), SDL_UINT64_C(476837158203125), SDL_UINT64_C(2384185791015625), SDL_UINT64_C(11920928955078125),
+    SDL_UINT64_C(59604644775390625), SDL_UINT64_C(298023223876953125), SDL_UINT64_C(1490116119384765625), SDL_UINT64_C(7450580596923828125),
+};
+
+// Multiplies a normalized 128-bit mantissa by a normalized 64-bit one, keeping the top 128 bits
+static int SDL_MultiplyMantissa(Uint64 *high, Uint64 *low, Uint64 factor)
+{
+    Uint64 carry, top;
+    Uint64 middle;
+
+    SDL_Multiply64(*low, factor, &carry);
+    middle = SDL_Multiply64(*high, factor, &top);
+    middle += carry;
+    if (middle < carry) {
+        ++top;
+    }
+    if (top >> 63) {
+        *high = top;
+        *low = middle;
+        return 64;
+    }
+    *high = (top << 1) | (middle >> 63);
+    *low = middle << 1;
+    return 63;
+}
+
+/* Converts mantissa * 10^exponent to the nearest double using 128 bits of
+ * precision, which is enough for all but values within a few units of the
+ * 128th bit of a halfway point. Those, and results outside the range of
+ * normal doubles, are left to the exact conversion.
+ */
+static bool SDL_ScaleMantissaToDouble(Uint64 mantissa, int exponent, double *valuep)
+{
+    Uint64 high, low, fine, bits, tail;
+    int index, shift, binary_exponent;
+
+    if (mantissa == 0 || exponent < -342 || exponent > 308) {
+        return false;
+    }
+
+    // 10^exponent = 5^exponent * 2^exponent, with the error only ever rounding down
+    index = (exponent - SDL_POWER_OF_FIVE_MIN) / SDL_POWER_OF_FIVE_STEP;
+    fine = SDL_fine_powers_of_five[(exponent - SDL_POWER_OF_FIVE_MIN) % SDL_POWER_OF_FIVE_STEP];
+    high = SDL_coarse_powers_of_five[index].high;
+    low = SDL_coarse_powers_of_five[index].low;
+    binary_exponent = SDL_coarse_powers_of_five[index].exponent + exponent;
+    shift = SDL_LeadingZeroes64(fine);
+    binary_exponent += SDL_MultiplyMantissa(&high, &low, fine << shift) - shift;
+    shift = SDL_LeadingZeroes64(mantissa);
+    binary_exponent += SDL_MultiplyMantissa(&high, &low, mantissa << shift) - shift;
+
+    // The value is high:low * 2^binary_exponent, short of the truth by less than 8 in low
+    tail = high & 0x7FF;
+    if ((tail == 0x3FF && low >= ~(Uint64)0 - 8) || (tail == 0x400 && low <= 8)) {
+        return false;
+    }
+    bits = (high >> 11) + (tail >= 0x400);
+    binary_exponent += 127;
+    if (bits == ((Uint64)1 << 53)) {
+        bits >>= 1;
+        ++binary_exponent;
+    }
+    if (binary_exponent < -1022 || binary_exponent > 1023) {
+        return false;
+    }
+    bits = ((Uint64)(binary_exponent + 1023) << 52) | (bits & (((Uint64)1 << 52) - 1));
+    SDL_memcpy(valuep, &bits, sizeof(*valuep));
+    return true;
+}
+
 static size_t SDL_ScanFloat(const char *text, double *valuep)
 {
     const char *text_start = text;
-    const char *number_start = text_start;
-    double value = 0.0;
+    SDL_Decimal decimal;
     bool negative = false;
+    bool seen_digit = false;
+    bool seen_point = false;
+    Uint64 mantissa = 0;
+    double value = 0.0;
 
     while (SDL_isspace(*text)) {
         ++text;
@@ -668,26 +1010,123 @@ static size_t SDL_ScanFloat(const char *text, double *valuep)
         negative = *text == '-';
         ++text;
     }
-    number_start = text;
-    if (SDL_isdigit(*text)) {
-        value += SDL_strtoull(text, (char **)(&text), 10);
-        if (*text == '.') {
-            double denom = 10;
-            ++text;
-            while (SDL_isdigit(*text)) {
-                value += (double)(*text - '0') / denom;
-                denom *= 10;
-                ++text;
+
+    if ((*text == 'i' || *text == 'I' || *text == 'n' || *text == 'N') &&
+        (SDL_strncasecmp(text, "inf", 3) == 0 || SDL_strncasecmp(text, "nan", 3) == 0)) {
+        const Uint64 bits = (SDL_tolower(*text) == 'i') ? SDL_UINT64_C(0x7FF0000000000000) : SDL_UINT64_C(0x7FF8000000000000);
+        text += 3;
+        if (SDL_strncasecmp(text - 3, "infinity", 8) == 0) {
+            text += 5;
+        }
+        SDL_memcpy(&value, &bits, sizeof(value));
+        *valuep = negative ? -value : value;
+        return text - text_start;
+    }
+
+    decimal.count = 0;
+    decimal.decimal_point = 0;
+    decimal.truncated = false;
+    for (;; ++text) {
+        if (*text == '.' && !seen_point) {
+            seen_point = true;
+        } else if (*text >= '0' && *text <= '9') {
+            const Uint8 digit = (Uint8)(*text - '0');
+            seen_digit = true;
+            if (digit == 0 && decimal.count == 0) {
+                // Leading zeroes only move the decimal point
+                if (seen_point) {
+                    --decimal.decimal_point;
+                }
+                continue;
+            }
+            if (decimal.count < 19) {
+                mantissa = mantissa * 10 + digit;
+            }
+            if (decimal.count < SDL_DECIMAL_MAX_DIGITS) {
+                decimal.digits[decimal.count++] = digit;
+            } else if (digit != 0) {
+                decimal.truncated = true;
+            }
+            if (!seen_point) {
+                ++decimal.decimal_point;
             }
+        } else {
+            break;
         }
     }
-    if (text == number_start) {
+    if (!seen_digit) {
         // no number was parsed, and thus no characters were consumed
-        text = text_start;
-    } else if (negative) {
-        value = -value;
+        *valuep = 0.0;
+        return 0;
     }
-    *valuep = value;
+
+    if (*text == 'e' || *text == 'E') {
+        const char *exponent_text = text + 1;
+        bool negative_exponent = false;
+        if (*exponent_text == '-' || *exponent_text == '+') {
+            negative_exponent = *exponent_text == '-';
+            ++exponent_text;
+        }
+        if (SDL_isdigit(*exponent_text)) {
+            int exponent = 0;
+            while (SDL_isdigit(*exponent_text)) {
+                if (exponent < 100000) {
+                    exponent = exponent * 10 + (*exponent_text - '0');
+                }
+                ++exponent_text;
+            }
+            decimal.decimal_point += negative_exponent ? -exponent : exponent;
+            text = exponent_text;
+        }
+    }
+    if (decimal.count > 19) {
+        // Trailing zeroes might bring the digits back into the range of the fast paths
+        int i;
+
+        SDL_TrimDecimal(&decimal);
+        mantissa = 0;
+        for (i = 0; i < decimal.count && i < 19; ++i) {
+            mantissa = mantissa * 10 + decimal.digits[i];
+        }
+    }
+    if (decimal.count == 0) {
+        *valuep = negative ? -0.0 : 0.0;
+        return text - text_start;
+    }
+
+    if (decimal.count <= 19 && !decimal.truncated) {
+        const int exponent = decimal.decimal_point - decimal.count;
+#if !defined(__i386__) || defined(__SSE2_MATH__) // x87 math would round twice
+        {
+            // If the digits and the power of ten are exact, one operation rounds correctly
+            Uint64 scaled = mantissa;
+            int scaled_exponent = exponent;
+
+            while (scaled_exponent > 22 && scaled < SDL_UINT64_C(1000000000000000)) {
+                scaled *= 10;
+                --scaled_exponent;
+            }
+            if (scaled <= ((Uint64)1 << 53) && scaled_exponent >= -22 && scaled_exponent <= 22) {
+                value = (double)scaled;
+                if (scaled_exponent < 0) {
+                    value /= SDL_exact_powers_of_ten[-scaled_exponent];
+                } else {
+                    value *= SDL_exact_powers_of_ten[scaled_exponent];
+                }
+                *valuep = negative ? -value : value;
+                return text - text_start;
+            }
+        }
+#endif
+        if (SDL_ScaleMantissaToDouble(mantissa, exponent, &value)) {
+            *valuep = negative ? -value : value;
+            return text - text_start;
+        }
+    }
+
+    SDL_TrimDecimal(&decimal);
+    value = SDL_DecimalToDouble(&decimal);
+    *valuep = negative ? -value : value;
     return text - text_start;
 }
 #endif
@@ -975,18 +1414,28 @@ size_t SDL_utf8strlcpy(SDL_OUT_Z_CAP(dst_bytes) char *dst, const char *src, size
 
 size_t SDL_utf8strlen(const char *str)
 {
-    size_t result = 0;
-    while (SDL_StepUTF8(&str, NULL)) {
-        result++;
-    }
-    return result;
+    // A sequence cut short by the null terminator is bogus either way, so this counts the same
+    return SDL_utf8strnlen(str, SDL_strlen(str));
 }
 
 size_t SDL_utf8strnlen(const char *str, size_t bytes)
 {
     size_t result = 0;
-    while (SDL_StepUTF8(&str, &bytes)) {
-        result++;
+    while (bytes > 0) {
+        const size_t valid = SDL_ScanUTF8(str, bytes, &result);
+        const char *end;
+
+        str += valid;
+        bytes -= valid;
+
+        // Step through whatever the scan stopped at, then try the fast path again
+        end = str + SDL_min(bytes, 16);
+        while (str < end) {
+            if (!SDL_StepUTF8(&str, &bytes)) {
+                return result;
+            }
+            result++;
+        }
     }
     return result;
 }
@@ -1679,14 +2128,24 @@ int SDL_vsscanf(const char *text, SDL_SCANF_FORMAT_STRING const char *fmt, va_li
                 }
                     done = true;
                     break;
+                case 'e':
+                case 'E':
                 case 'f':
+                case 'F':
+                case 'g':
+                case 'G':
                 {
                     double value = 0.0;
                     advance = SDL_ScanFloat(text, &value);
                     text += advance;
                     if (advance && !suppress) {
-                        float *valuep = va_arg(ap, float *);
-                        *valuep = (float)value;
+                        if (inttype >= DO_LONG) {
+                            double *valuep = va_arg(ap, double *);
+                            *valuep = value;
+                        } else {
+                            float *valuep = va_arg(ap, float *);
+                            *valuep = (float)value;
+                        }
                         ++result;
                     }
                 }
@@ -2028,111 +2487,388 @@ static size_t SDL_PrintUnsignedLongLong(char *text, size_t maxlen, SDL_FormatInf
     return SDL_PrintString(text, maxlen, info, num);
 }
 
-static size_t SDL_PrintFloat(char *text, size_t maxlen, SDL_FormatInfo *info, double arg, bool g)
+/* Floating point numbers are formatted exactly: the value is scaled by a
+ * power of ten as a big integer, rounded half to even, and printed. For the
+ * usual precisions the integer is only a couple of words long.
+ */
+#define SDL_FLOAT_MAX_FRACTION    1074 // every digit after this is zero
+#define SDL_FLOAT_MAX_SIGNIFICANT 800  // every digit after the 767th is zero
+#define SDL_FLOAT_MAX_DIGITS      (309 + SDL_FLOAT_MAX_FRACTION)
+#define SDL_BIGNUM_WORDS          150
+
+typedef struct
 {
-    char num[327];
+    int length;
+    Uint32 words[SDL_BIGNUM_WORDS];
+} SDL_BigNum;
+
+static void SDL_MultiplyBigNum(SDL_BigNum *n, Uint32 factor)
+{
+    Uint64 carry = 0;
+    int i;
+
+    for (i = 0; i < n->length; ++i) {
+        carry += (Uint64)n->words[i] * factor;
+        n->words[i] = (Uint32)carry;
+        carry >>= 32;
+    }
+    if (carry) {
+        SDL_assert(n->length < SDL_BIGNUM_WORDS);
+        n->words[n->length++] = (Uint32)carry;
+    }
+}
+
+// Returns the remainder
+static Uint32 SDL_DivideBigNum(SDL_BigNum *n, Uint32 divisor)
+{
+    Uint64 remainder = 0;
+    int i;
+
+    for (i = n->length; i--; ) {
+        remainder = (remainder << 32) | n->words[i];
+        n->words[i] = (Uint32)(remainder / divisor);
+        remainder %= divisor;
+    }
+    while (n->length > 0 && n->words[n->length - 1] == 0) {
+        --n->length;
+    }
+    return (Uint32)remainder;
+}
+
+static void SDL_ShiftBigNumLeft(SDL_BigNum *n, int bits)
+{
+    const int words = bits / 32;
+    const int shift = bits % 32;
+    int i;
+
+    if (n->length == 0) {
+        return;
+    }
+    SDL_assert(n->length + words < SDL_BIGNUM_WORDS);
+    n->words[n->length + words] = 0;
+    for (i = n->length; i--; ) {
+        if (shift) {
+            n->words[i + words + 1] |= n->words[i] >> (32 - shift);
+        }
+        n->words[i + words] = n->words[i] << shift;
+    }
+    for (i = 0; i < words; ++i) {
+        n->words[i] = 0;
+    }
+    n->length += words + 1;
+    if (n->words[n->length - 1] == 0) {
+        --n->length;
+    }
+}
+
+// Returns whether any of the bits shifted out were set
+static bool SDL_ShiftBigNumRight(SDL_BigNum *n, int bits)
+{
+    const int words = bits / 32;
+    const int shift = bits % 32;
+    bool inexact = false;
+    int i;
+
+    if (words >= n->length) {
+        inexact = (n->length > 0);
+        n->length = 0;
+        return inexact;
+    }
+    for (i = 0; i < words; ++i) {
+        inexact |= (n->words[i] != 0);
+    }
+    if (shift) {
+        inexact |= ((n->words[words] & ((1u << shift) - 1)) != 0);
+    }
+    for (i = words; i < n->length; ++i) {
+        Uint32 word = n->words[i] >> shift;
+        if (shift && i + 1 < n->length) {
+            word |= n->words[i + 1] << (32 - shift);
+        }
+        n->words[i - words] = word;
+    }
+    n->length -= words;
+    while (n->length > 0 && n->words[n->length - 1] == 0) {
+        --n->length;
+    }
+    return inexact;
+}
+
+static const Uint64 SDL_powers_of_ten64[] = {
+    SDL_UINT64_C(1), SDL_UINT64_C(10), SDL_UINT64_C(100), SDL_UINT64_C(1000),
+    SDL_UINT64_C(10000), SDL_UINT64_C(100000), SDL_UINT64_C(1000000), SDL_UINT64_C(10000000),
+    SDL_UINT64_C(100000000), SDL_UINT64_C(1000000000), SDL_UINT64_C(10000000000), SDL_UINT64_C(100000000000),
+    SDL_UINT64_C(1000000000000), SDL_UINT64_C(10000000000000), SDL_UINT64_C(100000000000000), SDL_UINT64_C(1000000000000000),
+    SDL_UINT64_C(10000000000000000), SDL_UINT64_C(100000000000000000), SDL_UINT64_C(1000000000000000000), SDL_UINT64_C(10000000000000000000)
+};
+
+// Sets n to mantissa * 2^exponent * 10^scale, rounded half to even
+static void SDL_ScaleFloat(SDL_BigNum *n, Uint64 mantissa, int exponent, int scale)
+{
+    static const Uint32 powers_of_ten[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    bool inexact = false;
+    bool half;
+
+    if (exponent < 0 && exponent > -128 && scale >= 0 && scale < (int)SDL_arraysize(SDL_powers_of_ten64)) {
+        // The scaled value fits in 128 bits, so shift and round it directly if the result fits in 64
+        const int shift = -exponent;
+        Uint64 high, low, rest_high, rest_low, half_high, half_low;
+        Uint64 quotient;
+        bool fits;
+
+        low = SDL_Multiply64(mantissa, SDL_powers_of_ten64[scale], &high);
+        if (shift < 64) {
+            fits = ((high >> shift) == 0);
+            quotient = (low >> shift) | (high << (64 - shift));
+            rest_high = 0;
+            rest_low = low & (((Uint64)1 << shift) - 1);
+            half_high = 0;
+            half_low = (Uint64)1 << (shift - 1);
+        } else {
+            fits = true;
+            quotient = high >> (shift - 64);
+            rest_high = high & (((Uint64)1 << (shift - 64)) - 1);
+            rest_low = low;
+            half_high = (shift > 64) ? ((Uint64)1 << (shift - 65)) : 0;
+            half_low = (shift > 64) ? 0 : ((Uint64)1 << 63);
+        }
+        if (rest_high > half_high || (rest_high == half_high && (rest_low > half_low || (rest_low == half_low && (quotient & 1))))) {
+            fits = fits && (quotient != ~(Uint64)0);
+            ++quotient;
+        }
+        if (fits) {
+            n->words[0] = (Uint32)quotient;
+            n->words[1] = (Uint32)(quotient >> 32);
+            n->length = n->words[1] ? 2 : (n->words[0] ? 1 : 0);
+            return;
+        }
+    }
+
+    n->words[0] = (Uint32)mantissa;
+    n->words[1] = (Uint32)(mantissa >> 32);
+    n->length = n->words[1] ? 2 : (n->words[0] ? 1 : 0);
+
+    for (; scale >= 9; scale -= 9) {
+        SDL_MultiplyBigNum(n, powers_of_ten[9]);
+    }
+    if (scale > 0) {
+        SDL_MultiplyBigNum(n, powers_of_ten[scale]);
+    }
+
+    // Keep one more bit than needed, to round with
+    SDL_ShiftBigNumLeft(n, 1 + SDL_max(exponent, 0));
+    for (; scale <= -9; scale += 9) {
+        inexact |= (SDL_DivideBigNum(n, powers_of_ten[9]) != 0);
+    }
+    if (scale < 0) {
+        inexact |= (SDL_DivideBigNum(n, powers_of_ten[-scale]) != 0);
+    }
+    if (exponent < 0) {
+        inexact |= SDL_ShiftBigNumRight(n, -exponent);
+    }
+    half = (n->length > 0 && (n->words[0] & 1));
+    SDL_ShiftBigNumRight(n, 1);
+    if (half && (inexact || (n->length > 0 && (n->words[0] & 1)))) {
+        int i;
+        for (i = 0; i < n->length && ++n->words[i] == 0; ++i) {
+        }
+        if (i == n->length) {
+            n->words[n->length++] = 1;
+        }
+    }
+}
+
+// Writes the decimal digits of a (destroyed) big number, returning how many there are
+static size_t SDL_BigNumDigits(SDL_BigNum *n, char *digits, size_t maxlen)
+{
+    size_t start = maxlen;
+    size_t length;
+
+    while (n->length > 0) {
+        Uint32 chunk;
+        if (n->length <= 2) {
+            // Dividing by a constant is much cheaper than the general case
+            Uint64 value = ((Uint64)n->words[n->length - 1] << 32 * (n->length - 1)) | (n->length > 1 ? n->words[0] : 0);
+            chunk = (Uint32)(value % 1000000000);
+            value /= 1000000000;
+            n->words[0] = (Uint32)value;
+            n->words[1] = (Uint32)(value >> 32);
+            n->length = n->words[1] ? 2 : (n->words[0] ? 1 : 0);
+        } else {
+            chunk = SDL_DivideBigNum(n, 1000000000);
+        }
+        int i;
+        for (i = 0; i < 9 && (n->length > 0 || chunk); ++i) {
+            SDL_assert(start > 0);
+            digits[--start] = '0' + (char)(chunk % 10);
+            chunk /= 10;
+        }
+    }
+    length = maxlen - start;
+    SDL_memmove(digits, &digits[start], length);
+    return length;
+}
+
+// Writes `count` significant digits of a positive value and returns its decimal exponent
+static int SDL_SignificantDigits(Uint64 mantissa, int exponent, int count, char *digits)
+{
+    SDL_BigNum n;
+    const int bits = exponent + 63 - SDL_LeadingZeroes64(mantissa);
+    int decimal_exponent;
+
+    // This estimate of floor(bits * log10(2)) is never too large, and at most one too small
+    if (bits >= 0) {
+        decimal_exponent = (bits * 78913) >> 18;
+    } else {
+        decimal_exponent = -(((-bits * 78913) >> 18) + 1);
+    }
+
+    for (;;) {
+        SDL_ScaleFloat(&n, mantissa, exponent, count - 1 - decimal_exponent);
+        if (SDL_BigNumDigits(&n, digits, SDL_FLOAT_MAX_DIGITS) == (size_t)count) {
+            return decimal_exponent;
+        }
+        ++decimal_exponent;
+    }
+}
+
+static size_t SDL_PrintFloat(char *text, size_t maxlen, SDL_FormatInfo *info, double arg, char format)
+{
+    char num[SDL_FLOAT_MAX_DIGITS + 16];
+    char digits[SDL_FLOAT_MAX_DIGITS];
     size_t length = 0;
-    size_t integer_length;
+    size_t num_digits = 0;
     int precision = info->precision;
+    int decimal_exponent = 0;
+    bool trim_zeroes = false;
+    Uint64 bits;
+    Uint64 mantissa;
+    int exponent;
 
-    // This isn't especially accurate, but hey, it's easy. :)
-    unsigned long long value;
+    SDL_memcpy(&bits, &arg, sizeof(bits));
+    mantissa = bits & ((SDL_UINT64_C(1) << 52) - 1);
+    exponent = (int)((bits >> 52) & 0x7FF);
 
-    if (arg < 0.0 || (arg == 0.0 && 1.0 / arg < 0.0)) { // additional check for signed zero
+    if (bits >> 63) {
         num[length++] = '-';
-        arg = -arg;
     } else if (info->force_sign) {
         num[length++] = '+';
     }
-    value = (unsigned long long)arg;
-    integer_length = SDL_PrintUnsignedLongLong(&num[length], sizeof(num) - length, NULL, value);
-    length += integer_length;
-    arg -= value;
+
+    if (exponent == 0x7FF) {
+        SDL_strlcpy(&num[length], mantissa ? "nan" : "inf", sizeof(num) - length);
+        info->pad_zeroes = false;
+        info->precision = -1;
+        return SDL_PrintString(text, maxlen, info, num);
+    }
+    if (exponent) {
+        mantissa |= (SDL_UINT64_C(1) << 52);
+        exponent -= 1075;
+    } else {
+        exponent = -1074;
+    }
+
     if (precision < 0) {
         precision = 6;
     }
-    if (g) {
-        // The precision includes the integer portion
-        precision -= SDL_min((int)integer_length, precision);
-    }
-    if (info->force_type || precision > 0) {
-        const char decimal_separator = '.';
-        double integer_value;
-
-        SDL_assert(length < sizeof(num));
-        num[length++] = decimal_separator;
-        while (precision > 1) {
-            arg *= 10.0;
-            arg = SDL_modf(arg, &integer_value);
-            SDL_assert(length < sizeof(num));
-            num[length++] = '0' + (char)integer_value;
-            --precision;
-        }
-        if (precision == 1) {
-            arg *= 10.0;
-            integer_value = SDL_round(arg);
-            if (integer_value == 10.0) {
-                // Carry the one...
-                size_t i;
-
-                for (i = length; i--; ) {
-                    if (num[i] == decimal_separator) {
-                        continue;
-                    }
-                    if (num[i] == '9') {
-                        num[i] = '0';
-                        if (i == 0 || num[i - 1] == '-' || num[i - 1] == '+') {
-                            SDL_memmove(&num[i+1], &num[i], length - i);
-                            num[i] = '1';
-                            ++length;
-                            break;
-                        }
-                    } else {
-                        ++num[i];
-                        break;
-                    }
-                }
-                SDL_assert(length < sizeof(num));
-                num[length++] = '0';
-            } else {
-                SDL_assert(length < sizeof(num));
-                num[length++] = '0' + (char)integer_value;
-            }
+    if (format == 'g') {
+        // Use the shorter of the two forms, without trailing zeroes
+        if (precision == 0) {
+            precision = 1;
         }
-
-        if (g) {
-            // Trim trailing zeroes and decimal separator
-            size_t i;
-
-            for (i = length - 1; num[i] != decimal_separator; --i) {
-                if (num[i] == '0') {
-                    --length;
-                } else {
-                    break;
-                }
+        precision = SDL_min(precision, SDL_FLOAT_MAX_SIGNIFICANT);
+        if (mantissa) {
+            decimal_exponent = SDL_SignificantDigits(mantissa, exponent, precision, digits);
+        } else {
+            SDL_memset(digits, '0', precision);
+        }
+        num_digits = precision;
+        if (decimal_exponent < precision && decimal_exponent >= -4) {
+            format = 'f';
+            precision = precision - 1 - decimal_exponent;
+        } else {
+            format = 'e';
+            precision = precision - 1;
+        }
+        trim_zeroes = !info->force_type;
+    } else if (format == 'e') {
+        precision = SDL_min(precision, SDL_FLOAT_MAX_SIGNIFICANT - 1);
+        if (mantissa) {
+            decimal_exponent = SDL_SignificantDigits(mantissa, exponent, precision + 1, digits);
+        } else {
+            SDL_memset(digits, '0', precision + 1);
+        }
+        num_digits = precision + 1;
+    } else {
+        SDL_BigNum n;
+        precision = SDL_min(precision, SDL_FLOAT_MAX_FRACTION);
+        SDL_ScaleFloat(&n, mantissa, exponent, precision);
+        num_digits = SDL_BigNumDigits(&n, digits, sizeof(digits));
+        decimal_exponent = (int)num_digits - 1 - precision;
+    }
+
+    if (format == 'f') {
+        // The digits are scaled so the last one is the last decimal place
+        int i;
+        if (decimal_exponent < 0) {
+            num[length++] = '0';
+        } else {
+            SDL_memcpy(&num[length], digits, decimal_exponent + 1);
+            length += decimal_exponent + 1;
+        }
+        if (precision > 0 || info->force_type) {
+            num[length++] = '.';
+        }
+        for (i = -1; i >= decimal_exponent + 1 && i >= -precision; --i) {
+            num[length++] = '0';
+        }
+        for (i = SDL_max(decimal_exponent + 1, 0); i < (int)num_digits; ++i) {
+            num[length++] = digits[i];
+        }
+    } else {
+        const int magnitude = SDL_abs(decimal_exponent);
+        num[length++] = digits[0];
+        if (precision > 0 || info->force_type) {
+            num[length++] = '.';
+        }
+        SDL_memcpy(&num[length], &digits[1], num_digits - 1);
+        length += num_digits - 1;
+        if (trim_zeroes) {
+            while (num[length - 1] == '0') {
+                --length;
             }
-            if (num[i] == decimal_separator) {
+            if (num[length - 1] == '.') {
                 --length;
             }
+            trim_zeroes = false;
+        }
+        num[length++] = 'e';
+        num[length++] = (decimal_exponent < 0) ? '-' : '+';
+        if (magnitude >= 100) {
+            num[length++] = '0' + (char)(magnitude / 100);
+        }
+        num[length++] = '0' + (char)((magnitude / 10) % 10);
+        num[length++] = '0' + (char)(magnitude % 10);
+    }
+    if (trim_zeroes && precision > 0) {
+        while (num[length - 1] == '0') {
+            --length;
+        }
+        if (num[length - 1] == '.') {
+            --length;
         }
     }
     num[length] = '\0';
 
     info->precision = -1;
-    length = SDL_PrintString(text, maxlen, info, num);
-
-    if (info->width > 0 && (size_t)info->width > length) {
-        const char fill = info->pad_zeroes ? '0' : ' ';
-        size_t width = info->width - length;
-        size_t filllen, movelen;
-
-        filllen = SDL_min(width, maxlen);
-        movelen = SDL_min(length, (maxlen - filllen));
-        SDL_memmove(&text[filllen], text, movelen);
-        SDL_memset(text, fill, filllen);
-        length += width;
+    if (info->pad_zeroes && !info->left_justify && (num[0] == '-' || num[0] == '+') && info->width > 1) {
+        // The zeroes go between the sign and the digits
+        const char sign[2] = { num[0], '\0' };
+        size_t sign_length = SDL_PrintString(text, maxlen, NULL, sign);
+        --info->width;
+        return sign_length + SDL_PrintString(maxlen > 1 ? text + 1 : NULL, maxlen > 1 ? maxlen - 1 : 0, info, &num[1]);
     }
-    return length;
+    return SDL_PrintString(text, maxlen, info, num);
 }
 
 static size_t SDL_PrintPointer(char *text, size_t maxlen, SDL_FormatInfo *info, const void *value)
@@ -2326,12 +3062,15 @@ int SDL_vsnprintf(SDL_OUT_Z_CAP(maxlen) char *text, size_t maxlen, SDL_PRINTF_FO
                     }
                     done = true;
                     break;
+                case 'E':
+                case 'F':
+                case 'G':
+                    info.force_case = SDL_CASE_UPPER;
+                    SDL_FALLTHROUGH;
+                case 'e':
                 case 'f':
-                    length += SDL_PrintFloat(TEXT_AND_LEN_ARGS, &info, va_arg(ap, double), false);
-                    done = true;
-                    break;
                 case 'g':
-                    length += SDL_PrintFloat(TEXT_AND_LEN_ARGS, &info, va_arg(ap, double), true);
+                    length += SDL_PrintFloat(TEXT_AND_LEN_ARGS, &info, va_arg(ap, double), (char)SDL_tolower(*fmt));
                     done = true;
                     break;
                 case 'S':
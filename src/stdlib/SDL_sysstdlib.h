@@ -28,5 +28,15 @@
 // this expects `from` to be a Unicode codepoint, and `to` to point to AT LEAST THREE Uint32s.
 int SDL_CaseFoldUnicode(Uint32 from, Uint32 *to);
 
+// Returns how many bytes at the start of `str` are valid UTF-8 without a null terminator, ending on a codepoint boundary, and adds the number of codepoints in them to `*count`.
+// This may stop early (or not scan at all, for short strings), so the caller has to step through the rest.
+size_t SDL_ScanUTF8(const char *str, size_t len, size_t *count);
+
+// These convert the leading ASCII characters of `src` to or from host order UTF-16 and UTF-32 and return how many were converted. `len` is in characters.
+size_t SDL_ASCIIToUTF16(void *dst, const char *src, size_t len);
+size_t SDL_ASCIIToUTF32(void *dst, const char *src, size_t len);
+size_t SDL_UTF16ToASCII(char *dst, const void *src, size_t len);
+size_t SDL_UTF32ToASCII(char *dst, const void *src, size_t len);
+
 #endif
 
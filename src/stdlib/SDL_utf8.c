@@ -0,0 +1,549 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// This file contains vectorized helpers for the UTF-8 string functions and SDL_iconv()
+
+#include "SDL_sysstdlib.h"
+
+/* The UTF-8 validation below is the lookup table algorithm from
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser
+ * and Daniel Lemire. Each byte is classified by the high and low nibble of
+ * the byte before it and the high nibble of the byte itself, and the three
+ * classifications are ANDed together. Anything left over is an error,
+ * except for the continuation bytes that the byte two or three positions
+ * back says are expected.
+ */
+#define TOO_SHORT      (1 << 0) // 11______ 0_______ or 11______ 11______
+#define TOO_LONG       (1 << 1) // 0_______ 10______
+#define OVERLONG_3     (1 << 2) // 11100000 100_____
+#define TOO_LARGE      (1 << 3) // 11110100 1001____ and up
+#define SURROGATE      (1 << 4) // 11101101 101_____
+#define OVERLONG_2     (1 << 5) // 1100000_ 10______
+#define TOO_LARGE_1000 (1 << 6) // 11110101 1000____ and up
+#define OVERLONG_4     (1 << 6) // 11110000 1000____
+#define TWO_CONTS      (1 << 7) // 10______ 10______
+#define CARRY          (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+// Classified by the high nibble of the previous byte
+#define UTF8_BYTE_1_HIGH                                                    \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,                                 \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,                                 \
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,                             \
+    TOO_SHORT | OVERLONG_2,                                                 \
+    TOO_SHORT,                                                              \
+    TOO_SHORT | OVERLONG_3 | SURROGATE,                                     \
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+
+// Classified by the low nibble of the previous byte
+#define UTF8_BYTE_1_LOW                                                     \
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,                           \
+    CARRY | OVERLONG_2,                                                     \
+    CARRY,                                                                  \
+    CARRY,                                                                  \
+    CARRY | TOO_LARGE,                                                      \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,                         \
+    CARRY | TOO_LARGE | TOO_LARGE_1000,                                     \
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+
+// Classified by the high nibble of the byte itself
+#define UTF8_BYTE_2_HIGH                                                    \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,                             \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,                             \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,             \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,              \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,              \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+/* The vector loops stop at the first block containing an error, which may
+ * be in the middle of a sequence that started in the previous block. Back up
+ * to the lead byte of that sequence so the caller can step through it one
+ * codepoint at a time, and uncount the lead byte.
+ */
+static size_t BackUpToCodepoint(const Uint8 *src, size_t valid, size_t *count)
+{
+    size_t lead = valid;
+    size_t length;
+
+    while (lead > 0 && (valid - lead) < 3 && (src[lead - 1] & 0xC0) == 0x80) {
+        --lead;
+    }
+    if (lead == 0 || src[lead - 1] < 0xC0) {
+        return valid;
+    }
+    --lead;
+
+    if (src[lead] >= 0xF0) {
+        length = 4;
+    } else if (src[lead] >= 0xE0) {
+        length = 3;
+    } else {
+        length = 2;
+    }
+    if ((valid - lead) < length) {
+        --*count;
+        return lead;
+    }
+    return valid;
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static size_t SDL_TARGETING("avx2") ScanUTF8_AVX2(const Uint8 *src, size_t len, size_t *count)
+{
+    const __m256i byte_1_high_table = _mm256_setr_epi8(UTF8_BYTE_1_HIGH, UTF8_BYTE_1_HIGH);
+    const __m256i byte_1_low_table = _mm256_setr_epi8(UTF8_BYTE_1_LOW, UTF8_BYTE_1_LOW);
+    const __m256i byte_2_high_table = _mm256_setr_epi8(UTF8_BYTE_2_HIGH, UTF8_BYTE_2_HIGH);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i prev = zero;
+    __m256i counts = zero;
+    size_t valid = 0;
+    Uint64 sums[4];
+
+    while (len - valid >= 32) {
+        const __m256i input = _mm256_loadu_si256((const __m256i *)(src + valid));
+        const __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+        const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+        const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+        const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+        const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+        const __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble));
+        const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+        const __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+        const __m256i must_be_continuation = _mm256_and_si256(
+            _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80))),
+                            _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)))),
+            _mm256_set1_epi8((char)0x80));
+        const __m256i error = _mm256_or_si256(_mm256_xor_si256(must_be_continuation, special),
+                                              _mm256_cmpeq_epi8(input, zero));
+
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        // Count everything that isn't a continuation byte
+        counts = _mm256_add_epi64(counts, _mm256_sad_epu8(
+            _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8(-65)), _mm256_set1_epi8(1)), zero));
+
+        prev = input;
+        valid += 32;
+    }
+
+    _mm256_storeu_si256((__m256i *)sums, counts);
+    *count += (size_t)(sums[0] + sums[1] + sums[2] + sums[3]);
+    return BackUpToCodepoint(src, valid, count);
+}
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static size_t SDL_TARGETING("sse4.1") ScanUTF8_SSE41(const Uint8 *src, size_t len, size_t *count)
+{
+    const __m128i byte_1_high_table = _mm_setr_epi8(UTF8_BYTE_1_HIGH);
+    const __m128i byte_1_low_table = _mm_setr_epi8(UTF8_BYTE_1_LOW);
+    const __m128i byte_2_high_table = _mm_setr_epi8(UTF8_BYTE_2_HIGH);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i prev = zero;
+    __m128i counts = zero;
+    size_t valid = 0;
+    Uint64 sums[2];
+
+    while (len - valid >= 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i *)(src + valid));
+        const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+        const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+        const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+        const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+        const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+        const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+        const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+        const __m128i must_be_continuation = _mm_and_si128(
+            _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80))),
+                         _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)))),
+            _mm_set1_epi8((char)0x80));
+        const __m128i error = _mm_or_si128(_mm_xor_si128(must_be_continuation, special),
+                                           _mm_cmpeq_epi8(input, zero));
+
+        if (!_mm_testz_si128(error, error)) {
+            break;
+        }
+
+        // Count everything that isn't a continuation byte
+        counts = _mm_add_epi64(counts, _mm_sad_epu8(
+            _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(-65)), _mm_set1_epi8(1)), zero));
+
+        prev = input;
+        valid += 16;
+    }
+
+    _mm_storeu_si128((__m128i *)sums, counts);
+    *count += (size_t)(sums[0] + sums[1]);
+    return BackUpToCodepoint(src, valid, count);
+}
+#endif
+
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+static size_t ScanUTF8_NEON(const Uint8 *src, size_t len, size_t *count)
+{
+    static const Uint8 byte_1_high_values[16] = { UTF8_BYTE_1_HIGH };
+    static const Uint8 byte_1_low_values[16] = { UTF8_BYTE_1_LOW };
+    static const Uint8 byte_2_high_values[16] = { UTF8_BYTE_2_HIGH };
+    const uint8x16_t byte_1_high_table = vld1q_u8(byte_1_high_values);
+    const uint8x16_t byte_1_low_table = vld1q_u8(byte_1_low_values);
+    const uint8x16_t byte_2_high_table = vld1q_u8(byte_2_high_values);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    uint8x16_t prev = vdupq_n_u8(0);
+    uint64x2_t counts = vdupq_n_u64(0);
+    size_t valid = 0;
+
+    while (len - valid >= 16) {
+        const uint8x16_t input = vld1q_u8(src + valid);
+        const uint8x16_t prev1 = vextq_u8(prev, input, 15);
+        const uint8x16_t prev2 = vextq_u8(prev, input, 14);
+        const uint8x16_t prev3 = vextq_u8(prev, input, 13);
+        const uint8x16_t byte_1_high = vqtbl1q_u8(byte_1_high_table, vshrq_n_u8(prev1, 4));
+        const uint8x16_t byte_1_low = vqtbl1q_u8(byte_1_low_table, vandq_u8(prev1, nibble));
+        const uint8x16_t byte_2_high = vqtbl1q_u8(byte_2_high_table, vshrq_n_u8(input, 4));
+        const uint8x16_t special = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+        const uint8x16_t must_be_continuation = vandq_u8(
+            vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80)),
+                     vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80))),
+            vdupq_n_u8(0x80));
+        const uint8x16_t error = vorrq_u8(veorq_u8(must_be_continuation, special),
+                                          vceqq_u8(input, vdupq_n_u8(0)));
+
+        if (vmaxvq_u8(error) != 0) {
+            break;
+        }
+
+        // Count everything that isn't a continuation byte
+        counts = vpadalq_u32(counts, vpaddlq_u16(vpaddlq_u8(
+            vshrq_n_u8(vcgtq_s8(vreinterpretq_s8_u8(input), vdupq_n_s8(-65)), 7))));
+
+        prev = input;
+        valid += 16;
+    }
+
+    *count += (size_t)vaddvq_u64(counts);
+    return BackUpToCodepoint(src, valid, count);
+}
+#endif
+
+size_t SDL_ScanUTF8(const char *str, size_t len, size_t *count)
+{
+    const Uint8 *src = (const Uint8 *)str;
+
+    if (len < 16) {
+        return 0;
+    }
+#ifdef SDL_AVX2_INTRINSICS
+    if (len >= 32 && SDL_HasAVX2()) {
+        return ScanUTF8_AVX2(src, len, count);
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return ScanUTF8_SSE41(src, len, count);
+    }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+    return ScanUTF8_NEON(src, len, count);
+#else
+    (void)src;
+    (void)count;
+    return 0;
+#endif
+}
+
+/* The ASCII conversions only handle the host byte order, and write through
+ * byte pointers because SDL_iconv() buffers don't have to be aligned.
+ */
+static void StoreUnit16(Uint8 *dst, Uint16 unit)
+{
+    SDL_memcpy(dst, &unit, sizeof(unit));
+}
+
+static void StoreUnit32(Uint8 *dst, Uint32 unit)
+{
+    SDL_memcpy(dst, &unit, sizeof(unit));
+}
+
+static Uint16 LoadUnit16(const Uint8 *src)
+{
+    Uint16 unit;
+    SDL_memcpy(&unit, src, sizeof(unit));
+    return unit;
+}
+
+static Uint32 LoadUnit32(const Uint8 *src)
+{
+    Uint32 unit;
+    SDL_memcpy(&unit, src, sizeof(unit));
+    return unit;
+}
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#ifdef SDL_SSE2_INTRINSICS
+#define SDL_UTF_ASCII_SSE2
+#elif defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+#define SDL_UTF_ASCII_NEON
+#endif
+#endif
+
+#ifdef SDL_UTF_ASCII_SSE2
+static size_t SDL_TARGETING("sse2") ASCIIToUTF16_SSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(input)) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dst + i * 2), _mm_unpacklo_epi8(input, zero));
+        _mm_storeu_si128((__m128i *)(dst + i * 2 + 16), _mm_unpackhi_epi8(input, zero));
+    }
+    return i;
+}
+
+static size_t SDL_TARGETING("sse2") ASCIIToUTF32_SSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo, hi;
+        if (_mm_movemask_epi8(input)) {
+            break;
+        }
+        lo = _mm_unpacklo_epi8(input, zero);
+        hi = _mm_unpackhi_epi8(input, zero);
+        _mm_storeu_si128((__m128i *)(dst + i * 4), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dst + i * 4 + 16), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dst + i * 4 + 32), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(dst + i * 4 + 48), _mm_unpackhi_epi16(hi, zero));
+    }
+    return i;
+}
+
+static size_t SDL_TARGETING("sse2") UTF16ToASCII_SSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const __m128i non_ascii = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + i * 2));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + i * 2 + 16));
+        const __m128i high = _mm_and_si128(_mm_or_si128(a, b), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+static size_t SDL_TARGETING("sse2") UTF32ToASCII_SSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const __m128i non_ascii = _mm_set1_epi32((int)0xFFFFFF80);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + i * 4 + 16));
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + i * 4 + 32));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(src + i * 4 + 48));
+        const __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    return i;
+}
+#endif // SDL_UTF_ASCII_SSE2
+
+#ifdef SDL_UTF_ASCII_NEON
+static size_t ASCIIToUTF16_NEON(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const uint8x16_t input = vld1q_u8(src + i);
+        if (vmaxvq_u8(input) >= 0x80) {
+            break;
+        }
+        vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(vmovl_u8(vget_low_u8(input))));
+        vst1q_u8(dst + i * 2 + 16, vreinterpretq_u8_u16(vmovl_u8(vget_high_u8(input))));
+    }
+    return i;
+}
+
+static size_t ASCIIToUTF32_NEON(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const uint8x16_t input = vld1q_u8(src + i);
+        uint16x8_t lo, hi;
+        if (vmaxvq_u8(input) >= 0x80) {
+            break;
+        }
+        lo = vmovl_u8(vget_low_u8(input));
+        hi = vmovl_u8(vget_high_u8(input));
+        vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(lo))));
+        vst1q_u8(dst + i * 4 + 16, vreinterpretq_u8_u32(vmovl_u16(vget_high_u16(lo))));
+        vst1q_u8(dst + i * 4 + 32, vreinterpretq_u8_u32(vmovl_u16(vget_low_u16(hi))));
+        vst1q_u8(dst + i * 4 + 48, vreinterpretq_u8_u32(vmovl_u16(vget_high_u16(hi))));
+    }
+    return i;
+}
+
+static size_t UTF16ToASCII_NEON(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const uint16x8_t a = vreinterpretq_u16_u8(vld1q_u8(src + i * 2));
+        const uint16x8_t b = vreinterpretq_u16_u8(vld1q_u8(src + i * 2 + 16));
+        if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) {
+            break;
+        }
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+    }
+    return i;
+}
+
+static size_t UTF32ToASCII_NEON(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        const uint32x4_t a = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        const uint32x4_t b = vreinterpretq_u32_u8(vld1q_u8(src + i * 4 + 16));
+        const uint32x4_t c = vreinterpretq_u32_u8(vld1q_u8(src + i * 4 + 32));
+        const uint32x4_t d = vreinterpretq_u32_u8(vld1q_u8(src + i * 4 + 48));
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+            break;
+        }
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(a), vmovn_u32(b))),
+                                      vmovn_u16(vcombine_u16(vmovn_u32(c), vmovn_u32(d)))));
+    }
+    return i;
+}
+#endif // SDL_UTF_ASCII_NEON
+
+size_t SDL_ASCIIToUTF16(void *dst, const char *src, size_t len)
+{
+    Uint8 *out = (Uint8 *)dst;
+    const Uint8 *in = (const Uint8 *)src;
+    size_t i = 0;
+
+#ifdef SDL_UTF_ASCII_SSE2
+    if (SDL_HasSSE2()) {
+        i = ASCIIToUTF16_SSE2(out, in, len);
+    }
+#elif defined(SDL_UTF_ASCII_NEON)
+    i = ASCIIToUTF16_NEON(out, in, len);
+#endif
+    for (; i < len && in[i] < 0x80; ++i) {
+        StoreUnit16(out + i * 2, in[i]);
+    }
+    return i;
+}
+
+size_t SDL_ASCIIToUTF32(void *dst, const char *src, size_t len)
+{
+    Uint8 *out = (Uint8 *)dst;
+    const Uint8 *in = (const Uint8 *)src;
+    size_t i = 0;
+
+#ifdef SDL_UTF_ASCII_SSE2
+    if (SDL_HasSSE2()) {
+        i = ASCIIToUTF32_SSE2(out, in, len);
+    }
+#elif defined(SDL_UTF_ASCII_NEON)
+    i = ASCIIToUTF32_NEON(out, in, len);
+#endif
+    for (; i < len && in[i] < 0x80; ++i) {
+        StoreUnit32(out + i * 4, in[i]);
+    }
+    return i;
+}
+
+size_t SDL_UTF16ToASCII(char *dst, const void *src, size_t len)
+{
+    Uint8 *out = (Uint8 *)dst;
+    const Uint8 *in = (const Uint8 *)src;
+    size_t i = 0;
+
+#ifdef SDL_UTF_ASCII_SSE2
+    if (SDL_HasSSE2()) {
+        i = UTF16ToASCII_SSE2(out, in, len);
+    }
+#elif defined(SDL_UTF_ASCII_NEON)
+    i = UTF16ToASCII_NEON(out, in, len);
+#endif
+    for (; i < len; ++i) {
+        const Uint16 unit = LoadUnit16(in + i * 2);
+        if (unit >= 0x80) {
+            break;
+        }
+        out[i] = (Uint8)unit;
+    }
+    return i;
+}
+
+size_t SDL_UTF32ToASCII(char *dst, const void *src, size_t len)
+{
+    Uint8 *out = (Uint8 *)dst;
+    const Uint8 *in = (const Uint8 *)src;
+    size_t i = 0;
+
+#ifdef SDL_UTF_ASCII_SSE2
+    if (SDL_HasSSE2()) {
+        i = UTF32ToASCII_SSE2(out, in, len);
+    }
+#elif defined(SDL_UTF_ASCII_NEON)
+    i = UTF32ToASCII_NEON(out, in, len);
+#endif
+    for (; i < len; ++i) {
+        const Uint32 unit = LoadUnit32(in + i * 4);
+        if (unit >= 0x80) {
+            break;
+        }
+        out[i] = (Uint8)unit;
+    }
+    return i;
+}
@@ -391,9 +391,34 @@ static bool GlobStorageDirectoryGetPathInfo(const char *path, SDL_PathInfo *info
     return SDL_GetStoragePathInfo((SDL_Storage *) userdata, path, info);
 }
 
-static bool GlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+typedef struct GlobStorageEnumerateData
 {
-    return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, cb, cbuserdata);
+    SDL_SYS_EnumerateDirectoryCallback callback;
+    void *userdata;
+} GlobStorageEnumerateData;
+
+static SDL_EnumerationResult SDLCALL GlobStorageDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+{
+    const GlobStorageEnumerateData *data = (const GlobStorageEnumerateData *)userdata;
+    return data->callback(data->userdata, dirname, fname, SDL_PATHTYPE_NONE);
+}
+
+static bool GlobStorageDirectoryEnumerator(const char *path, SDL_SYS_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+{
+    GlobStorageEnumerateData data;
+    bool result;
+
+    // storage implementations might hold on to the path while enumerating, so give them a copy.
+    char *pathcpy = SDL_strdup(path);
+    if (!pathcpy) {
+        return false;
+    }
+
+    data.callback = cb;
+    data.userdata = cbuserdata;
+    result = SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, pathcpy, GlobStorageDirectoryCallback, &data);
+    SDL_free(pathcpy);
+    return result;
 }
 
 char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
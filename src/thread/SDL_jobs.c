@@ -0,0 +1,590 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Work-stealing job system
+
+#include "SDL_thread_c.h"
+
+/* Each worker thread pushes and pops the jobs it submits at the tail of its
+   own queue, so nested jobs run depth first while their data is still in the
+   cache, and idle workers steal the oldest jobs from the head of somebody
+   else's queue. Jobs submitted from other threads go into a shared queue. */
+#define SDL_JOB_QUEUE_INITIAL_SIZE  64
+
+// SDL_ParallelFor() never uses more helper jobs than this
+#define SDL_MAX_PARALLEL_FOR_JOBS   64
+
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_Job **jobs;
+    Uint32 capacity; // always a power of two
+    Uint32 head;     // index of the oldest job, wraps around
+    Uint32 tail;     // index after the newest job, wraps around
+} SDL_JobQueue;
+
+typedef struct SDL_JobWorker
+{
+    SDL_JobSystem *system;
+    SDL_Thread *thread;
+    SDL_JobQueue queue;
+    Uint32 rng;
+} SDL_JobWorker;
+
+struct SDL_JobSystem
+{
+    int num_workers;            // number of worker slots
+    int num_threads;            // number of worker threads actually running
+    SDL_JobWorker *workers;
+    SDL_JobQueue shared;        // jobs submitted from threads that aren't workers
+    SDL_AtomicInt signal;       // incremented whenever a job is queued
+    SDL_AtomicInt sleepers;     // number of workers waiting on signal
+    SDL_AtomicInt outstanding;  // number of jobs that haven't completed yet
+    SDL_AtomicInt quit;
+};
+
+struct SDL_Job
+{
+    SDL_JobSystem *system;
+    SDL_JobCallback callback;
+    void *userdata;
+    SDL_AtomicInt refcount;  // one for the app's handle, one until the job completes
+    SDL_AtomicInt pending;   // number of dependencies that haven't completed, plus one while submitting
+    SDL_AtomicInt done;
+    SDL_AtomicInt waiters;
+    SDL_SpinLock lock;       // protects done and dependents
+    SDL_Job **dependents;
+    int num_dependents;
+    int max_dependents;
+};
+
+static SDL_TLSID SDL_job_worker;
+static SDL_InitState SDL_job_system_init;
+static SDL_JobSystem *SDL_job_system;
+
+static bool SDL_PushJob(SDL_JobQueue *queue, SDL_Job *job)
+{
+    SDL_LockSpinlock(&queue->lock);
+    if ((queue->tail - queue->head) == queue->capacity) {
+        const Uint32 capacity = queue->capacity ? (queue->capacity * 2) : SDL_JOB_QUEUE_INITIAL_SIZE;
+        SDL_Job **jobs = (SDL_Job **)SDL_malloc(capacity * sizeof(*jobs));
+        Uint32 i;
+
+        if (!jobs) {
+            SDL_UnlockSpinlock(&queue->lock);
+            return false;
+        }
+        for (i = 0; i < queue->capacity; ++i) {
+            jobs[i] = queue->jobs[(queue->head + i) & (queue->capacity - 1)];
+        }
+        SDL_free(queue->jobs);
+        queue->jobs = jobs;
+        queue->tail -= queue->head;
+        queue->head = 0;
+        queue->capacity = capacity;
+    }
+    queue->jobs[queue->tail++ & (queue->capacity - 1)] = job;
+    SDL_UnlockSpinlock(&queue->lock);
+    return true;
+}
+
+static SDL_Job *SDL_PopNewestJob(SDL_JobQueue *queue)
+{
+    SDL_Job *job = NULL;
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->tail != queue->head) {
+        job = queue->jobs[--queue->tail & (queue->capacity - 1)];
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+    return job;
+}
+
+static SDL_Job *SDL_PopOldestJob(SDL_JobQueue *queue)
+{
+    SDL_Job *job = NULL;
+
+    // Peek without the lock first, so idle workers don't fight over empty queues
+    if (*(volatile Uint32 *)&queue->tail == *(volatile Uint32 *)&queue->head) {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->tail != queue->head) {
+        job = queue->jobs[queue->head++ & (queue->capacity - 1)];
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+    return job;
+}
+
+static SDL_JobWorker *SDL_GetCurrentJobWorker(SDL_JobSystem *system)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)SDL_GetTLS(&SDL_job_worker);
+    if (worker && worker->system == system) {
+        return worker;
+    }
+    return NULL;
+}
+
+static SDL_Job *SDL_FindJob(SDL_JobSystem *system, SDL_JobWorker *worker)
+{
+    SDL_Job *job;
+    int i, start;
+
+    if (worker) {
+        job = SDL_PopNewestJob(&worker->queue);
+        if (job) {
+            return job;
+        }
+    }
+
+    job = SDL_PopOldestJob(&system->shared);
+    if (job) {
+        return job;
+    }
+
+    // Steal from the other workers, starting at a random one so thieves spread out
+    if (worker) {
+        worker->rng = worker->rng * 1664525 + 1013904223;
+        start = (int)((worker->rng >> 16) % (Uint32)system->num_workers);
+    } else {
+        start = 0;
+    }
+    for (i = 0; i < system->num_workers; ++i) {
+        SDL_JobWorker *victim = &system->workers[(start + i) % system->num_workers];
+        if (victim != worker) {
+            job = SDL_PopOldestJob(&victim->queue);
+            if (job) {
+                return job;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void SDL_ReleaseJob(SDL_Job *job)
+{
+    if (SDL_AddAtomicInt(&job->refcount, -1) == 1) {
+        SDL_free(job->dependents);
+        SDL_free(job);
+    }
+}
+
+static void SDL_RunJob(SDL_Job *job);
+
+static void SDL_QueueJob(SDL_Job *job)
+{
+    SDL_JobSystem *system = job->system;
+    SDL_JobWorker *worker;
+
+    if (system->num_threads == 0) {
+        SDL_RunJob(job);
+        return;
+    }
+
+    worker = SDL_GetCurrentJobWorker(system);
+    if (!SDL_PushJob(worker ? &worker->queue : &system->shared, job)) {
+        // Out of memory, run it right here instead
+        SDL_RunJob(job);
+        return;
+    }
+
+    SDL_AddAtomicInt(&system->signal, 1);
+    if (SDL_GetAtomicInt(&system->sleepers) > 0) {
+        SDL_WakeAtomicInt(&system->signal, false);
+    }
+}
+
+static void SDL_RunJob(SDL_Job *job)
+{
+    SDL_JobSystem *system = job->system;
+    SDL_Job **dependents;
+    int i, num_dependents;
+
+    job->callback(job->userdata);
+
+    SDL_LockSpinlock(&job->lock);
+    SDL_SetAtomicInt(&job->done, 1);
+    dependents = job->dependents;
+    num_dependents = job->num_dependents;
+    job->dependents = NULL;
+    job->num_dependents = job->max_dependents = 0;
+    SDL_UnlockSpinlock(&job->lock);
+
+    if (SDL_GetAtomicInt(&job->waiters) > 0) {
+        SDL_WakeAtomicInt(&job->done, true);
+    }
+
+    for (i = 0; i < num_dependents; ++i) {
+        if (SDL_AddAtomicInt(&dependents[i]->pending, -1) == 1) {
+            SDL_QueueJob(dependents[i]);
+        }
+    }
+    SDL_free(dependents);
+
+    if (SDL_AddAtomicInt(&system->outstanding, -1) == 1) {
+        SDL_WakeAtomicInt(&system->outstanding, true);
+    }
+    SDL_ReleaseJob(job);
+}
+
+static int SDLCALL SDL_JobWorkerThread(void *data)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)data;
+    SDL_JobSystem *system = worker->system;
+
+    SDL_SetTLS(&SDL_job_worker, worker, NULL);
+
+    while (!SDL_GetAtomicInt(&system->quit)) {
+        SDL_Job *job = SDL_FindJob(system, worker);
+        if (!job) {
+            int signal;
+
+            /* Read the signal before looking for work one last time, so a job
+               queued after that changes the signal and the wait returns */
+            SDL_AddAtomicInt(&system->sleepers, 1);
+            signal = SDL_GetAtomicInt(&system->signal);
+            job = SDL_FindJob(system, worker);
+            if (!job && !SDL_GetAtomicInt(&system->quit)) {
+                SDL_WaitAtomicInt(&system->signal, signal, -1);
+            }
+            SDL_AddAtomicInt(&system->sleepers, -1);
+        }
+        if (job) {
+            SDL_RunJob(job);
+        }
+    }
+    return 0;
+}
+
+static SDL_JobSystem *SDL_GetJobSystem(SDL_JobSystem *jobs)
+{
+    if (jobs) {
+        return jobs;
+    }
+
+    if (SDL_ShouldInit(&SDL_job_system_init)) {
+        SDL_job_system = SDL_CreateJobSystem(0);
+        SDL_SetInitialized(&SDL_job_system_init, SDL_job_system != NULL);
+    }
+    if (!SDL_job_system) {
+        SDL_SetError("Couldn't create the shared job system");
+    }
+    return SDL_job_system;
+}
+
+SDL_JobSystem *SDL_CreateJobSystem(int num_workers)
+{
+    SDL_JobSystem *system;
+    int i;
+
+    if (num_workers < 0) {
+        SDL_InvalidParamError("num_workers");
+        return NULL;
+    }
+
+    if (num_workers == 0) {
+        const char *hint = SDL_GetHint(SDL_HINT_JOB_WORKERS);
+        if (hint) {
+            num_workers = SDL_atoi(hint);
+        }
+        if (num_workers <= 0) {
+            num_workers = SDL_max(SDL_GetNumLogicalCPUCores() - 1, 1);
+        }
+    }
+
+    system = (SDL_JobSystem *)SDL_calloc(1, sizeof(*system));
+    if (!system) {
+        return NULL;
+    }
+    system->workers = (SDL_JobWorker *)SDL_calloc(num_workers, sizeof(*system->workers));
+    if (!system->workers) {
+        SDL_free(system);
+        return NULL;
+    }
+    system->num_workers = num_workers;
+
+    for (i = 0; i < num_workers; ++i) {
+        SDL_JobWorker *worker = &system->workers[i];
+        worker->system = system;
+        worker->rng = (Uint32)i + 1;
+        worker->thread = SDL_CreateThread(SDL_JobWorkerThread, "SDLJobWorker", worker);
+        if (!worker->thread) {
+            break;
+        }
+        ++system->num_threads;
+    }
+
+    if (system->num_threads == 0) {
+        // Run jobs on the thread that submits them
+        SDL_ClearError();
+    }
+    return system;
+}
+
+int SDL_GetJobSystemWorkers(SDL_JobSystem *jobs)
+{
+    SDL_JobSystem *system = SDL_GetJobSystem(jobs);
+    if (!system) {
+        return -1;
+    }
+    return system->num_threads;
+}
+
+SDL_Job *SDL_SubmitJob(SDL_JobSystem *jobs, SDL_JobCallback callback, void *userdata, SDL_Job * const *dependencies, int num_dependencies)
+{
+    SDL_JobSystem *system;
+    SDL_Job *job;
+    int i;
+
+    if (!callback) {
+        SDL_InvalidParamError("callback");
+        return NULL;
+    }
+    if (num_dependencies < 0 || (num_dependencies > 0 && !dependencies)) {
+        SDL_InvalidParamError("dependencies");
+        return NULL;
+    }
+
+    system = SDL_GetJobSystem(jobs);
+    if (!system) {
+        return NULL;
+    }
+
+    for (i = 0; i < num_dependencies; ++i) {
+        if (dependencies[i] && dependencies[i]->system != system) {
+            SDL_SetError("Job dependencies must be submitted to the same job system");
+            return NULL;
+        }
+    }
+
+    job = (SDL_Job *)SDL_calloc(1, sizeof(*job));
+    if (!job) {
+        return NULL;
+    }
+    job->system = system;
+    job->callback = callback;
+    job->userdata = userdata;
+    SDL_SetAtomicInt(&job->refcount, 2);
+    SDL_SetAtomicInt(&job->pending, 1);
+    SDL_AddAtomicInt(&system->outstanding, 1);
+
+    for (i = 0; i < num_dependencies; ++i) {
+        SDL_Job *dependency = dependencies[i];
+        bool waiting = false;
+
+        if (!dependency) {
+            continue;
+        }
+
+        SDL_LockSpinlock(&dependency->lock);
+        if (!SDL_GetAtomicInt(&dependency->done)) {
+            if (dependency->num_dependents == dependency->max_dependents) {
+                const int max_dependents = dependency->max_dependents ? (dependency->max_dependents * 2) : 4;
+                SDL_Job **dependents = (SDL_Job **)SDL_realloc(dependency->dependents, max_dependents * sizeof(*dependents));
+                if (dependents) {
+                    dependency->dependents = dependents;
+                    dependency->max_dependents = max_dependents;
+                }
+            }
+            if (dependency->num_dependents < dependency->max_dependents) {
+                dependency->dependents[dependency->num_dependents++] = job;
+                SDL_AddAtomicInt(&job->pending, 1);
+            } else {
+                waiting = true;
+            }
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+
+        if (waiting) {
+            // Out of memory, we'll just have to wait for it
+            SDL_AddAtomicInt(&dependency->refcount, 1);
+            SDL_WaitJob(dependency);
+        }
+    }
+
+    if (SDL_AddAtomicInt(&job->pending, -1) == 1) {
+        SDL_QueueJob(job);
+    }
+    return job;
+}
+
+void SDL_WaitJob(SDL_Job *job)
+{
+    if (!job) {
+        return;
+    }
+
+    if (!SDL_GetAtomicInt(&job->done)) {
+        SDL_JobSystem *system = job->system;
+        SDL_JobWorker *worker = SDL_GetCurrentJobWorker(system);
+
+        while (!SDL_GetAtomicInt(&job->done)) {
+            // Help out with other jobs while we wait
+            SDL_Job *other = SDL_FindJob(system, worker);
+            if (other) {
+                SDL_RunJob(other);
+                continue;
+            }
+
+            SDL_AddAtomicInt(&job->waiters, 1);
+            SDL_WaitAtomicInt(&job->done, 0, -1);
+            SDL_AddAtomicInt(&job->waiters, -1);
+        }
+    }
+    SDL_ReleaseJob(job);
+}
+
+void SDL_DetachJob(SDL_Job *job)
+{
+    if (job) {
+        SDL_ReleaseJob(job);
+    }
+}
+
+typedef struct SDL_ParallelForData
+{
+    SDL_ParallelForCallback callback;
+    void *userdata;
+    int start;
+    int end;
+    int grain;
+    int num_chunks;
+    SDL_AtomicInt next_chunk;
+} SDL_ParallelForData;
+
+static void SDLCALL SDL_ParallelForJob(void *userdata)
+{
+    SDL_ParallelForData *data = (SDL_ParallelForData *)userdata;
+
+    for (;;) {
+        const int chunk = SDL_AddAtomicInt(&data->next_chunk, 1);
+        int start, end;
+
+        if (chunk >= data->num_chunks) {
+            break;
+        }
+        start = data->start + chunk * data->grain;
+        end = (chunk == data->num_chunks - 1) ? data->end : (start + data->grain);
+        data->callback(data->userdata, start, end);
+    }
+}
+
+bool SDL_ParallelFor(SDL_JobSystem *jobs, int start, int end, int grain, SDL_ParallelForCallback callback, void *userdata)
+{
+    SDL_JobSystem *system;
+    SDL_ParallelForData data;
+    SDL_Job *helpers[SDL_MAX_PARALLEL_FOR_JOBS];
+    int i, count, num_helpers;
+
+    if (!callback) {
+        return SDL_InvalidParamError("callback");
+    }
+    if (grain < 0) {
+        return SDL_InvalidParamError("grain");
+    }
+    if (end <= start) {
+        return true;
+    }
+
+    system = SDL_GetJobSystem(jobs);
+    if (!system) {
+        return false;
+    }
+
+    count = end - start;
+    if (grain == 0) {
+        // A few chunks per thread, so threads that finish early can pick up the slack
+        grain = SDL_max(count / ((system->num_threads + 1) * 4), 1);
+    }
+
+    data.callback = callback;
+    data.userdata = userdata;
+    data.start = start;
+    data.end = end;
+    data.grain = grain;
+    data.num_chunks = (count / grain) + ((count % grain) ? 1 : 0);
+    SDL_SetAtomicInt(&data.next_chunk, 0);
+
+    num_helpers = SDL_min(SDL_min(system->num_threads, data.num_chunks - 1), SDL_MAX_PARALLEL_FOR_JOBS);
+    for (i = 0; i < num_helpers; ++i) {
+        helpers[i] = SDL_SubmitJob(system, SDL_ParallelForJob, &data, NULL, 0);
+        if (!helpers[i]) {
+            // That's fine, this thread will do the rest of the work
+            num_helpers = i;
+            break;
+        }
+    }
+
+    SDL_ParallelForJob(&data);
+
+    for (i = 0; i < num_helpers; ++i) {
+        SDL_WaitJob(helpers[i]);
+    }
+    return true;
+}
+
+void SDL_DestroyJobSystem(SDL_JobSystem *jobs)
+{
+    SDL_JobSystem *system = jobs;
+    int i, outstanding;
+
+    if (!system) {
+        return;
+    }
+
+    // Finish all the jobs that have been submitted
+    while ((outstanding = SDL_GetAtomicInt(&system->outstanding)) > 0) {
+        SDL_Job *job = SDL_FindJob(system, SDL_GetCurrentJobWorker(system));
+        if (job) {
+            SDL_RunJob(job);
+        } else {
+            SDL_WaitAtomicInt(&system->outstanding, outstanding, -1);
+        }
+    }
+
+    SDL_SetAtomicInt(&system->quit, 1);
+    SDL_AddAtomicInt(&system->signal, 1);
+    SDL_WakeAtomicInt(&system->signal, true);
+
+    for (i = 0; i < system->num_threads; ++i) {
+        SDL_WaitThread(system->workers[i].thread, NULL);
+    }
+    for (i = 0; i < system->num_workers; ++i) {
+        SDL_free(system->workers[i].queue.jobs);
+    }
+    SDL_free(system->shared.jobs);
+    SDL_free(system->workers);
+    SDL_free(system);
+}
+
+void SDL_QuitJobs(void)
+{
+    if (!SDL_ShouldQuit(&SDL_job_system_init)) {
+        return;
+    }
+
+    SDL_DestroyJobSystem(SDL_job_system);
+    SDL_job_system = NULL;
+
+    SDL_SetInitialized(&SDL_job_system_init, false);
+}
@@ -324,6 +324,9 @@ void SDL_RunThread(SDL_Thread *thread)
     // Get the thread id
     thread->threadid = SDL_GetCurrentThreadID();
 
+    // Label anything this thread records in a trace
+    SDL_SetTraceThreadName(thread->name);
+
     // Run the function
     *statusloc = userfunc(userdata);
 
@@ -80,6 +80,9 @@ typedef struct
 extern void SDL_InitTLSData(void);
 extern void SDL_QuitTLSData(void);
 
+// Shut down the shared job system, if it was created
+extern void SDL_QuitJobs(void);
+
 /* Generic TLS support.
    This is only intended as a fallback if getting real thread-local
    storage fails or isn't supported on this platform.
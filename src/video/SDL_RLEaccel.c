@@ -85,6 +85,16 @@
  *
  *   The end of the sequence is marked by a zero <skip>,<run> pair at the
  *   beginning of an opaque line.
+ *
+ * Encoding of surfaces with colour modulation or other blend modes:
+ *
+ *   The sequence begins with an RLERunsHeader holding the standard blit
+ *   function for the surface and the value of the skipped pixels. The
+ *   segments are laid out as for colorkeyed surfaces, but the pixels keep
+ *   the source format and each run is blitted by the standard blitter,
+ *   which applies the modulation and blend mode. The skipped pixels are the
+ *   colorkey, fully transparent pixels, or all-zero pixels for the
+ *   premultiplied blend modes.
  */
 
 #include "SDL_sysvideo.h"
@@ -852,6 +862,131 @@ done:
     return true;
 }
 
+// The header of a surface encoded as runs for the standard blitter
+typedef struct RLERunsHeader
+{
+    SDL_BlitFunc blit;  // the blitter used for each run
+    Uint32 background;  // the value of the skipped pixels
+} RLERunsHeader;
+
+typedef void (*RLERunFunc)(void *userdata, int y, int x, const Uint8 *pixels, int len);
+
+/*
+ * Call func for every part of a run that lies within srcrect, with the
+ * coordinates relative to the top left corner of srcrect.
+ * This walks the colorkey encoding described above.
+ */
+static void RLEWalkRuns(const Uint8 *srcbuf, int w, int bpp, const SDL_Rect *srcrect,
+                        RLERunFunc func, void *userdata)
+{
+    const int top = srcrect->y;
+    const int bottom = top + srcrect->h;
+    const int left = srcrect->x;
+    const int right = left + srcrect->w;
+    int y = 0;
+    int ofs = 0;
+
+    if (srcrect->h <= 0) {
+        return;
+    }
+
+    for (;;) {
+        int run;
+        if (bpp == 4) {
+            ofs += ((const Uint16 *)srcbuf)[0];
+            run = ((const Uint16 *)srcbuf)[1];
+            srcbuf += 4;
+        } else {
+            ofs += srcbuf[0];
+            run = srcbuf[1];
+            srcbuf += 2;
+        }
+        if (run) {
+            if (y >= top) {
+                // clip to left and right borders
+                const int start = SDL_max(ofs, left);
+                const int end = SDL_min(ofs + run, right);
+                if (start < end) {
+                    func(userdata, y - top, start - left, srcbuf + (start - ofs) * bpp, end - start);
+                }
+            }
+            srcbuf += run * bpp;
+            ofs += run;
+        } else if (!ofs) {
+            break;
+        }
+        if (ofs == w) {
+            ofs = 0;
+            if (++y == bottom) {
+                break;
+            }
+        }
+    }
+}
+
+typedef struct RLERunBlitData
+{
+    SDL_BlitInfo info;
+    SDL_BlitFunc blit;
+    Uint8 *dst;
+    int dst_pitch;
+    int dst_bpp;
+    int src_bpp;
+} RLERunBlitData;
+
+static void RLEBlitRun(void *userdata, int y, int x, const Uint8 *pixels, int len)
+{
+    RLERunBlitData *data = (RLERunBlitData *)userdata;
+    SDL_BlitInfo *info = &data->info;
+
+    info->src = (Uint8 *)pixels;
+    info->src_w = len;
+    info->src_h = 1;
+    info->src_pitch = len * data->src_bpp;
+    info->src_skip = 0;
+    info->dst = data->dst + y * data->dst_pitch + x * data->dst_bpp;
+    info->dst_w = len;
+    info->dst_h = 1;
+    info->dst_pitch = data->dst_pitch;
+    info->dst_skip = data->dst_pitch - len * data->dst_bpp;
+    data->blit(info);
+}
+
+/*
+ * Blit a surface encoded as runs, applying colour and alpha modulation and
+ * the blend mode through the standard blitter one run at a time, so the
+ * skipped pixels are never looked at.
+ */
+static bool SDLCALL SDL_RLERunBlit(SDL_Surface *surf_src, const SDL_Rect *srcrect,
+                                   SDL_Surface *surf_dst, const SDL_Rect *dstrect)
+{
+    const RLERunsHeader *header = (const RLERunsHeader *)surf_src->map.data;
+    RLERunBlitData data;
+
+    // Lock the destination if necessary
+    if (SDL_MUSTLOCK(surf_dst)) {
+        if (!SDL_LockSurface(surf_dst)) {
+            return false;
+        }
+    }
+
+    data.info = surf_src->map.info;
+    data.info.flags &= ~SDL_COPY_COLORKEY;
+    data.blit = header->blit;
+    data.src_bpp = surf_src->fmt->bytes_per_pixel;
+    data.dst_bpp = surf_dst->fmt->bytes_per_pixel;
+    data.dst_pitch = surf_dst->pitch;
+    data.dst = (Uint8 *)surf_dst->pixels + dstrect->y * surf_dst->pitch + dstrect->x * data.dst_bpp;
+
+    RLEWalkRuns((const Uint8 *)(header + 1), surf_src->w, data.src_bpp, srcrect, RLEBlitRun, &data);
+
+    // Unlock the destination if necessary
+    if (SDL_MUSTLOCK(surf_dst)) {
+        SDL_UnlockSurface(surf_dst);
+    }
+    return true;
+}
+
 /*
  * Auxiliary functions:
  * The encoding functions take 32bpp rgb + a, and
@@ -1230,9 +1365,10 @@ static const getpix_func getpixes[4] = {
     getpix_8, getpix_16, getpix_24, getpix_32
 };
 
-static bool RLEColorkeySurface(SDL_Surface *surface)
+/* Encode the pixels of a surface as runs of pixels that don't match key under
+   mask, leaving header_size bytes at the start of the buffer for the caller */
+static Uint8 *RLEEncodeRuns(SDL_Surface *surface, size_t header_size, Uint32 mask, Uint32 key)
 {
-    SDL_Surface *dest;
     Uint8 *rlebuf, *dst;
     int maxn;
     int y;
@@ -1240,14 +1376,8 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
     int maxsize = 0;
     const int bpp = surface->fmt->bytes_per_pixel;
     getpix_func getpix;
-    Uint32 ckey, rgbmask;
     int w, h;
 
-    dest = surface->map.info.dst_surface;
-    if (!dest) {
-        return false;
-    }
-
     // calculate the worst case size for the compressed surface
     switch (bpp) {
     case 1:
@@ -1266,23 +1396,20 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
         break;
 
     default:
-        return false;
+        return NULL;
     }
 
-    maxsize += sizeof(SDL_PixelFormat);
+    maxsize += (int)header_size;
     rlebuf = (Uint8 *)SDL_malloc(maxsize);
     if (!rlebuf) {
-        return false;
+        return NULL;
     }
-    // save the destination format so we can undo the encoding later
-    *(SDL_PixelFormat *)rlebuf = dest->format;
 
     // Set up the conversion
     srcbuf = (Uint8 *)surface->pixels;
     maxn = bpp == 4 ? 65535 : 255;
-    dst = rlebuf + sizeof(SDL_PixelFormat);
-    rgbmask = ~surface->fmt->Amask;
-    ckey = surface->map.info.colorkey & rgbmask;
+    dst = rlebuf + header_size;
+    key &= mask;
     lastline = dst;
     getpix = getpixes[bpp - 1];
     w = surface->w;
@@ -1309,11 +1436,11 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
             int skipstart = x;
 
             // find run of transparent, then opaque pixels
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey) {
+            while (x < w && (getpix(srcbuf + x * bpp) & mask) == key) {
                 x++;
             }
             runstart = x;
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey) {
+            while (x < w && (getpix(srcbuf + x * bpp) & mask) != key) {
                 x++;
             }
             skip = runstart - skipstart;
@@ -1371,9 +1498,67 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
         if (!p) {
             p = rlebuf;
         }
-        surface->map.data = p;
+        return p;
+    }
+}
+
+static bool RLEColorkeySurface(SDL_Surface *surface)
+{
+    SDL_Surface *dest = surface->map.info.dst_surface;
+    Uint32 rgbmask = ~surface->fmt->Amask;
+    Uint8 *rlebuf;
+
+    if (!dest) {
+        return false;
     }
 
+    rlebuf = RLEEncodeRuns(surface, sizeof(SDL_PixelFormat), rgbmask, surface->map.info.colorkey);
+    if (!rlebuf) {
+        return false;
+    }
+    // save the destination format so we can undo the encoding later
+    *(SDL_PixelFormat *)rlebuf = dest->format;
+    surface->map.data = rlebuf;
+
+    return true;
+}
+
+/*
+ * Encode a surface whose blits modulate or blend the pixels in ways the RLE
+ * blitters above don't handle. The runs are handed to the standard blitter,
+ * which is chosen here with the colorkey test dropped, since every pixel in
+ * a run is known to be visible.
+ */
+static bool RLERunsSurface(SDL_Surface *surface, Uint32 mask, Uint32 key, Uint32 background)
+{
+    SDL_BlitMap *map = &surface->map;
+    SDL_Surface *dest = map->info.dst_surface;
+    RLERunsHeader *header;
+    SDL_BlitFunc blit;
+    Uint8 *rlebuf;
+    int flags;
+
+    if (!dest) {
+        return false;
+    }
+
+    flags = map->info.flags;
+    map->info.flags &= ~SDL_COPY_COLORKEY;
+    blit = SDL_CalculateBlitFunc(surface, dest);
+    map->info.flags = flags;
+    if (!blit) {
+        return false;
+    }
+
+    rlebuf = RLEEncodeRuns(surface, sizeof(RLERunsHeader), mask, key);
+    if (!rlebuf) {
+        return false;
+    }
+    header = (RLERunsHeader *)rlebuf;
+    header->blit = blit;
+    header->background = background;
+    map->data = rlebuf;
+
     return true;
 }
 
@@ -1399,37 +1584,56 @@ bool SDL_RLESurface(SDL_Surface *surface)
     flags = surface->map.info.flags;
     if (flags & SDL_COPY_COLORKEY) {
         // ok
-    } else if ((flags & SDL_COPY_BLEND) && SDL_ISPIXELFORMAT_ALPHA(surface->format)) {
-        // ok
+    } else if ((flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_ADD_PREMULTIPLIED)) &&
+               SDL_ISPIXELFORMAT_ALPHA(surface->format)) {
+        // ok, there are pixels that leave the target untouched
     } else {
         // If we don't have colorkey or blending, nothing to do...
         return false;
     }
 
-    // Pass on combinations not supported
-    if ((flags & SDL_COPY_MODULATE_COLOR) ||
-        ((flags & SDL_COPY_MODULATE_ALPHA) && SDL_ISPIXELFORMAT_ALPHA(surface->format)) ||
-        (flags & (SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_ADD_PREMULTIPLIED | SDL_COPY_MOD | SDL_COPY_MUL)) ||
-        (flags & SDL_COPY_NEAREST)) {
+    // Scaled blits don't go through the RLE blitters
+    if (flags & SDL_COPY_NEAREST) {
         return false;
     }
 
     // Encode and set up the blit
-    if (!SDL_ISPIXELFORMAT_ALPHA(surface->format) || !(flags & SDL_COPY_BLEND)) {
-        if (!surface->map.identity) {
-            return false;
-        }
-        if (!RLEColorkeySurface(surface)) {
-            return false;
-        }
+    if ((flags & SDL_COPY_BLEND) && SDL_ISPIXELFORMAT_ALPHA(surface->format) &&
+        !(flags & (SDL_COPY_MODULATE_MASK | (SDL_COPY_BLEND_MASK & ~SDL_COPY_BLEND))) &&
+        RLEAlphaSurface(surface)) {
+        surface->map.blit = SDL_RLEAlphaBlit;
+        surface->map.info.flags |= SDL_COPY_RLE_ALPHAKEY;
+    } else if ((flags & SDL_COPY_COLORKEY) && surface->map.identity &&
+               !(SDL_ISPIXELFORMAT_ALPHA(surface->format) && (flags & (SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND))) &&
+               !(flags & (SDL_COPY_MODULATE_COLOR | (SDL_COPY_BLEND_MASK & ~SDL_COPY_BLEND))) &&
+               RLEColorkeySurface(surface)) {
         surface->map.blit = SDL_RLEBlit;
         surface->map.info.flags |= SDL_COPY_RLE_COLORKEY;
     } else {
-        if (!RLEAlphaSurface(surface)) {
+        const SDL_PixelFormatDetails *fmt = surface->fmt;
+        Uint32 mask, key, background;
+
+        if (flags & SDL_COPY_COLORKEY) {
+            // skip the colorkey
+            mask = ~fmt->Amask;
+            key = surface->map.info.colorkey;
+            background = key;
+        } else if (flags & (SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD_PREMULTIPLIED)) {
+            // skip pixels that are zero, the colour is added to the target
+            mask = fmt->Rmask | fmt->Gmask | fmt->Bmask | fmt->Amask;
+            key = 0;
+            background = 0;
+        } else {
+            // skip fully transparent pixels
+            mask = fmt->Amask;
+            key = 0;
+            background = 0;
+        }
+        if (!RLERunsSurface(surface, mask, key, background)) {
             return false;
         }
-        surface->map.blit = SDL_RLEAlphaBlit;
-        surface->map.info.flags |= SDL_COPY_RLE_ALPHAKEY;
+        surface->map.blit = SDL_RLERunBlit;
+        surface->map.info.flags |= SDL_COPY_RLE_RUNS;
     }
 
     // The surface is now accelerated
@@ -1525,6 +1729,42 @@ end_function:
     return true;
 }
 
+static void UnRLERun(void *userdata, int y, int x, const Uint8 *pixels, int len)
+{
+    SDL_Surface *surface = (SDL_Surface *)userdata;
+    const int bpp = surface->fmt->bytes_per_pixel;
+
+    SDL_memcpy((Uint8 *)surface->pixels + y * surface->pitch + x * bpp, pixels, (size_t)len * bpp);
+}
+
+// Un-RLE a surface encoded as runs, the skipped pixels get the background value
+static bool UnRLERuns(SDL_Surface *surface)
+{
+    const RLERunsHeader *header = (const RLERunsHeader *)surface->map.data;
+    SDL_Rect full;
+    size_t size;
+
+    if (!SDL_size_mul_check_overflow(surface->h, surface->pitch, &size)) {
+        return false;
+    }
+
+    surface->pixels = SDL_aligned_alloc(SDL_GetSIMDAlignment(), size);
+    if (!surface->pixels) {
+        return false;
+    }
+    surface->flags |= SDL_SURFACE_SIMD_ALIGNED;
+
+    // fill it with the background color
+    SDL_FillSurfaceRect(surface, NULL, header->background);
+
+    // now copy back the runs
+    full.x = full.y = 0;
+    full.w = surface->w;
+    full.h = surface->h;
+    RLEWalkRuns((const Uint8 *)(header + 1), surface->w, surface->fmt->bytes_per_pixel, &full, UnRLERun, surface);
+    return true;
+}
+
 void SDL_UnRLESurface(SDL_Surface *surface, bool recode)
 {
     if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
@@ -1557,6 +1797,12 @@ void SDL_UnRLESurface(SDL_Surface *surface, bool recode)
                 full.w = surface->w;
                 full.h = surface->h;
                 SDL_RLEBlit(surface, &full, surface, &full);
+            } else if (surface->map.info.flags & SDL_COPY_RLE_RUNS) {
+                if (!UnRLERuns(surface)) {
+                    // Oh crap...
+                    surface->internal_flags |= SDL_INTERNAL_SURFACE_RLEACCEL;
+                    return;
+                }
             } else {
                 if (!UnRLEAlpha(surface)) {
                     // Oh crap...
@@ -1566,7 +1812,7 @@ void SDL_UnRLESurface(SDL_Surface *surface, bool recode)
             }
         }
         surface->map.info.flags &=
-            ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
+            ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS);
 
         SDL_free(surface->map.data);
         surface->map.data = NULL;
@@ -175,45 +175,14 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
 }
 #endif // SDL_HAVE_BLIT_AUTO
 
-// Figure out which of many blit routines to set up on a surface
-bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
+// Choose the standard (non-RLE) blit function for the current map flags
+SDL_BlitFunc SDL_CalculateBlitFunc(SDL_Surface *surface, SDL_Surface *dst)
 {
     SDL_BlitFunc blit = NULL;
     SDL_BlitMap *map = &surface->map;
     SDL_Colorspace src_colorspace = surface->colorspace;
     SDL_Colorspace dst_colorspace = dst->colorspace;
 
-    // We don't currently support blitting to < 8 bpp surfaces
-    if (SDL_BITSPERPIXEL(dst->format) < 8) {
-        SDL_InvalidateMap(map);
-        return SDL_SetError("Blit combination not supported");
-    }
-
-#ifdef SDL_HAVE_RLE
-    // Clean everything out to start
-    if (surface->flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
-        SDL_UnRLESurface(surface, true);
-    }
-#endif
-
-    map->blit = SDL_SoftBlit;
-    map->info.src_surface = surface;
-    map->info.src_fmt = surface->fmt;
-    map->info.src_pal = surface->palette;
-    map->info.dst_surface = dst;
-    map->info.dst_fmt = dst->fmt;
-    map->info.dst_pal = dst->palette;
-
-#ifdef SDL_HAVE_RLE
-    // See if we can do RLE acceleration
-    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
-        if (SDL_RLESurface(surface)) {
-            return true;
-        }
-    }
-#endif
-
-    // Choose a standard blit function
     if (!blit) {
         if (src_colorspace != dst_colorspace ||
             SDL_BYTESPERPIXEL(surface->format) > 4 ||
@@ -278,6 +247,47 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
             blit = SDL_Blit_Slow;
         }
     }
+    return blit;
+}
+
+// Figure out which of many blit routines to set up on a surface
+bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
+{
+    SDL_BlitFunc blit;
+    SDL_BlitMap *map = &surface->map;
+
+    // We don't currently support blitting to < 8 bpp surfaces
+    if (SDL_BITSPERPIXEL(dst->format) < 8) {
+        SDL_InvalidateMap(map);
+        return SDL_SetError("Blit combination not supported");
+    }
+
+#ifdef SDL_HAVE_RLE
+    // Clean everything out to start
+    if (surface->flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
+        SDL_UnRLESurface(surface, true);
+    }
+#endif
+
+    map->blit = SDL_SoftBlit;
+    map->info.src_surface = surface;
+    map->info.src_fmt = surface->fmt;
+    map->info.src_pal = surface->palette;
+    map->info.dst_surface = dst;
+    map->info.dst_fmt = dst->fmt;
+    map->info.dst_pal = dst->palette;
+
+#ifdef SDL_HAVE_RLE
+    // See if we can do RLE acceleration
+    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
+        if (SDL_RLESurface(surface)) {
+            return true;
+        }
+    }
+#endif
+
+    // Choose a standard blit function
+    blit = SDL_CalculateBlitFunc(surface, dst);
     map->data = (void *)blit;
 
     // Make sure we have a blit function
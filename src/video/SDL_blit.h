@@ -43,7 +43,8 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_COPY_RLE_DESIRED            0x00001000
 #define SDL_COPY_RLE_COLORKEY           0x00002000
 #define SDL_COPY_RLE_ALPHAKEY           0x00004000
-#define SDL_COPY_RLE_MASK               (SDL_COPY_RLE_DESIRED | SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY)
+#define SDL_COPY_RLE_RUNS               0x00008000
+#define SDL_COPY_RLE_MASK               (SDL_COPY_RLE_DESIRED | SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS)
 
 // SDL blit CPU flags
 #define SDL_CPU_ANY                0x00000000
@@ -105,6 +106,7 @@ typedef struct SDL_BlitMap
 
 // Functions found in SDL_blit.c
 extern bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst);
+extern SDL_BlitFunc SDL_CalculateBlitFunc(SDL_Surface *surface, SDL_Surface *dst);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
@@ -1979,7 +1979,7 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     surface->map.info.g = 0xFF;
     surface->map.info.b = 0xFF;
     surface->map.info.a = 0xFF;
-    surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY));
+    surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS));
     SDL_InvalidateMap(&surface->map);
 
     // Copy over the image data
@@ -2050,7 +2050,7 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     convert->map.info.flags =
         (copy_flags &
          ~(SDL_COPY_COLORKEY | SDL_COPY_BLEND | SDL_COPY_RLE_DESIRED | SDL_COPY_RLE_COLORKEY |
-           SDL_COPY_RLE_ALPHAKEY));
+           SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS));
     surface->map.info.r = copy_color.r;
     surface->map.info.g = copy_color.g;
     surface->map.info.b = copy_color.b;
@@ -2228,7 +2228,7 @@ SDL_Surface *SDL_ScaleSurface(SDL_Surface *surface, int width, int height, SDL_S
     surface->map.info.g = 0xFF;
     surface->map.info.b = 0xFF;
     surface->map.info.a = 0xFF;
-    surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY));
+    surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS));
     SDL_InvalidateMap(&surface->map);
 
     rc = SDL_BlitSurfaceScaled(surface, NULL, convert, NULL, scaleMode);
@@ -2238,7 +2238,7 @@ SDL_Surface *SDL_ScaleSurface(SDL_Surface *surface, int width, int height, SDL_S
     convert->map.info.g = copy_color.g;
     convert->map.info.b = copy_color.b;
     convert->map.info.a = copy_color.a;
-    convert->map.info.flags = (copy_flags & ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY));
+    convert->map.info.flags = (copy_flags & ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY | SDL_COPY_RLE_RUNS));
     surface->map.info.r = copy_color.r;
     surface->map.info.g = copy_color.g;
     surface->map.info.b = copy_color.b;
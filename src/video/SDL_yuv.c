@@ -670,6 +670,196 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     return SDL_SetError("Unsupported YUV conversion");
 }
 
+// Stretching and converting in one pass, for YUV sources that need both (camera frames, mostly.)
+// Nothing the size of the whole image is written besides the output: when shrinking, output rows
+// are gathered with nearest sampling into a small YUY2 band and converted from there, and when
+// growing, bands of source rows are converted at their original size and then expanded.
+// Either way, the pixel conversion itself runs through the regular (SIMD) YUV to RGB kernels.
+#define YUV_STRETCH_BAND_ROWS 16
+
+static bool yuv_rgb_any(SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+                        Uint32 width, Uint32 height,
+                        const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+                        Uint8 *rgb, Uint32 rgb_stride,
+                        YCbCrType yuv_type)
+{
+    return yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+}
+
+static void StretchRowNearest(const Uint8 *src, Uint8 *dst, int dst_w, const Uint32 *src_x, int bpp)
+{
+    int x;
+
+    switch (bpp) {
+    case 4:
+        for (x = 0; x < dst_w; ++x) {
+            ((Uint32 *)dst)[x] = ((const Uint32 *)src)[src_x[x]];
+        }
+        break;
+    case 2:
+        for (x = 0; x < dst_w; ++x) {
+            ((Uint16 *)dst)[x] = ((const Uint16 *)src)[src_x[x]];
+        }
+        break;
+    default:
+        for (x = 0; x < dst_w; ++x) {
+            SDL_memcpy(&dst[x * bpp], &src[src_x[x] * bpp], bpp);
+        }
+        break;
+    }
+}
+
+bool SDL_StretchPixels_YUV_to_RGB(int src_w, int src_h, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, const void *src, int src_pitch,
+                                  int dst_w, int dst_h, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, void *dst, int dst_pitch)
+{
+    const Uint8 *y = NULL;
+    const Uint8 *u = NULL;
+    const Uint8 *v = NULL;
+    Uint32 y_stride = 0;
+    Uint32 uv_stride = 0;
+    int y_step, uv_step, uv_shift;
+    YCbCrType yuv_type = YCBCR_601_LIMITED;
+    const int bpp = SDL_BYTESPERPIXEL(dst_format);
+    const bool growing = (dst_w > src_w) && (dst_h >= src_h);
+
+    if (src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0) {
+        return SDL_InvalidParamError("size");
+    }
+
+    switch (src_format) {
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        y_step = 2;
+        uv_step = 4;
+        uv_shift = 0;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        y_step = 1;
+        uv_step = 2;
+        uv_shift = 1;
+        break;
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        y_step = 1;
+        uv_step = 1;
+        uv_shift = 1;
+        break;
+    default:
+        return SDL_SetError("Unsupported YUV stretch format: %s", SDL_GetPixelFormatName(src_format));
+    }
+
+    if (SDL_ISPIXELFORMAT_FOURCC(dst_format) || (bpp != 2 && bpp != 3 && bpp != 4)) {
+        return SDL_SetError("Unsupported YUV stretch conversion to %s", SDL_GetPixelFormatName(dst_format));
+    }
+
+    if (src_colorspace == SDL_COLORSPACE_UNKNOWN) {
+        src_colorspace = SDL_GetDefaultColorspaceForFormat(src_format);
+    }
+    if (dst_colorspace == SDL_COLORSPACE_UNKNOWN) {
+        dst_colorspace = SDL_GetDefaultColorspaceForFormat(dst_format);
+    }
+    if (SDL_COLORSPACEPRIMARIES(src_colorspace) != SDL_COLORSPACEPRIMARIES(dst_colorspace)) {
+        return SDL_SetError("Unsupported YUV stretch colorspace conversion");
+    }
+    if (!GetYUVConversionType(src_colorspace, &yuv_type)) {
+        return false;
+    }
+    if (!GetYUVPlanes(src_w, src_h, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride)) {
+        return false;
+    }
+
+    // The band holds converted source rows when growing, and gathered YUY2 output rows when shrinking.
+    const int band_w = growing ? src_w : ((dst_w + 1) & ~1);
+    const int band_pitch = growing ? (band_w * bpp) : (band_w * 2);
+    const int band_rows = YUV_STRETCH_BAND_ROWS;
+    Uint8 *band = (Uint8 *)SDL_malloc((size_t)band_pitch * band_rows + ((dst_w + 1) & ~1) * sizeof(Uint32));
+    if (!band) {
+        return false;
+    }
+
+    // Same sampling positions as SDL_StretchSurface() with SDL_SCALEMODE_NEAREST
+    Uint32 *src_x = (Uint32 *)(band + (size_t)band_pitch * band_rows);
+    const Uint64 incx = ((Uint64)src_w << 16) / dst_w;
+    const Uint64 incy = ((Uint64)src_h << 16) / dst_h;
+    Uint64 posx = incx / 2;
+    Uint64 posy = incy / 2;
+    int row, i, x;
+
+    for (x = 0; x < dst_w; ++x) {
+        src_x[x] = (Uint32)(posx >> 16);
+        posx += incx;
+    }
+    if (dst_w & 1) {
+        src_x[dst_w] = src_x[dst_w - 1];
+    }
+
+    if (growing) {
+        int band_start = 0;
+        int band_end = 0;
+        int prev_sy = -1;
+        for (row = 0; row < dst_h; ++row) {
+            const int sy = (int)(posy >> 16);
+            Uint8 *out = (Uint8 *)dst + (size_t)row * dst_pitch;
+            posy += incy;
+
+            if (sy == prev_sy) {
+                SDL_memcpy(out, out - dst_pitch, (size_t)dst_w * bpp);
+                continue;
+            }
+            if (sy >= band_end) {
+                band_start = sy & ~1;  // keep 4:2:0 chroma rows paired up.
+                band_end = SDL_min(band_start + band_rows, src_h);
+                if (!yuv_rgb_any(src_format, dst_format, src_w, band_end - band_start,
+                                 y + (size_t)band_start * y_stride,
+                                 u + (size_t)(band_start >> uv_shift) * uv_stride,
+                                 v + (size_t)(band_start >> uv_shift) * uv_stride,
+                                 y_stride, uv_stride, band, band_pitch, yuv_type)) {
+                    SDL_free(band);
+                    return SDL_SetError("Unsupported YUV stretch conversion to %s", SDL_GetPixelFormatName(dst_format));
+                }
+            }
+            StretchRowNearest(band + (size_t)(sy - band_start) * band_pitch, out, dst_w, src_x, bpp);
+            prev_sy = sy;
+        }
+    } else {
+        for (row = 0; row < dst_h; row += band_rows) {
+            const int rows = SDL_min(band_rows, dst_h - row);
+
+            for (i = 0; i < rows; ++i) {
+                const int sy = (int)(posy >> 16);
+                const Uint8 *y_row = y + (size_t)sy * y_stride;
+                const Uint8 *u_row = u + (size_t)(sy >> uv_shift) * uv_stride;
+                const Uint8 *v_row = v + (size_t)(sy >> uv_shift) * uv_stride;
+                Uint8 *out = band + (size_t)i * band_pitch;
+
+                for (x = 0; x < band_w; x += 2) {
+                    const Uint32 sx0 = src_x[x];
+                    const Uint32 sx1 = src_x[x + 1];
+                    out[0] = y_row[sx0 * y_step];
+                    out[1] = u_row[(sx0 >> 1) * uv_step];
+                    out[2] = y_row[sx1 * y_step];
+                    out[3] = v_row[(sx0 >> 1) * uv_step];
+                    out += 4;
+                }
+                posy += incy;
+            }
+
+            if (!yuv_rgb_any(SDL_PIXELFORMAT_YUY2, dst_format, dst_w, rows, band, band + 1, band + 3, band_pitch, band_pitch,
+                             (Uint8 *)dst + (size_t)row * dst_pitch, dst_pitch, yuv_type)) {
+                SDL_free(band);
+                return SDL_SetError("Unsupported YUV stretch conversion to %s", SDL_GetPixelFormatName(dst_format));
+            }
+        }
+    }
+
+    SDL_free(band);
+    return true;
+}
+
 struct RGB2YUVFactors
 {
     int y_offset;
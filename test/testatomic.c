@@ -250,6 +250,88 @@ static void RunEpicTest(void)
 /* End atomic operation test */
 /**************************************************************************/
 
+/**************************************************************************/
+/* Spinlock contention and atomic wait test */
+
+#define NUM_LOCKERS       8
+#define LOCKS_PER_LOCKER  200000
+
+static SDL_SpinLock contended_lock;
+static int contended_counter;
+
+static int SDLCALL SpinlockLocker(void *junk)
+{
+    int i;
+
+    for (i = 0; i < LOCKS_PER_LOCKER; ++i) {
+        SDL_LockSpinlock(&contended_lock);
+        ++contended_counter;
+        if ((i % 1000) == 0) {
+            /* Hold the lock for a while now and then, so waiters have to sleep */
+            SDL_DelayNS(SDL_US_TO_NS(100));
+        }
+        SDL_UnlockSpinlock(&contended_lock);
+    }
+    return 0;
+}
+
+static SDL_AtomicInt wait_state;
+
+static int SDLCALL AtomicWaiter(void *junk)
+{
+    while (SDL_GetAtomicInt(&wait_state) == 0) {
+        SDL_WaitAtomicInt(&wait_state, 0, -1);
+    }
+    SDL_SetAtomicInt(&wait_state, 2);
+    SDL_WakeAtomicInt(&wait_state, true);
+    return 0;
+}
+
+static void RunSpinlockTest(void)
+{
+    SDL_Thread *threads[NUM_LOCKERS];
+    SDL_Thread *waiter;
+    Uint64 start, end;
+    int i;
+
+    SDL_Log("%s", "");
+    SDL_Log("spin lock contention------------------------------");
+    SDL_Log("%s", "");
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_LOCKERS; ++i) {
+        threads[i] = SDL_CreateThread(SpinlockLocker, "Locker", NULL);
+    }
+    for (i = 0; i < NUM_LOCKERS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    end = SDL_GetTicksNS();
+    SDL_Log("%d threads locked %d times each in %f sec", NUM_LOCKERS, LOCKS_PER_LOCKER, (end - start) / 1000000000.0);
+    SDL_Log("Counter %d, expected %d", contended_counter, NUM_LOCKERS * LOCKS_PER_LOCKER);
+    SDL_assert(contended_counter == NUM_LOCKERS * LOCKS_PER_LOCKER);
+
+    SDL_Log("%s", "");
+    SDL_Log("atomic wait---------------------------------------");
+    SDL_Log("%s", "");
+
+    SDL_SetAtomicInt(&wait_state, 0);
+    SDL_assert(!SDL_WaitAtomicInt(&wait_state, 0, SDL_MS_TO_NS(10)));
+    SDL_assert(SDL_WaitAtomicInt(&wait_state, 1, -1));
+
+    waiter = SDL_CreateThread(AtomicWaiter, "Waiter", NULL);
+    SDL_Delay(10);
+    SDL_SetAtomicInt(&wait_state, 1);
+    SDL_WakeAtomicInt(&wait_state, false);
+    while (SDL_GetAtomicInt(&wait_state) != 2) {
+        SDL_WaitAtomicInt(&wait_state, 1, -1);
+    }
+    SDL_WaitThread(waiter, NULL);
+    SDL_Log("Waiter woke up and answered");
+}
+
+/* End spinlock contention and atomic wait test */
+/**************************************************************************/
+
 /**************************************************************************/
 /* Lock-free FIFO test */
 
@@ -752,6 +834,7 @@ int main(int argc, char *argv[])
 
     if (enable_threads) {
         RunEpicTest();
+        RunSpinlockTest();
     }
 /* This test is really slow, so don't run it by default */
 #if 0
@@ -24,6 +24,7 @@ static SDLTest_TestSuiteRunner *runner;
 /* All test suites */
 static SDLTest_TestSuiteReference *testSuites[] = {
     &audioTestSuite,
+    &cameraTestSuite,
     &clipboardTestSuite,
     &eventsTestSuite,
     &guidTestSuite,
@@ -46,6 +47,7 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &surfaceTestSuite,
     &timeTestSuite,
     &timerTestSuite,
+    &traceTestSuite,
     &videoTestSuite,
     &blitTestSuite,
     &subsystemsTestSuite, /* run last, not interfere with other test environment */
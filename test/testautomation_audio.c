@@ -1460,6 +1460,502 @@ cleanup:
 
     return status;
 }
+/* Builds a WAVE file in memory with pseudo-random sample data. */
+static Uint8 *build_wav_file(Uint16 formattag, Uint16 channels, Uint16 bitspersample, Uint16 blockalign, Uint16 samplesperblock, Uint32 datalength, size_t *size)
+{
+    static const Sint16 ms_adpcm_coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    const Uint32 fmtlength = formattag == 0x0002 ? 50 : (samplesperblock ? 20 : 16);
+    const size_t total = 12 + 8 + fmtlength + 8 + datalength;
+    Uint8 *wav = (Uint8 *)SDL_malloc(total);
+    SDL_IOStream *io;
+    Uint64 seed = 0x5EED;
+    Uint32 i;
+
+    if (!wav) {
+        return NULL;
+    }
+    io = SDL_IOFromMem(wav, total);
+    SDL_WriteU32LE(io, 0x46464952); /* "RIFF" */
+    SDL_WriteU32LE(io, (Uint32)(total - 8));
+    SDL_WriteU32LE(io, 0x45564157); /* "WAVE" */
+    SDL_WriteU32LE(io, 0x20746D66); /* "fmt " */
+    SDL_WriteU32LE(io, fmtlength);
+    SDL_WriteU16LE(io, formattag);
+    SDL_WriteU16LE(io, channels);
+    SDL_WriteU32LE(io, 22050);
+    SDL_WriteU32LE(io, 22050 * blockalign / (samplesperblock ? samplesperblock : 1));
+    SDL_WriteU16LE(io, blockalign);
+    SDL_WriteU16LE(io, bitspersample);
+    if (formattag == 0x0002) {
+        SDL_WriteU16LE(io, 32);
+        SDL_WriteU16LE(io, samplesperblock);
+        SDL_WriteU16LE(io, 7);
+        for (i = 0; i < SDL_arraysize(ms_adpcm_coeffs); ++i) {
+            SDL_WriteS16LE(io, ms_adpcm_coeffs[i]);
+        }
+    } else if (samplesperblock) {
+        SDL_WriteU16LE(io, 2);
+        SDL_WriteU16LE(io, samplesperblock);
+    }
+    SDL_WriteU32LE(io, 0x61746164); /* "data" */
+    SDL_WriteU32LE(io, datalength);
+    for (i = 0; i < datalength; ++i) {
+        Uint8 value = (Uint8)SDL_rand_r(&seed, 256);
+        if (formattag == 0x0011 && (i % blockalign) < 4U * channels) {
+            /* IMA ADPCM block header: step index must be valid and the reserved byte zero */
+            if ((i % 4) == 2) {
+                value %= 89;
+            } else if ((i % 4) == 3) {
+                value = 0;
+            }
+        } else if (formattag == 0x0002 && (i % blockalign) < channels) {
+            /* MS ADPCM block header: coefficient index must be valid */
+            value %= 7;
+        }
+        SDL_WriteU8(io, value);
+    }
+    SDL_CloseIO(io);
+
+    *size = total;
+    return wav;
+}
+
+/**
+ * Check that streaming WAVE data gives the same result as loading it.
+ *
+ * \sa SDL_OpenWAVStream_IO
+ * \sa SDL_SeekWAVStream
+ */
+static int SDLCALL audio_wavStream(void *arg)
+{
+    static const struct
+    {
+        const char *name;
+        Uint16 formattag;
+        Uint16 channels;
+        Uint16 bitspersample;
+        Uint16 blockalign;
+        Uint16 samplesperblock;
+        Uint32 datalength;
+    } formats[] = {
+        { "24-bit PCM", 0x0001, 2, 24, 6, 0, 6 * 10000 },
+        { "mu-law", 0x0007, 2, 8, 2, 0, 2 * 10001 },
+        { "IMA ADPCM", 0x0011, 1, 4, 256, 505, 256 * 20 + 100 },
+        { "IMA ADPCM stereo", 0x0011, 2, 4, 512, 505, 512 * 9 + 100 },
+        { "MS ADPCM", 0x0002, 1, 4, 256, 500, 256 * 11 + 100 },
+        { "MS ADPCM stereo", 0x0002, 2, 4, 512, 500, 512 * 9 + 100 },
+    };
+    int f;
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        SDL_AudioSpec spec, streamspec;
+        SDL_AudioStream *stream;
+        Uint8 *wav, *loaded = NULL, *streamed;
+        Uint32 loadedlen = 0;
+        size_t wavsize = 0;
+        int framesize, total = 0, result;
+        Sint64 seekframe;
+
+        wav = build_wav_file(formats[f].formattag, formats[f].channels, formats[f].bitspersample, formats[f].blockalign,
+                             formats[f].samplesperblock, formats[f].datalength, &wavsize);
+        SDLTest_AssertCheck(wav != NULL, "Build %s WAVE file", formats[f].name);
+        if (!wav) {
+            return TEST_ABORTED;
+        }
+
+        result = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavsize), true, &spec, &loaded, &loadedlen);
+        SDLTest_AssertPass("Call to SDL_LoadWAV_IO() with %s data", formats[f].name);
+        SDLTest_AssertCheck(result, "Validate result, expected: true, got: %s (%s)", result ? "true" : "false", SDL_GetError());
+
+        stream = SDL_OpenWAVStream_IO(SDL_IOFromConstMem(wav, wavsize), true, &streamspec);
+        SDLTest_AssertPass("Call to SDL_OpenWAVStream_IO() with %s data", formats[f].name);
+        SDLTest_AssertCheck(stream != NULL, "Validate result is not NULL (%s)", SDL_GetError());
+        if (!result || !stream) {
+            SDL_DestroyAudioStream(stream);
+            SDL_free(loaded);
+            SDL_free(wav);
+            return TEST_ABORTED;
+        }
+        SDLTest_AssertCheck(SDL_memcmp(&spec, &streamspec, sizeof(spec)) == 0, "Validate the streamed format matches the loaded format");
+
+        framesize = SDL_AUDIO_FRAMESIZE(spec);
+        SDLTest_AssertCheck(SDL_GetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER, -1) == (Sint64)(loadedlen / framesize),
+                            "Validate the number of frames, expected: %d", (int)(loadedlen / framesize));
+
+        /* Read the whole stream in odd-sized pieces */
+        streamed = (Uint8 *)SDL_malloc(loadedlen + 1024);
+        if (!streamed) {
+            SDL_DestroyAudioStream(stream);
+            SDL_free(loaded);
+            SDL_free(wav);
+            return TEST_ABORTED;
+        }
+        do {
+            result = SDL_GetAudioStreamData(stream, streamed + total, SDL_min(framesize * 333, (int)loadedlen + 1024 - total));
+            if (result > 0) {
+                total += result;
+            }
+        } while (result > 0);
+        SDLTest_AssertCheck(total == (int)loadedlen, "Validate streamed length, expected: %d, got: %d", (int)loadedlen, total);
+        SDLTest_AssertCheck(total == (int)loadedlen && SDL_memcmp(streamed, loaded, loadedlen) == 0, "Validate streamed data matches the loaded data");
+
+        /* Seek into the middle of a block and read the rest again */
+        seekframe = (loadedlen / framesize) / 3 + 7;
+        result = SDL_SeekWAVStream(stream, seekframe);
+        SDLTest_AssertPass("Call to SDL_SeekWAVStream(%d)", (int)seekframe);
+        SDLTest_AssertCheck(result, "Validate result, expected: true, got: %s", result ? "true" : "false");
+        total = 0;
+        do {
+            result = SDL_GetAudioStreamData(stream, streamed + total, SDL_min(framesize * 1000, (int)loadedlen + 1024 - total));
+            if (result > 0) {
+                total += result;
+            }
+        } while (result > 0);
+        SDLTest_AssertCheck(total == (int)(loadedlen - seekframe * framesize), "Validate length after seeking, expected: %d, got: %d", (int)(loadedlen - seekframe * framesize), total);
+        SDLTest_AssertCheck(SDL_memcmp(streamed, loaded + seekframe * framesize, total) == 0, "Validate data after seeking matches the loaded data");
+
+        SDL_DestroyAudioStream(stream);
+        SDL_free(streamed);
+        SDL_free(loaded);
+        SDL_free(wav);
+    }
+
+    /* Negative cases */
+    SDLTest_AssertCheck(SDL_OpenWAVStream_IO(NULL, false, NULL) == NULL, "Validate SDL_OpenWAVStream_IO(NULL) fails");
+    SDLTest_AssertCheck(!SDL_SeekWAVStream(NULL, 0), "Validate SDL_SeekWAVStream(NULL) fails");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check each of the resampling qualities of audio streams.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER
+ */
+static int SDLCALL audio_resampleQuality(void *arg)
+{
+  struct test_spec_t {
+    int rate_in;
+    int rate_out;
+  } test_specs[] = {
+    { 44100, 48000 },
+    { 48000, 96000 }, /* Every position is on a filter phase */
+    { 48000, 22050 },
+  };
+  /* Minimum signal-to-noise ratio of a 440 Hz sine, for each quality */
+  static const double min_signal_to_noise[] = { 30, 65, 100, 65, 80, 105 };
+  const int time = 2;
+  const int freq = 440;
+  const int num_channels = 2;
+  int spec_idx, quality, i;
+
+  for (spec_idx = 0; spec_idx < (int)SDL_arraysize(test_specs); ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int frames_in = time * spec->rate_in;
+    const int frames_target = time * spec->rate_out;
+    const int len_in = frames_in * num_channels * (int)sizeof(float);
+    const int len_target = frames_target * num_channels * (int)sizeof(float);
+    const int max_target = len_target * 2;
+    float *buf_in = (float *)SDL_malloc(len_in);
+    float *buf_out = (float *)SDL_malloc(max_target);
+    float *buf_default = (float *)SDL_malloc(max_target);
+    SDL_AudioSpec tmpspec1, tmpspec2;
+
+    SDLTest_AssertCheck(buf_in && buf_out && buf_default, "Expected buffers to be created.");
+    if (!buf_in || !buf_out || !buf_default) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      SDL_free(buf_default);
+      return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; ++i) {
+      buf_in[i * num_channels + 0] = (float)sine_wave_sample(i, spec->rate_in, freq, 0);
+      buf_in[i * num_channels + 1] = (float)sine_wave_sample(i, spec->rate_in, freq, SDL_PI_D / 2);
+    }
+
+    SDL_zero(tmpspec1);
+    SDL_zero(tmpspec2);
+    tmpspec1.format = SDL_AUDIO_F32;
+    tmpspec1.channels = num_channels;
+    tmpspec1.freq = spec->rate_in;
+    tmpspec2.format = SDL_AUDIO_F32;
+    tmpspec2.channels = num_channels;
+    tmpspec2.freq = spec->rate_out;
+
+    /* quality -1 is the default, without setting the property */
+    for (quality = -1; quality <= SDL_AUDIO_RESAMPLE_SINC_HIGH; ++quality) {
+      SDL_AudioStream *stream = SDL_CreateAudioStream(&tmpspec1, &tmpspec2);
+      float *output = (quality < 0) ? buf_default : buf_out;
+      double sum_squared_error = 0;
+      double sum_squared_value = 0;
+      double signal_to_noise;
+      int len_out;
+
+      SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+      if (stream == NULL) {
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        SDL_free(buf_default);
+        return TEST_ABORTED;
+      }
+
+      if (quality >= 0) {
+        SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality);
+        SDLTest_AssertPass("Set resample quality to %d, resampling from %i Hz to %i Hz", quality, spec->rate_in, spec->rate_out);
+      }
+
+      len_out = convert_audio_chunks(stream, buf_in, len_in, output, max_target);
+      SDL_DestroyAudioStream(stream);
+      SDLTest_AssertCheck(len_out == len_target, "Expected output length to be %i, got %i.", len_target, len_out);
+      if (len_out != len_target || quality < 0) {
+        continue;
+      }
+
+      if (quality == SDL_AUDIO_RESAMPLE_SINC_MEDIUM) {
+        SDLTest_AssertCheck(SDL_memcmp(buf_out, buf_default, len_target) == 0, "Expected the default quality to match SDL_AUDIO_RESAMPLE_SINC_MEDIUM.");
+      }
+
+      /* Skip the start and end, where the filters run into silence */
+      for (i = frames_target / 40; i < frames_target - frames_target / 40; ++i) {
+        const double target0 = sine_wave_sample(i, spec->rate_out, freq, 0);
+        const double target1 = sine_wave_sample(i, spec->rate_out, freq, SDL_PI_D / 2);
+        const double error0 = target0 - buf_out[i * num_channels + 0];
+        const double error1 = target1 - buf_out[i * num_channels + 1];
+        sum_squared_error += error0 * error0 + error1 * error1;
+        sum_squared_value += target0 * target0 + target1 * target1;
+      }
+      signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error); /* decibel */
+      SDLTest_AssertCheck(signal_to_noise >= min_signal_to_noise[quality], "Quality %d signal-to-noise ratio %f dB should be no less than %f dB.",
+                          quality, signal_to_noise, min_signal_to_noise[quality]);
+    }
+
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+    SDL_free(buf_default);
+  }
+
+  return TEST_COMPLETED;
+}
+
+#define SINGLE_PRODUCER_FRAMES 200000
+
+static int SDLCALL single_producer_thread(void *data)
+{
+  SDL_AudioStream *stream = (SDL_AudioStream *)data;
+  Sint16 chunk[2 * 97];
+  int frame = 0;
+
+  while (frame < SINGLE_PRODUCER_FRAMES) {
+    const int frames = SDL_min((int)SDL_arraysize(chunk) / 2, SINGLE_PRODUCER_FRAMES - frame);
+    int i;
+
+    for (i = 0; i < frames; ++i) {
+      chunk[i * 2 + 0] = (Sint16)(frame + i);
+      chunk[i * 2 + 1] = (Sint16)~(frame + i);
+    }
+    if (SDL_PutAudioStreamData(stream, chunk, frames * 4)) {
+      frame += frames;
+    } else {
+      SDL_Delay(1); /* ring buffer full */
+    }
+  }
+  return 0;
+}
+
+/**
+ * Check an audio stream fed through a single producer ring buffer.
+ *
+ * \sa SDL_SetAudioStreamSingleProducer
+ */
+static int SDLCALL audio_singleProducer(void *arg)
+{
+  const SDL_AudioSpec spec = { SDL_AUDIO_S16, 2, 48000 };
+  SDL_AudioSpec other_spec = spec;
+  SDL_AudioStream *stream;
+  SDL_Thread *thread;
+  Sint16 buf[2 * 256];
+  Sint16 full[2 * 32];
+  int frame = 0;
+  int errors = 0;
+  Uint64 start;
+  bool result;
+
+  stream = SDL_CreateAudioStream(NULL, &spec);
+  SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+  if (stream == NULL) {
+    return TEST_ABORTED;
+  }
+
+  result = SDL_SetAudioStreamSingleProducer(stream, 16);
+  SDLTest_AssertCheck(!result, "Expected SDL_SetAudioStreamSingleProducer to fail without an input format.");
+  result = SDL_SetAudioStreamSingleProducer(NULL, 16);
+  SDLTest_AssertCheck(!result, "Expected SDL_SetAudioStreamSingleProducer(NULL) to fail.");
+
+  SDL_SetAudioStreamFormat(stream, &spec, NULL);
+  result = SDL_SetAudioStreamSingleProducer(stream, 16);
+  SDLTest_AssertCheck(result, "Expected SDL_SetAudioStreamSingleProducer(16) to succeed.");
+
+  SDL_zeroa(full);
+  result = SDL_PutAudioStreamData(stream, full, sizeof(full));
+  SDLTest_AssertCheck(!result, "Expected putting more than the ring buffer holds to fail.");
+  result = SDL_PutAudioStreamData(stream, full, sizeof(full) / 2);
+  SDLTest_AssertCheck(result, "Expected putting a full ring buffer to succeed.");
+  SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == (int)sizeof(full) / 2, "Expected %d bytes queued, got %d.", (int)sizeof(full) / 2, SDL_GetAudioStreamQueued(stream));
+
+  other_spec.format = SDL_AUDIO_F32;
+  result = SDL_SetAudioStreamFormat(stream, &other_spec, NULL);
+  SDLTest_AssertCheck(!result, "Expected changing the input format to fail.");
+  SDL_ClearAudioStream(stream);
+
+  /* A bigger buffer, with a thread feeding it while this one reads */
+  result = SDL_SetAudioStreamSingleProducer(stream, 4096);
+  SDLTest_AssertCheck(result, "Expected SDL_SetAudioStreamSingleProducer(4096) to succeed.");
+
+  thread = SDL_CreateThread(single_producer_thread, "SingleProducer", stream);
+  SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed.");
+  if (thread == NULL) {
+    SDL_DestroyAudioStream(stream);
+    return TEST_ABORTED;
+  }
+
+  start = SDL_GetTicks();
+  while (frame < SINGLE_PRODUCER_FRAMES && (SDL_GetTicks() - start) < 10000) {
+    const int got = SDL_GetAudioStreamData(stream, buf, sizeof(buf));
+    int i;
+
+    if (got < 0) {
+      break;
+    }
+    for (i = 0; i < got / 4; ++i, ++frame) {
+      if (buf[i * 2 + 0] != (Sint16)frame || buf[i * 2 + 1] != (Sint16)~frame) {
+        ++errors;
+      }
+    }
+  }
+  SDL_WaitThread(thread, NULL);
+
+  SDLTest_AssertCheck(frame == SINGLE_PRODUCER_FRAMES, "Expected to read %d frames, got %d.", SINGLE_PRODUCER_FRAMES, frame);
+  SDLTest_AssertCheck(errors == 0, "Expected the frames in order, got %d mismatches.", errors);
+
+  result = SDL_SetAudioStreamSingleProducer(stream, 0);
+  SDLTest_AssertCheck(result, "Expected SDL_SetAudioStreamSingleProducer(0) to succeed.");
+  result = SDL_PutAudioStreamData(stream, full, sizeof(full));
+  SDLTest_AssertCheck(result, "Expected putting data without the ring buffer to succeed.");
+
+  SDL_DestroyAudioStream(stream);
+
+  return TEST_COMPLETED;
+}
+
+static int offline_postmix_frames;
+static int offline_postmix_errors;
+
+static void SDLCALL offline_postmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+  const int frames = buflen / (int)(sizeof(float) * spec->channels);
+  int i;
+
+  for (i = 0; i < frames; ++i, ++offline_postmix_frames) {
+    const float expected = (float)(offline_postmix_frames % 1000) / 1000.0f;
+    if (buffer[i * 2 + 0] != expected || buffer[i * 2 + 1] != -expected) {
+      ++offline_postmix_errors;
+    }
+  }
+}
+
+/**
+ * Check stepping the dummy audio driver on a manual clock.
+ *
+ * \sa SDL_HINT_AUDIO_OFFLINE_CLOCK
+ * \sa SDL_StepAudioDevice
+ */
+static int SDLCALL audio_offlineClock(void *arg)
+{
+  const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+  SDL_AudioSpec device_spec;
+  SDL_AudioDeviceID devid;
+  SDL_AudioStream *stream;
+  float *data;
+  int sample_frames = 0;
+  int stepped = 0;
+  int init_count = 0;
+  int i;
+  bool result;
+
+  /* The driver reads the hint when it starts, so make sure it really restarts */
+  while (SDL_WasInit(SDL_INIT_AUDIO)) {
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    ++init_count;
+  }
+  SDL_SetHintWithPriority(SDL_HINT_AUDIO_DRIVER, "dummy", SDL_HINT_OVERRIDE);
+  SDL_SetHintWithPriority(SDL_HINT_AUDIO_OFFLINE_CLOCK, "manual", SDL_HINT_OVERRIDE);
+  result = SDL_InitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertCheck(result, "Expected SDL_InitSubSystem(SDL_INIT_AUDIO) with the dummy driver to succeed.");
+  if (!result) {
+    goto done;
+  }
+
+  devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+  SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed.");
+  if (devid == 0) {
+    goto done;
+  }
+  SDL_GetAudioDeviceFormat(devid, &device_spec, &sample_frames);
+  SDLTest_AssertCheck(sample_frames > 0, "Expected a device buffer size, got %d.", sample_frames);
+
+  data = (float *)SDL_malloc(48000 * 2 * sizeof(float));
+  stream = SDL_CreateAudioStream(&spec, &spec);
+  SDLTest_AssertCheck(data && stream, "Expected an audio stream and its data.");
+  if (!data || !stream || sample_frames <= 0) {
+    SDL_free(data);
+    SDL_DestroyAudioStream(stream);
+    SDL_CloseAudioDevice(devid);
+    goto done;
+  }
+  for (i = 0; i < 48000; ++i) {
+    data[i * 2 + 0] = (float)(i % 1000) / 1000.0f;
+    data[i * 2 + 1] = -data[i * 2 + 0];
+  }
+  SDL_PutAudioStreamData(stream, data, 48000 * 2 * sizeof(float));
+  SDL_free(data);
+
+  offline_postmix_frames = 0;
+  offline_postmix_errors = 0;
+  SDL_SetAudioPostmixCallback(devid, offline_postmix, NULL);
+  SDL_BindAudioStream(devid, stream);
+
+  /* Nothing happens until the clock is advanced */
+  SDL_Delay(50);
+  SDLTest_AssertCheck(offline_postmix_frames == 0, "Expected no audio before stepping, got %d frames.", offline_postmix_frames);
+
+  /* One 60 Hz video frame of audio at a time, which doesn't line up with the device buffers */
+  for (i = 0; i < 30; ++i) {
+    result = SDL_StepAudioDevice(devid, 800);
+    SDLTest_AssertCheck(result, "Expected SDL_StepAudioDevice to succeed.");
+    stepped += 800;
+    SDLTest_AssertCheck(offline_postmix_frames == (stepped / sample_frames) * sample_frames,
+                        "Expected %d frames after stepping %d, got %d.", (stepped / sample_frames) * sample_frames, stepped, offline_postmix_frames);
+  }
+  SDLTest_AssertCheck(offline_postmix_errors == 0, "Expected the stream data in the mix, got %d mismatches.", offline_postmix_errors);
+
+  result = SDL_StepAudioDevice(devid, -1);
+  SDLTest_AssertCheck(!result, "Expected SDL_StepAudioDevice(-1) to fail.");
+
+  SDL_DestroyAudioStream(stream);
+  SDL_CloseAudioDevice(devid);
+
+done:
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDL_ResetHint(SDL_HINT_AUDIO_OFFLINE_CLOCK);
+  SDL_ResetHint(SDL_HINT_AUDIO_DRIVER);
+  for (i = 0; i < init_count; ++i) {
+    SDL_InitSubSystem(SDL_INIT_AUDIO);
+  }
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1541,13 +2037,29 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_wavStream, "audio_wavStream", "Check streaming WAVE data against loading it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check each of the audio resampling qualities.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_singleProducer, "audio_singleProducer", "Check feeding an audio stream through a single producer ring buffer.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_offlineClock, "audio_offlineClock", "Check stepping an audio device on a manual clock.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, NULL
 };
 
 /* Audio test suite (global) */
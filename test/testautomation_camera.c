@@ -0,0 +1,349 @@
+/**
+ * Camera test suite, using the virtual devices of the dummy camera driver.
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+#define CAMERA_FRAME_TIMEOUT_MS 5000
+
+/* Fixture */
+
+static bool camera_initialized;
+
+static void SDLCALL cameraSetUp(void **arg)
+{
+    SDL_SetHint(SDL_HINT_CAMERA_DRIVER, "dummy");
+    camera_initialized = false;
+}
+
+static void SDLCALL cameraTearDown(void *arg)
+{
+    if (camera_initialized) {
+        SDL_QuitSubSystem(SDL_INIT_CAMERA);
+    }
+    SDL_ResetHint(SDL_HINT_CAMERA_DUMMY_DEVICES);
+    SDL_ResetHint(SDL_HINT_CAMERA_DRIVER);
+}
+
+static bool initCamera(const char *devices)
+{
+    SDL_SetHint(SDL_HINT_CAMERA_DUMMY_DEVICES, devices);
+    camera_initialized = SDL_InitSubSystem(SDL_INIT_CAMERA);
+    SDLTest_AssertCheck(camera_initialized, "SDL_InitSubSystem(SDL_INIT_CAMERA) with devices \"%s\": %s", devices, camera_initialized ? "ok" : SDL_GetError());
+    return camera_initialized;
+}
+
+static SDL_Surface *acquireFrame(SDL_Camera *camera, Uint64 *timestampNS)
+{
+    const Uint64 timeout = SDL_GetTicks() + CAMERA_FRAME_TIMEOUT_MS;
+    do {
+        SDL_Surface *frame = SDL_AcquireCameraFrame(camera, timestampNS);
+        if (frame) {
+            return frame;
+        }
+        SDL_Delay(1);
+    } while (SDL_GetTicks() < timeout);
+    return NULL;
+}
+
+/* White, yellow, cyan, green, magenta, red, blue, black */
+static const Uint8 bars[8][3] = {
+    { 255, 255, 255 }, { 255, 255, 0 }, { 0, 255, 255 }, { 0, 255, 0 },
+    { 255, 0, 255 }, { 255, 0, 0 }, { 0, 0, 255 }, { 0, 0, 0 }
+};
+
+static int getBar(SDL_Surface *frame, int x, int y)
+{
+    Uint8 r, g, b, a;
+    int bar;
+
+    SDL_ReadSurfacePixel(frame, x, y, &r, &g, &b, &a);
+    for (bar = 0; bar < SDL_arraysize(bars); ++bar) {
+        if (SDL_abs(r - bars[bar][0]) <= 8 && SDL_abs(g - bars[bar][1]) <= 8 && SDL_abs(b - bars[bar][2]) <= 8) {
+            return bar;
+        }
+    }
+    return -1;
+}
+
+/* Test case functions */
+
+/**
+ * Checks that the dummy driver exposes the devices described by SDL_HINT_CAMERA_DUMMY_DEVICES.
+ */
+static int SDLCALL camera_dummyDevices(void *arg)
+{
+    static const SDL_CameraSpec expected[] = {
+        { SDL_PIXELFORMAT_YUY2, SDL_COLORSPACE_UNKNOWN, 64, 48, 30, 1 },
+        { SDL_PIXELFORMAT_NV12, SDL_COLORSPACE_UNKNOWN, 64, 48, 60, 1 },
+        { SDL_PIXELFORMAT_MJPG, SDL_COLORSPACE_UNKNOWN, 64, 48, 30, 1 },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_UNKNOWN, 32, 16, 15, 2 }
+    };
+    SDL_CameraID *cameras;
+    int count = 0;
+    int i;
+
+    /* The last two are invalid: an unknown format and an odd NV12 width */
+    if (!initCamera("YUY2 64x48, NV12 64x48@60 free, mjpg 64x48@30, XRGB8888 32x16@15/2 file=unused.raw, RGB24 8x8, NV12 63x48")) {
+        return TEST_ABORTED;
+    }
+
+    cameras = SDL_GetCameras(&count);
+    SDLTest_AssertCheck(cameras != NULL, "SDL_GetCameras()");
+    SDLTest_AssertCheck(count == SDL_arraysize(expected), "Check camera count, expected: %d, got: %d", (int)SDL_arraysize(expected), count);
+
+    for (i = 0; cameras && i < count && i < SDL_arraysize(expected); ++i) {
+        SDL_CameraSpec **specs = SDL_GetCameraSupportedFormats(cameras[i], NULL);
+        SDLTest_AssertCheck(specs && specs[0] && !specs[1], "Check camera %d has one format", i);
+        if (specs && specs[0]) {
+            const SDL_CameraSpec *spec = specs[0];
+            SDLTest_AssertCheck(spec->format == expected[i].format &&
+                                spec->width == expected[i].width && spec->height == expected[i].height &&
+                                spec->framerate_numerator == expected[i].framerate_numerator &&
+                                spec->framerate_denominator == expected[i].framerate_denominator,
+                                "Check camera %d format, expected: %s %dx%d@%d/%d, got: %s %dx%d@%d/%d", i,
+                                SDL_GetPixelFormatName(expected[i].format), expected[i].width, expected[i].height,
+                                expected[i].framerate_numerator, expected[i].framerate_denominator,
+                                SDL_GetPixelFormatName(spec->format), spec->width, spec->height,
+                                spec->framerate_numerator, spec->framerate_denominator);
+        }
+        SDL_free(specs);
+    }
+    SDL_free(cameras);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Checks the generated test pattern in every format, converted to XRGB8888 by the camera pipeline.
+ */
+static int SDLCALL camera_dummyPattern(void *arg)
+{
+    SDL_CameraID *cameras;
+    int count = 0;
+    int i, x, y;
+
+    if (!initCamera("YUY2 64x16 free, NV12 64x16 free, MJPG 64x16 free, XRGB8888 64x16 free")) {
+        return TEST_ABORTED;
+    }
+
+    cameras = SDL_GetCameras(&count);
+    SDLTest_AssertCheck(count == 4, "Check camera count, expected: 4, got: %d", count);
+
+    for (i = 0; cameras && i < count; ++i) {
+        SDL_CameraSpec spec;
+        SDL_Camera *camera;
+        SDL_Surface *frame, *next;
+        Uint64 timestamp = 0, next_timestamp = 0;
+        int mismatches = 0;
+
+        SDL_zero(spec);
+        spec.format = SDL_PIXELFORMAT_XRGB8888;
+        camera = SDL_OpenCamera(cameras[i], &spec);
+        SDLTest_AssertCheck(camera != NULL, "SDL_OpenCamera(%s)", SDL_GetCameraName(cameras[i]));
+        if (!camera) {
+            continue;
+        }
+
+        frame = acquireFrame(camera, &timestamp);
+        next = acquireFrame(camera, &next_timestamp);
+        SDLTest_AssertCheck(frame && next, "Acquire two frames from %s", SDL_GetCameraName(cameras[i]));
+        if (frame && next) {
+            SDLTest_AssertCheck(frame->w == 64 && frame->h == 16 && frame->format == SDL_PIXELFORMAT_XRGB8888,
+                                "Check frame, expected: 64x16 %s, got: %dx%d %s", SDL_GetPixelFormatName(SDL_PIXELFORMAT_XRGB8888),
+                                frame->w, frame->h, SDL_GetPixelFormatName(frame->format));
+            SDLTest_AssertCheck(next_timestamp > timestamp, "Check timestamps increase, got: %" SDL_PRIu64 " then %" SDL_PRIu64, timestamp, next_timestamp);
+
+            /* Every pixel is one of the color bars, and the pattern scrolls 8 pixels to the left every frame */
+            for (y = 0; y < frame->h; ++y) {
+                for (x = 0; x < frame->w; ++x) {
+                    Uint8 r, g, b, a, r2, g2, b2, a2;
+
+                    SDL_ReadSurfacePixel(frame, x, y, &r, &g, &b, &a);
+                    SDL_ReadSurfacePixel(next, (x + frame->w - 8) % frame->w, y, &r2, &g2, &b2, &a2);
+                    if (getBar(frame, x, y) < 0 || r != r2 || g != g2 || b != b2) {
+                        ++mismatches;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Check %s pattern, expected: 0 mismatched pixels, got: %d", SDL_GetCameraName(cameras[i]), mismatches);
+        }
+
+        if (frame) {
+            SDL_ReleaseCameraFrame(camera, frame);
+        }
+        if (next) {
+            SDL_ReleaseCameraFrame(camera, next);
+        }
+        SDL_CloseCamera(camera);
+    }
+    SDL_free(cameras);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Checks YUV frames that are scaled and converted to XRGB8888 by the camera pipeline.
+ */
+static int SDLCALL camera_dummyScaled(void *arg)
+{
+    static const int sizes[][2] = { { 32, 8 }, { 128, 32 }, { 48, 12 } };
+    SDL_CameraID *cameras;
+    int count = 0;
+    int i, j, x, y;
+
+    if (!initCamera("YUY2 64x16 free, NV12 64x16 free")) {
+        return TEST_ABORTED;
+    }
+
+    cameras = SDL_GetCameras(&count);
+    SDLTest_AssertCheck(count == 2, "Check camera count, expected: 2, got: %d", count);
+
+    for (i = 0; cameras && i < count; ++i) {
+        for (j = 0; j < SDL_arraysize(sizes); ++j) {
+            SDL_CameraSpec spec;
+            SDL_Camera *camera;
+            SDL_Surface *frame;
+            int mismatches = 0;
+
+            SDL_zero(spec);
+            spec.format = SDL_PIXELFORMAT_XRGB8888;
+            spec.width = sizes[j][0];
+            spec.height = sizes[j][1];
+            camera = SDL_OpenCamera(cameras[i], &spec);
+            SDLTest_AssertCheck(camera != NULL, "SDL_OpenCamera(%s) at %dx%d", SDL_GetCameraName(cameras[i]), spec.width, spec.height);
+            if (!camera) {
+                continue;
+            }
+
+            frame = acquireFrame(camera, NULL);
+            SDLTest_AssertCheck(frame && frame->w == spec.width && frame->h == spec.height,
+                                "Check frame size, expected: %dx%d, got: %dx%d", spec.width, spec.height, frame ? frame->w : 0, frame ? frame->h : 0);
+            if (frame) {
+                /* Each source pixel covers width/64 output pixels, so every bar is width/8 pixels wide, in order */
+                const int bar_w = frame->w / 8;
+                for (y = 0; y < frame->h; ++y) {
+                    const int first = getBar(frame, 0, y);
+                    for (x = 0; x < frame->w; ++x) {
+                        if (first < 0 || getBar(frame, x, y) != (first + x / bar_w) % 8) {
+                            ++mismatches;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Check %s scaled to %dx%d, expected: 0 mismatched pixels, got: %d",
+                                    SDL_GetCameraName(cameras[i]), spec.width, spec.height, mismatches);
+                SDL_ReleaseCameraFrame(camera, frame);
+            }
+            SDL_CloseCamera(camera);
+        }
+    }
+    SDL_free(cameras);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Checks that raw frames are streamed from a file, starting over at the end of the file.
+ */
+static int SDLCALL camera_dummyFile(void *arg)
+{
+    const char *path = "camera_dummyFile.raw";
+    char devices[128];
+    Uint32 pixels[16 * 8];
+    SDL_IOStream *io;
+    SDL_CameraID *cameras;
+    SDL_Camera *camera = NULL;
+    int count = 0;
+    int i, j;
+
+    io = SDL_IOFromFile(path, "wb");
+    SDLTest_AssertCheck(io != NULL, "SDL_IOFromFile(\"%s\", \"wb\")", path);
+    if (!io) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < SDL_arraysize(pixels); ++j) {
+            pixels[j] = 0xFF000000 | (Uint32)(i * 0x101010);
+        }
+        SDL_WriteIO(io, pixels, sizeof(pixels));
+    }
+    SDL_CloseIO(io);
+
+    SDL_snprintf(devices, sizeof(devices), "XRGB8888 16x8 free file=%s", path);
+    if (initCamera(devices)) {
+        cameras = SDL_GetCameras(&count);
+        SDLTest_AssertCheck(count == 1, "Check camera count, expected: 1, got: %d", count);
+        if (cameras && count == 1) {
+            camera = SDL_OpenCamera(cameras[0], NULL);
+            SDLTest_AssertCheck(camera != NULL, "SDL_OpenCamera()");
+        }
+        SDL_free(cameras);
+    }
+
+    if (camera) {
+        int previous = -1;
+        for (i = 0; i < 6; ++i) {
+            SDL_Surface *frame = acquireFrame(camera, NULL);
+            SDLTest_AssertCheck(frame != NULL, "Acquire frame %d", i);
+            if (!frame) {
+                break;
+            }
+
+            /* The camera pipeline drops the first frame, so start from whichever frame came first */
+            const int index = (int)((*(const Uint32 *)frame->pixels & 0xFF) / 0x10);
+            bool uniform = true;
+            for (j = 0; j < frame->h; ++j) {
+                const Uint32 *row = (const Uint32 *)((const Uint8 *)frame->pixels + j * frame->pitch);
+                for (int x = 0; x < frame->w; ++x) {
+                    if (row[x] != 0xFF000000 + (Uint32)(index * 0x101010)) {
+                        uniform = false;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(uniform && index < 3, "Check frame %d holds file frame %d", i, index);
+            if (previous >= 0) {
+                SDLTest_AssertCheck(index == (previous + 1) % 3, "Check file frame order, expected: %d, got: %d", (previous + 1) % 3, index);
+            }
+            previous = index;
+            SDL_ReleaseCameraFrame(camera, frame);
+        }
+        SDL_CloseCamera(camera);
+    }
+
+    SDL_RemovePath(path);
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Camera test cases */
+static const SDLTest_TestCaseReference cameraTest1 = {
+    camera_dummyDevices, "camera_dummyDevices", "Check the virtual devices of the dummy camera driver", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference cameraTest2 = {
+    camera_dummyPattern, "camera_dummyPattern", "Check the test pattern of the dummy camera driver in every format", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference cameraTest3 = {
+    camera_dummyFile, "camera_dummyFile", "Check frames streamed from a file by the dummy camera driver", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference cameraTest4 = {
+    camera_dummyScaled, "camera_dummyScaled", "Check camera frames that are scaled and converted at once", TEST_ENABLED
+};
+
+/* Sequence of Camera test cases */
+static const SDLTest_TestCaseReference *cameraTests[] = {
+    &cameraTest1, &cameraTest2, &cameraTest3, &cameraTest4, NULL
+};
+
+/* Camera test suite (global) */
+SDLTest_TestSuiteReference cameraTestSuite = {
+    "Camera",
+    cameraSetUp,
+    cameraTests,
+    cameraTearDown
+};
@@ -304,6 +304,80 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that motion events are coalesced while they are queued, when enabled
+ *
+ * \sa SDL_HINT_EVENT_COALESCING
+ * \sa SDL_PeepEvents
+ */
+static int SDLCALL events_coalesceMotion(void *arg)
+{
+    SDL_Event event;
+    SDL_Event events[8];
+    int i, count;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_SetHint(SDL_HINT_EVENT_COALESCING, "1");
+
+    /* Axis motion for the same axis replaces the pending event, other axes are kept */
+    for (i = 0; i < 4; ++i) {
+        SDL_zero(event);
+        event.type = SDL_EVENT_JOYSTICK_AXIS_MOTION;
+        event.jaxis.which = 1;
+        event.jaxis.axis = (Uint8)(i % 2);
+        event.jaxis.value = (Sint16)(100 * i);
+        SDL_PeepEvents(&event, 1, SDL_ADDEVENT, 0, 0);
+    }
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_JOYSTICK_AXIS_MOTION, SDL_EVENT_JOYSTICK_AXIS_MOTION);
+    SDLTest_AssertCheck(count == 2, "Check coalesced axis event count, expected: 2, got: %d", count);
+    if (count == 2) {
+        SDLTest_AssertCheck(events[0].jaxis.axis == 0 && events[0].jaxis.value == 200, "Check axis 0 has the latest value, expected: 200, got: %d", events[0].jaxis.value);
+        SDLTest_AssertCheck(events[1].jaxis.axis == 1 && events[1].jaxis.value == 300, "Check axis 1 has the latest value, expected: 300, got: %d", events[1].jaxis.value);
+    }
+
+    /* Mouse motion accumulates the relative motion, and isn't coalesced past other events */
+    for (i = 0; i < 6; ++i) {
+        SDL_zero(event);
+        if (i == 3) {
+            event.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+            event.button.button = SDL_BUTTON_LEFT;
+            event.button.down = true;
+            event.button.x = 30.0f;
+        } else {
+            event.type = SDL_EVENT_MOUSE_MOTION;
+            event.motion.x = 10.0f * (i + 1);
+            event.motion.xrel = 10.0f;
+            event.motion.yrel = 1.0f;
+        }
+        SDL_PeepEvents(&event, 1, SDL_ADDEVENT, 0, 0);
+    }
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_BUTTON_UP);
+    SDLTest_AssertCheck(count == 3, "Check coalesced mouse event count, expected: 3, got: %d", count);
+    if (count == 3) {
+        SDLTest_AssertCheck(events[0].type == SDL_EVENT_MOUSE_MOTION && events[0].motion.x == 30.0f && events[0].motion.xrel == 30.0f && events[0].motion.yrel == 3.0f,
+                            "Check first motion, expected: x=30 xrel=30 yrel=3, got: x=%g xrel=%g yrel=%g", events[0].motion.x, events[0].motion.xrel, events[0].motion.yrel);
+        SDLTest_AssertCheck(events[1].type == SDL_EVENT_MOUSE_BUTTON_DOWN, "Check the button press stays in order");
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_MOUSE_MOTION && events[2].motion.x == 60.0f && events[2].motion.xrel == 20.0f,
+                            "Check second motion, expected: x=60 xrel=20, got: x=%g xrel=%g", events[2].motion.x, events[2].motion.xrel);
+    }
+
+    /* Nothing is coalesced once the hint is disabled */
+    SDL_SetHint(SDL_HINT_EVENT_COALESCING, "0");
+    for (i = 0; i < 4; ++i) {
+        SDL_zero(event);
+        event.type = SDL_EVENT_JOYSTICK_AXIS_MOTION;
+        event.jaxis.which = 1;
+        SDL_PeepEvents(&event, 1, SDL_ADDEVENT, 0, 0);
+    }
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_JOYSTICK_AXIS_MOTION, SDL_EVENT_JOYSTICK_AXIS_MOTION);
+    SDLTest_AssertCheck(count == 4, "Check axis event count without coalescing, expected: 4, got: %d", count);
+
+    SDL_ResetHint(SDL_HINT_EVENT_COALESCING);
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -323,12 +397,17 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_coalesceMotion = {
+    events_coalesceMotion, "events_coalesceMotion", "Coalesces queued motion events", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_coalesceMotion,
     NULL
 };
 
@@ -199,6 +199,82 @@ static int SDLCALL TestVirtualJoystick(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that mappings are matched by GUID and CRC, and survive a round trip through the binary database
+ *
+ * \sa SDL_AddGamepadMapping
+ * \sa SDL_SaveGamepadMappingsToIO
+ * \sa SDL_AddGamepadMappingsFromIO
+ */
+static int SDLCALL TestGamepadMappingDatabase(void *arg)
+{
+    static const char *mappings[] = {
+        "03000000ad1b0000feca000001000000,Test Gamepad,a:b0,b:b1,x:b2,y:b3,platform:%s,",
+        "03000000ad1b0000feca000001000000,Test Gamepad CRC,a:b1,b:b0,x:b3,y:b2,crc:1234,platform:%s,",
+    };
+    SDL_IOStream *io;
+    void *db;
+    size_t db_size = 0;
+    char *mapping;
+    int pass, i;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMEPAD), "SDL_InitSubSystem(SDL_INIT_GAMEPAD)");
+
+    for (i = 0; i < SDL_arraysize(mappings); ++i) {
+        char *line = NULL;
+        SDL_asprintf(&line, mappings[i], SDL_GetPlatform());
+        SDLTest_AssertCheck(SDL_AddGamepadMapping(line) == 1, "SDL_AddGamepadMapping(\"%s\") == 1", line);
+        SDL_free(line);
+    }
+
+    /* Save the mappings and reset the database */
+    io = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(SDL_SaveGamepadMappingsToIO(io, false), "SDL_SaveGamepadMappingsToIO()");
+    db_size = (size_t)SDL_GetIOSize(io);
+    db = SDL_malloc(db_size);
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+    SDLTest_AssertCheck(db && SDL_ReadIO(io, db, db_size) == db_size, "Read %d byte database", (int)db_size);
+    SDL_CloseIO(io);
+
+    for (pass = 0; pass < 2; ++pass) {
+        if (pass == 1) {
+            SDLTest_AssertCheck(SDL_ReloadGamepadMappings(), "SDL_ReloadGamepadMappings()");
+            mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03000000ad1b0000feca000001000000"));
+            SDLTest_AssertCheck(mapping == NULL, "Mappings removed by SDL_ReloadGamepadMappings()");
+            SDL_free(mapping);
+
+            SDLTest_AssertCheck(SDL_AddGamepadMappingsFromIO(SDL_IOFromConstMem(db, db_size), true) == 2, "SDL_AddGamepadMappingsFromIO() loaded 2 mappings from the binary database");
+        }
+
+        mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03000000ad1b0000feca000001000000"));
+        SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad,") != NULL, "Mapping without CRC: %s", mapping ? mapping : "(null)");
+        SDL_free(mapping);
+
+        mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03003412ad1b0000feca000001000000"));
+        SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad CRC,") != NULL, "Mapping with matching CRC: %s", mapping ? mapping : "(null)");
+        SDL_free(mapping);
+
+        mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03007856ad1b0000feca000001000000"));
+        SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad,") != NULL, "Mapping with other CRC: %s", mapping ? mapping : "(null)");
+        SDL_free(mapping);
+
+        mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03000000ad1b0000feca000002000000"));
+        SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad,") != NULL, "Mapping with other version: %s", mapping ? mapping : "(null)");
+        SDL_free(mapping);
+    }
+
+    /* A truncated database is rejected */
+    SDLTest_AssertCheck(SDL_AddGamepadMappingsFromIO(SDL_IOFromConstMem(db, db_size - 1), true) == -1, "SDL_AddGamepadMappingsFromIO() with a truncated database");
+
+    SDL_free(db);
+
+    SDLTest_AssertCheck(SDL_ReloadGamepadMappings(), "SDL_ReloadGamepadMappings()");
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -206,9 +282,14 @@ static const SDLTest_TestCaseReference joystickTest1 = {
     TestVirtualJoystick, "TestVirtualJoystick", "Test virtual joystick functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference joystickTest2 = {
+    TestGamepadMappingDatabase, "TestGamepadMappingDatabase", "Test gamepad mapping lookup and the binary mapping database", TEST_ENABLED
+};
+
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
+    &joystickTest2,
     NULL
 };
 
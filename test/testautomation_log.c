@@ -188,6 +188,139 @@ static int SDLCALL log_testHint(void *arg)
     return TEST_COMPLETED;
 }
 
+#define NUM_ASYNC_THREADS  4
+#define NUM_ASYNC_MESSAGES 1000
+
+typedef struct AsyncLogState
+{
+    SDL_ThreadID caller;
+    int count;
+    int dropped;
+    int errors;
+    int long_messages;
+    int next[NUM_ASYNC_THREADS];
+    int delay_ns;
+} AsyncLogState;
+
+static void SDLCALL AsyncLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    AsyncLogState *state = (AsyncLogState *)userdata;
+    int thread, index, dropped;
+
+    if (category == SDL_LOG_CATEGORY_TEST) {
+        /* Pass on the test harness output */
+        original_function(original_userdata, category, priority, message);
+    } else if (category == SDL_LOG_CATEGORY_SYSTEM &&
+               SDL_sscanf(message, "%d log messages were dropped", &dropped) == 1) {
+        state->dropped += dropped;
+    } else if (SDL_sscanf(message, "thread %d message %d", &thread, &index) == 2 &&
+               thread >= 0 && thread < NUM_ASYNC_THREADS) {
+        /* Messages from each thread arrive in order, even if some were dropped */
+        if (index < state->next[thread]) {
+            ++state->errors;
+        }
+        /* Queued messages are written on the log thread */
+        if (SDL_GetCurrentThreadID() == state->caller) {
+            ++state->errors;
+        }
+        state->next[thread] = index + 1;
+        ++state->count;
+    } else if (SDL_strlen(message) == 1000 && message[999] == 'x') {
+        ++state->long_messages;
+    } else {
+        ++state->errors;
+    }
+    if (state->delay_ns) {
+        SDL_DelayNS(state->delay_ns);
+    }
+}
+
+static int SDLCALL AsyncLogThread(void *data)
+{
+    const int thread = (int)(intptr_t)data;
+    int i;
+
+    for (i = 0; i < NUM_ASYNC_MESSAGES; ++i) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "thread %d message %d", thread, i);
+    }
+    return 0;
+}
+
+static void RunAsyncLogThreads(void)
+{
+    SDL_Thread *threads[NUM_ASYNC_THREADS];
+    int i;
+
+    for (i = 0; i < NUM_ASYNC_THREADS; ++i) {
+        threads[i] = SDL_CreateThread(AsyncLogThread, "AsyncLog", (void *)(intptr_t)i);
+    }
+    for (i = 0; i < NUM_ASYNC_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+}
+
+/**
+ * Check SDL_HINT_LOG_ASYNC functionality
+ */
+static int SDLCALL log_testAsync(void *arg)
+{
+    AsyncLogState state;
+    char long_message[1002];
+
+    SDL_zero(state);
+    state.caller = SDL_GetCurrentThreadID();
+    SDL_memset(long_message, 'x', 1000);
+    long_message[1000] = '\n';
+    long_message[1001] = '\0';
+
+    SDL_SetHint(SDL_HINT_LOGGING, NULL);
+    SDL_GetLogOutputFunction(&original_function, &original_userdata);
+    SDL_SetLogOutputFunction(AsyncLogOutput, &state);
+
+    SDL_SetHint(SDL_HINT_LOG_ASYNC_OVERFLOW, "block");
+    SDL_SetHint(SDL_HINT_LOG_ASYNC, "1");
+    SDLTest_AssertPass("SDL_SetHint(SDL_HINT_LOG_ASYNC, \"1\")");
+    {
+        RunAsyncLogThreads();
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", long_message);
+        SDL_FlushLogMessages();
+        SDLTest_AssertPass("SDL_FlushLogMessages()");
+        SDLTest_AssertCheck(state.count == NUM_ASYNC_THREADS * NUM_ASYNC_MESSAGES, "Check message count, expected: %d, got: %d", NUM_ASYNC_THREADS * NUM_ASYNC_MESSAGES, state.count);
+        SDLTest_AssertCheck(state.dropped == 0, "Check dropped messages, expected: 0, got: %d", state.dropped);
+        SDLTest_AssertCheck(state.long_messages == 1, "Check long message count, expected: 1, got: %d", state.long_messages);
+        SDLTest_AssertCheck(state.errors == 0, "Check message errors, expected: 0, got: %d", state.errors);
+    }
+
+    SDL_zeroa(state.next);
+    state.count = 0;
+    state.delay_ns = 20000;
+    SDL_SetHint(SDL_HINT_LOG_ASYNC_OVERFLOW, "drop");
+    SDLTest_AssertPass("SDL_SetHint(SDL_HINT_LOG_ASYNC_OVERFLOW, \"drop\")");
+    {
+        RunAsyncLogThreads();
+        SDL_FlushLogMessages();
+        SDLTest_AssertPass("SDL_FlushLogMessages()");
+        SDLTest_AssertCheck(state.count + state.dropped == NUM_ASYNC_THREADS * NUM_ASYNC_MESSAGES, "Check written and dropped messages, expected: %d, got: %d + %d", NUM_ASYNC_THREADS * NUM_ASYNC_MESSAGES, state.count, state.dropped);
+        SDLTest_AssertCheck(state.dropped > 0, "Check dropped messages, expected: > 0, got: %d", state.dropped);
+        SDLTest_AssertCheck(state.errors == 0, "Check message errors, expected: 0, got: %d", state.errors);
+    }
+
+    SDL_SetHint(SDL_HINT_LOG_ASYNC, "0");
+    SDL_SetHint(SDL_HINT_LOG_ASYNC_OVERFLOW, NULL);
+    SDLTest_AssertPass("SDL_SetHint(SDL_HINT_LOG_ASYNC, \"0\")");
+    {
+        state.caller = 0;
+        state.count = 0;
+        state.delay_ns = 0;
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "thread 0 message %d", NUM_ASYNC_MESSAGES);
+        SDLTest_AssertCheck(state.count == 1, "Check synchronous message count, expected: 1, got: %d", state.count);
+    }
+
+    SDL_SetLogOutputFunction(original_function, original_userdata);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Log test cases */
@@ -195,9 +328,13 @@ static const SDLTest_TestCaseReference logTestHint = {
     log_testHint, "log_testHint", "Check SDL_HINT_LOGGING functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference logTestAsync = {
+    log_testAsync, "log_testAsync", "Check SDL_HINT_LOG_ASYNC functionality", TEST_ENABLED
+};
+
 /* Sequence of Log test cases */
 static const SDLTest_TestCaseReference *logTests[] = {
-    &logTestHint, NULL
+    &logTestHint, &logTestAsync, NULL
 };
 
 /* Timer test suite (global) */
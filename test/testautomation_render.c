@@ -1323,6 +1323,328 @@ static int SDLCALL render_testRGBSurfaceNoAlpha(void* arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that debug text drawn in pieces matches the same text drawn in one call
+ */
+static int SDLCALL render_testDebugText(void *arg)
+{
+    const SDL_Rect rect = { 0, 0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H };
+    SDL_Surface *surface;
+    SDL_Surface *referenceSurface;
+    int x, y, lit = 0, wrong = 0;
+
+    /* Draw the text a line at a time, with a color change in between */
+    clearScreen();
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 2.0f, "Hello!"))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 12.0f, "SDL 3"))
+    CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 255, 0, 0, SDL_ALPHA_OPAQUE))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 22.0f, "Red"))
+
+    surface = SDL_RenderReadPixels(renderer, &rect);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got %p", (void *)surface);
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    referenceSurface = SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT);
+    SDL_DestroySurface(surface);
+    SDLTest_AssertCheck(referenceSurface != NULL, "Validate result from SDL_ConvertSurface, got %p", (void *)referenceSurface);
+    if (!referenceSurface) {
+        return TEST_ABORTED;
+    }
+
+    /* The red line only has red glyph pixels on a clear background */
+    for (y = 22; y < 30; ++y) {
+        const Uint32 *row = (const Uint32 *)((const Uint8 *)referenceSurface->pixels + y * referenceSurface->pitch);
+        for (x = 0; x < TESTRENDER_SCREEN_W; ++x) {
+            if (row[x] == 0xFFFF0000) {
+                ++lit;
+            } else if (row[x] != RENDER_COLOR_CLEAR) {
+                ++wrong;
+            }
+        }
+    }
+    SDLTest_AssertCheck(lit > 0 && wrong == 0, "Verify red text pixels, expected some red and no other colors, got %d red, %d other", lit, wrong);
+
+    /* The same text split across more calls, with a viewport change in the middle, must look the same */
+    clearScreen();
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 2.0f, "Hel"))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 26.0f, 2.0f, "lo!"))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 12.0f, "S"))
+    CHECK_FUNC(SDL_SetRenderViewport, (renderer, &rect))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 10.0f, 12.0f, "DL 3"))
+    CHECK_FUNC(SDL_SetRenderViewport, (renderer, NULL))
+    CHECK_FUNC(SDL_SetRenderDrawColor, (renderer, 255, 0, 0, SDL_ALPHA_OPAQUE))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 2.0f, 22.0f, "R"))
+    CHECK_FUNC(SDL_RenderDebugText, (renderer, 10.0f, 22.0f, "ed"))
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+
+    SDL_RenderPresent(renderer);
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests blended fills and lines on 8888 surfaces with the software renderer
+ */
+static Uint8 blendReferenceChannel(SDL_BlendMode mode, Uint8 dst, Uint8 src, Uint8 src_a, bool alpha)
+{
+    const unsigned inva = 255 - src_a;
+    unsigned value;
+
+    if (mode == SDL_BLENDMODE_BLEND || mode == SDL_BLENDMODE_ADD) {
+        src = (Uint8)((unsigned)src * src_a / 255);
+    }
+    switch (mode) {
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        value = dst * inva / 255 + (alpha ? src_a : src);
+        break;
+    case SDL_BLENDMODE_ADD:
+    case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+        value = alpha ? dst : dst + src;
+        break;
+    case SDL_BLENDMODE_MOD:
+        value = alpha ? dst : dst * src / 255;
+        break;
+    case SDL_BLENDMODE_MUL:
+        value = alpha ? dst : dst * src / 255 + dst * inva / 255;
+        break;
+    default:
+        value = alpha ? src_a : src;
+        break;
+    }
+    return (Uint8)SDL_min(value, 255);
+}
+
+static int SDLCALL render_testBlendFill8888(void *arg)
+{
+    const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888
+    };
+    const SDL_BlendMode modes[] = {
+        SDL_BLENDMODE_BLEND, SDL_BLENDMODE_BLEND_PREMULTIPLIED, SDL_BLENDMODE_ADD,
+        SDL_BLENDMODE_ADD_PREMULTIPLIED, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    const SDL_FRect rect = { 3.0f, 2.0f, 37.0f, 5.0f };
+    const Uint8 color[4] = { 0x40, 0x99, 0xf0, 0x7b };
+    int f, m, x, y;
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        for (m = 0; m < SDL_arraysize(modes); ++m) {
+            SDL_Surface *surface = SDL_CreateSurface(43, 12, formats[f]);
+            SDL_Surface *expected;
+            SDL_Renderer *software_renderer;
+            const SDL_PixelFormatDetails *details;
+            int errors = 0;
+
+            SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateSurface(%s) succeeded", SDL_GetPixelFormatName(formats[f]));
+            if (!surface) {
+                return TEST_ABORTED;
+            }
+            details = SDL_GetPixelFormatDetails(surface->format);
+            for (y = 0; y < surface->h; ++y) {
+                for (x = 0; x < surface->w; ++x) {
+                    SDL_WriteSurfacePixel(surface, x, y, (Uint8)(x * 37 + y), (Uint8)(x * 11 + y * 29), (Uint8)(255 - x * 5), (Uint8)(y * 21));
+                }
+            }
+            expected = SDL_DuplicateSurface(surface);
+            SDLTest_AssertCheck(expected != NULL, "Verify SDL_DuplicateSurface() succeeded");
+            if (!expected) {
+                SDL_DestroySurface(surface);
+                return TEST_ABORTED;
+            }
+
+            software_renderer = SDL_CreateSoftwareRenderer(surface);
+            SDLTest_AssertCheck(software_renderer != NULL, "Verify SDL_CreateSoftwareRenderer() succeeded");
+            if (!software_renderer) {
+                SDL_DestroySurface(expected);
+                SDL_DestroySurface(surface);
+                return TEST_ABORTED;
+            }
+            CHECK_FUNC(SDL_SetRenderDrawBlendMode, (software_renderer, modes[m]))
+            CHECK_FUNC(SDL_SetRenderDrawColor, (software_renderer, color[0], color[1], color[2], color[3]))
+            CHECK_FUNC(SDL_RenderFillRect, (software_renderer, &rect))
+            CHECK_FUNC(SDL_RenderLine, (software_renderer, 41.0f, 9.0f, 1.0f, 9.0f))
+            SDL_RenderPresent(software_renderer);
+
+            for (y = 0; y < surface->h; ++y) {
+                for (x = 0; x < surface->w; ++x) {
+                    const bool in_rect = (x >= 3 && x < 40 && y >= 2 && y < 7);
+                    const bool on_line = (y == 9 && x >= 1 && x <= 41);
+                    Uint8 dr, dg, db, da, r, g, b, a;
+
+                    SDL_ReadSurfacePixel(expected, x, y, &dr, &dg, &db, &da);
+                    if (in_rect || on_line) {
+                        dr = blendReferenceChannel(modes[m], dr, color[0], color[3], false);
+                        dg = blendReferenceChannel(modes[m], dg, color[1], color[3], false);
+                        db = blendReferenceChannel(modes[m], db, color[2], color[3], false);
+                        if (details->Amask) {
+                            da = blendReferenceChannel(modes[m], da, color[2], color[3], true);
+                        }
+                    }
+                    SDL_ReadSurfacePixel(surface, x, y, &r, &g, &b, &a);
+                    if (r != dr || g != dg || b != db || a != da) {
+                        if (errors++ == 0) {
+                            SDLTest_LogError("%s, blend mode 0x%x: pixel at (%d, %d) is {%d,%d,%d,%d}, expected {%d,%d,%d,%d}",
+                                             SDL_GetPixelFormatName(formats[f]), modes[m], x, y, r, g, b, a, dr, dg, db, da);
+                        }
+                    }
+                }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify %s blend mode 0x%x, expected 0 mismatches, got %d", SDL_GetPixelFormatName(formats[f]), modes[m], errors);
+
+            SDL_DestroyRenderer(software_renderer);
+            SDL_DestroySurface(expected);
+            SDL_DestroySurface(surface);
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests rotated, cropped and scaled copies of 8888 and 565 textures with the software renderer
+ */
+static SDL_Surface *renderRotatedTexture(SDL_PixelFormat target_format, SDL_PixelFormat texture_format, SDL_ScaleMode mode, SDL_FlipMode flip, bool solid)
+{
+    const SDL_FRect srcrect = { 3.0f, 2.0f, 15.0f, 11.0f };
+    const SDL_FRect dstrect = { 9.0f, 7.0f, 45.0f, 33.0f };
+    SDL_Surface *target = SDL_CreateSurface(64, 48, target_format);
+    SDL_Surface *source = SDL_CreateSurface(20, 14, texture_format);
+    SDL_Surface *result = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *texture = NULL;
+    int x, y;
+
+    if (!target || !source) {
+        goto done;
+    }
+    for (y = 0; y < source->h; ++y) {
+        for (x = 0; x < source->w; ++x) {
+            if (solid) {
+                SDL_WriteSurfacePixel(source, x, y, 0xff, 0x80, 0x00, SDL_ALPHA_OPAQUE);
+            } else {
+                /* Only full intensity channels, so that 565 and 8888 pixels have the same colors */
+                SDL_WriteSurfacePixel(source, x, y, (x & 1) ? 0xff : 0, (y & 1) ? 0xff : 0, ((x + y) & 2) ? 0xff : 0, SDL_ALPHA_OPAQUE);
+            }
+        }
+    }
+    software_renderer = SDL_CreateSoftwareRenderer(target);
+    if (!software_renderer) {
+        goto done;
+    }
+    texture = SDL_CreateTextureFromSurface(software_renderer, source);
+    if (!texture || SDL_GetTextureSize(texture, NULL, NULL) == false) {
+        goto done;
+    }
+    SDL_SetTextureScaleMode(texture, mode);
+    SDL_SetRenderDrawColor(software_renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+    if (SDL_RenderTextureRotated(software_renderer, texture, &srcrect, &dstrect, 33.0, NULL, flip)) {
+        SDL_RenderPresent(software_renderer);
+        result = SDL_ConvertSurface(target, RENDER_COMPARE_FORMAT);
+    }
+
+done:
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(source);
+    SDL_DestroySurface(target);
+    return result;
+}
+
+static int countDifferentPixels(SDL_Surface *a, SDL_Surface *b, int tolerance)
+{
+    int x, y, shift, count = 0;
+
+    for (y = 0; y < a->h; ++y) {
+        const Uint32 *row_a = (const Uint32 *)((const Uint8 *)a->pixels + y * a->pitch);
+        const Uint32 *row_b = (const Uint32 *)((const Uint8 *)b->pixels + y * b->pitch);
+        for (x = 0; x < a->w; ++x) {
+            for (shift = 0; shift < 32; shift += 8) {
+                if (SDL_abs((int)((row_a[x] >> shift) & 0xff) - (int)((row_b[x] >> shift) & 0xff)) > tolerance) {
+                    ++count;
+                    break;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+static int SDLCALL render_testRotatedFormats(void *arg)
+{
+    const SDL_FlipMode flips[] = { SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL, SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL };
+    SDL_Surface *reference, *surface;
+    Uint8 r, g, b, a;
+    int f, x, y, errors;
+
+    for (f = 0; f < SDL_arraysize(flips); ++f) {
+        /* Nearest sampling must pick the same pixels from 8888 and 565 textures */
+        reference = renderRotatedTexture(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_SCALEMODE_NEAREST, flips[f], false);
+        SDLTest_AssertCheck(reference != NULL, "Verify rotated ARGB8888 texture, flip %d", flips[f]);
+        if (!reference) {
+            return TEST_ABORTED;
+        }
+        if (flips[f] == SDL_FLIP_NONE) {
+            /* The center of the destination rectangle shows the center of the source rectangle */
+            SDL_ReadSurfacePixel(reference, 31, 23, &r, &g, &b, &a);
+            SDLTest_AssertCheck(r == 0 && g == 0xff && b == 0, "Verify center pixel is {0,255,0}, got {%d,%d,%d}", r, g, b);
+        }
+
+        surface = renderRotatedTexture(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_SCALEMODE_NEAREST, flips[f], false);
+        SDLTest_AssertCheck(surface != NULL, "Verify rotated XRGB8888 texture, flip %d", flips[f]);
+        if (surface) {
+            errors = countDifferentPixels(reference, surface, 0);
+            SDLTest_AssertCheck(errors == 0, "Verify XRGB8888 matches ARGB8888, expected 0 mismatches, got %d", errors);
+            SDL_DestroySurface(surface);
+        }
+
+        surface = renderRotatedTexture(SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_SCALEMODE_NEAREST, flips[f], false);
+        SDLTest_AssertCheck(surface != NULL, "Verify rotated RGB565 texture, flip %d", flips[f]);
+        if (surface) {
+            /* Blending onto the RGB565 target is a little less precise */
+            errors = countDifferentPixels(reference, surface, 8);
+            SDLTest_AssertCheck(errors == 0, "Verify RGB565 matches ARGB8888, expected 0 mismatches, got %d", errors);
+            SDL_DestroySurface(surface);
+        }
+        SDL_DestroySurface(reference);
+
+        /* Linear sampling gives the same results for 8888 textures with and without alpha */
+        reference = renderRotatedTexture(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_SCALEMODE_LINEAR, flips[f], false);
+        surface = renderRotatedTexture(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_SCALEMODE_LINEAR, flips[f], false);
+        SDLTest_AssertCheck(reference != NULL && surface != NULL, "Verify rotated 8888 textures with linear sampling, flip %d", flips[f]);
+        if (reference && surface) {
+            errors = countDifferentPixels(reference, surface, 0);
+            SDLTest_AssertCheck(errors == 0, "Verify XRGB8888 matches ARGB8888, expected 0 mismatches, got %d", errors);
+        }
+        SDL_DestroySurface(surface);
+        SDL_DestroySurface(reference);
+    }
+
+    /* Linear sampling of a solid color keeps the color inside and fades it into the background at the edges */
+    surface = renderRotatedTexture(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_SCALEMODE_LINEAR, SDL_FLIP_NONE, true);
+    SDLTest_AssertCheck(surface != NULL, "Verify rotated solid texture");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    errors = 0;
+    for (y = 0; y < surface->h; ++y) {
+        for (x = 0; x < surface->w; ++x) {
+            SDL_ReadSurfacePixel(surface, x, y, &r, &g, &b, &a);
+            if (b != 0 || g > r) {
+                ++errors;
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify faded solid color, expected 0 mismatches, got %d", errors);
+    SDL_ReadSurfacePixel(surface, 31, 23, &r, &g, &b, &a);
+    SDLTest_AssertCheck(r == 0xff && g == 0x80 && b == 0, "Verify center pixel is {255,128,0}, got {%d,%d,%d}", r, g, b);
+    SDL_DestroySurface(surface);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Test clip rect
  */
@@ -1984,6 +2306,61 @@ static int SDLCALL render_testTextureState(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests the render memory statistics published by SDL_RenderPresent()
+ *
+ * \sa SDL_GetRendererProperties
+ * \sa SDL_RenderPresent
+ */
+static int SDLCALL render_testMemoryStats(void *arg)
+{
+    const int NUM_RECTS = 1000;
+    SDL_PropertiesID props;
+    SDL_FRect rect;
+    Sint64 commands, vertex_bytes, chunks, allocated;
+    int i;
+
+    props = SDL_GetRendererProperties(renderer);
+    SDLTest_AssertCheck(props != 0, "Verify SDL_GetRendererProperties() result");
+
+    /* Queue each rect with a different color so they can't be merged into a single command */
+    rect.w = 1.0f;
+    rect.h = 1.0f;
+    for (i = 0; i < NUM_RECTS; ++i) {
+        rect.x = (float)(i % TESTRENDER_SCREEN_W);
+        rect.y = (float)((i / TESTRENDER_SCREEN_W) % TESTRENDER_SCREEN_H);
+        SDL_SetRenderDrawColor(renderer, (Uint8)i, (Uint8)(i >> 8), 0, SDL_ALPHA_OPAQUE);
+        CHECK_FUNC(SDL_RenderFillRect, (renderer, &rect))
+    }
+    CHECK_FUNC(SDL_RenderPresent, (renderer))
+
+    commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COMMANDS_NUMBER, -1);
+    vertex_bytes = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER, -1);
+    chunks = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER, -1);
+    allocated = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BYTES_ALLOCATED_NUMBER, -1);
+    SDLTest_AssertCheck(commands >= NUM_RECTS, "Verify frame commands, expected >= %d, got %" SDL_PRIs64, NUM_RECTS, commands);
+    SDLTest_AssertCheck(vertex_bytes > 0, "Verify frame vertex bytes, expected > 0, got %" SDL_PRIs64, vertex_bytes);
+    SDLTest_AssertCheck(chunks > 1, "Verify command chunks, expected > 1, got %" SDL_PRIs64, chunks);
+    SDLTest_AssertCheck(allocated >= vertex_bytes, "Verify vertex allocation, expected >= %" SDL_PRIs64 ", got %" SDL_PRIs64, vertex_bytes, allocated);
+
+    /* An empty frame doesn't queue anything, and memory is retained until the usage window expires */
+    CHECK_FUNC(SDL_RenderPresent, (renderer))
+    commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COMMANDS_NUMBER, -1);
+    vertex_bytes = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER, -1);
+    SDLTest_AssertCheck(commands == 0, "Verify frame commands, expected 0, got %" SDL_PRIs64, commands);
+    SDLTest_AssertCheck(vertex_bytes == 0, "Verify frame vertex bytes, expected 0, got %" SDL_PRIs64, vertex_bytes);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER, -1) == chunks, "Verify command chunks are retained");
+
+    /* After enough idle frames, the spike is released */
+    for (i = 0; i < 250; ++i) {
+        CHECK_FUNC(SDL_RenderPresent, (renderer))
+    }
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_COMMAND_CHUNKS_NUMBER, -1) == 1, "Verify command chunks were trimmed to 1");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BYTES_ALLOCATED_NUMBER, -1) < allocated, "Verify vertex allocation was trimmed");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2023,6 +2400,18 @@ static const SDLTest_TestCaseReference renderTestBlendModes = {
     render_testBlendModes, "render_testBlendModes", "Tests rendering blend modes", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestDebugText = {
+    render_testDebugText, "render_testDebugText", "Tests debug text drawn in one or more calls", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestBlendFill8888 = {
+    render_testBlendFill8888, "render_testBlendFill8888", "Tests blended fills and lines on 8888 surfaces using software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestRotatedFormats = {
+    render_testRotatedFormats, "render_testRotatedFormats", "Tests rotated copies of 8888 and 565 textures using software renderer", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestViewport = {
     render_testViewport, "render_testViewport", "Tests viewport", TEST_ENABLED
 };
@@ -2051,6 +2440,10 @@ static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
     render_testRGBSurfaceNoAlpha, "render_testRGBSurfaceNoAlpha", "Tests RGB surface with no alpha using software renderer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestMemoryStats = {
+    render_testMemoryStats, "render_testMemoryStats", "Tests render memory statistics", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestGetNumRenderDrivers,
@@ -2069,6 +2462,10 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestBlendFill8888,
+    &renderTestRotatedFormats,
+    &renderTestDebugText,
+    &renderTestMemoryStats,
     NULL
 };
 
@@ -310,6 +310,46 @@ static int SDLCALL stdlib_snprintf(void *arg)
         }
     }
 
+    {
+        static struct
+        {
+            const char *format;
+            double value;
+            const char *expected;
+        } e_and_g_test_cases[] = {
+            { "%e", 1.5, "1.500000e+00" },
+            { "%E", -1.5e-10, "-1.500000E-10" },
+            { "%.3e", 123456.0, "1.235e+05" },
+            { "%.0e", 2.5, "2e+00" },
+            { "%#.0e", 3.5, "4.e+00" },
+            { "%g", 1e-5, "1e-05" },
+            { "%g", 0.0001, "0.0001" },
+            { "%.3g", 1234567.0, "1.23e+06" },
+            { "%G", 1e100, "1E+100" },
+            { "%#g", 1.0, "1.00000" },
+            { "%.20f", 0.1, "0.10000000000000000555" },
+            { "%.0f", 0.5, "0" },
+            { "%.0f", 1.5, "2" },
+            { "%.17g", 1.0 / 3.0, "0.33333333333333331" },
+            { "%010.2e", -1.0, "-01.00e+00" },
+            { "%f", 1e22, "10000000000000000000000.000000" },
+        };
+        int i;
+
+        for (i = 0; i < SDL_arraysize(e_and_g_test_cases); ++i) {
+            const char *format = e_and_g_test_cases[i].format;
+            double value = e_and_g_test_cases[i].value;
+
+            result = SDL_snprintf(text, sizeof(text), format, value);
+            predicted = SDL_snprintf(NULL, 0, format, value);
+            expected = e_and_g_test_cases[i].expected;
+            SDLTest_AssertPass("Call to SDL_snprintf(\"%s\", %g)", format, value);
+            SDLTest_AssertCheck(SDL_strcmp(text, expected) == 0, "Check text, expected: '%s', got: '%s'", expected, text);
+            SDLTest_AssertCheck(result == SDL_strlen(expected), "Check result value, expected: %d, got: %d", (int)SDL_strlen(expected), result);
+            SDLTest_AssertCheck(predicted == result, "Check predicted value, expected: %d, got: %d", result, predicted);
+        }
+    }
+
     size = 64;
     result = SDL_snprintf(text, sizeof(text), "%zu %s", size, "test");
     expected = "64 test";
@@ -1121,6 +1161,139 @@ static void format_for_description(char *buffer, size_t buflen, const char *text
     }
 }
 
+/* Pieces of text the UTF-8 tests are built from, including invalid and truncated sequences */
+static const char *utf8_fragments[] = {
+    "hello world, this is plain ASCII text ",
+    "a",
+    "\xc3\xa9",                 /* U+00E9 */
+    "\xe2\x82\xac",             /* U+20AC */
+    "\xf0\x9f\x92\xbb",         /* U+1F4BB */
+    "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e",
+    "\xf0\xa0\x80\x80",         /* U+20000 */
+    "\x80",                     /* stray continuation byte */
+    "\xc0\x80",                 /* overlong */
+    "\xed\xa0\x80",             /* surrogate */
+    "\xf4\x90\x80\x80",         /* beyond U+10FFFF */
+    "\xf8\x88\x80\x80\x80",     /* five byte sequence */
+    "\xe2\x82",                 /* truncated */
+    "\xff",
+};
+
+static size_t utf8_make_string(char *buffer, size_t buflen, bool valid_only)
+{
+    size_t len = 0;
+
+    for (;;) {
+        const int count = valid_only ? 7 : (int)SDL_arraysize(utf8_fragments);
+        const char *fragment = utf8_fragments[SDLTest_RandomIntegerInRange(0, count - 1)];
+        const size_t fragment_len = SDL_strlen(fragment);
+        if (len + fragment_len >= buflen) {
+            break;
+        }
+        SDL_memcpy(buffer + len, fragment, fragment_len);
+        len += fragment_len;
+    }
+    buffer[len] = '\0';
+    return len;
+}
+
+static size_t utf8_count_codepoints(const char *str, size_t bytes)
+{
+    size_t result = 0;
+    while (SDL_StepUTF8(&str, &bytes)) {
+        result++;
+    }
+    return result;
+}
+
+static int SDLCALL
+stdlib_utf8strlen(void *arg)
+{
+    char buffer[512];
+    int i;
+
+    SDLTest_AssertCheck(SDL_utf8strlen("") == 0, "Check SDL_utf8strlen(\"\") == 0");
+    SDLTest_AssertCheck(SDL_utf8strlen("\xe2\x82\xac\xe2\x82") == 3, "Check SDL_utf8strlen() with a truncated sequence");
+    SDLTest_AssertCheck(SDL_utf8strnlen("abc\0def", 7) == 3, "Check SDL_utf8strnlen() stops at a null terminator");
+
+    /* U+20000 through U+2FFFF have the 0x20 bit set in the second byte */
+    {
+        const char *str = "\xf0\xa0\x80\x80";
+        const Uint32 codepoint = SDL_StepUTF8(&str, NULL);
+        SDLTest_AssertCheck(codepoint == 0x20000, "Check SDL_StepUTF8() decodes U+20000, got U+%" SDL_PRIx32, codepoint);
+    }
+    SDLTest_AssertCheck(SDL_utf8strlen("\xf0\xa0\x80\x80") == 1, "Check SDL_utf8strlen() of U+20000 in a short string");
+    SDLTest_AssertCheck(SDL_utf8strlen("0123456789abcdef\xf0\xa0\x80\x80" "0123456789abcdef") == 33, "Check SDL_utf8strlen() of U+20000 in a long string");
+    SDLTest_AssertCheck(SDL_utf8strnlen("\xf0\xaf\xbf\xbf" "0123456789abcdef0123456789abcdef", 36) == 33, "Check SDL_utf8strnlen() of U+2FFFF in a long string");
+
+    for (i = 0; i < 200; ++i) {
+        const size_t buflen = (size_t)SDLTest_RandomIntegerInRange(2, (int)sizeof(buffer));
+        const size_t len = utf8_make_string(buffer, buflen, (i % 2) == 0);
+        const size_t bytes = (size_t)SDLTest_RandomIntegerInRange(0, (int)len);
+        size_t expected, result;
+
+        expected = utf8_count_codepoints(buffer, len);
+        result = SDL_utf8strlen(buffer);
+        SDLTest_AssertCheck(result == expected, "Check SDL_utf8strlen() of %d bytes, expected %d, got %d", (int)len, (int)expected, (int)result);
+
+        expected = utf8_count_codepoints(buffer, bytes);
+        result = SDL_utf8strnlen(buffer, bytes);
+        SDLTest_AssertCheck(result == expected, "Check SDL_utf8strnlen() of %d bytes, expected %d, got %d", (int)bytes, (int)expected, (int)result);
+    }
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL
+stdlib_iconv_unicode(void *arg)
+{
+    char buffer[512];
+    int i;
+
+    for (i = 0; i < 50; ++i) {
+        const size_t len = utf8_make_string(buffer, (size_t)SDLTest_RandomIntegerInRange(2, (int)sizeof(buffer)), true);
+        size_t num_codepoints = 0, num_utf16_units = 0;
+        const char *str = buffer;
+        Uint32 codepoint;
+        char *utf16, *utf32, *restored;
+        bool match = true;
+
+        while ((codepoint = SDL_StepUTF8(&str, NULL)) != 0) {
+            ++num_codepoints;
+            num_utf16_units += (codepoint >= 0x10000) ? 2 : 1;
+        }
+
+        utf32 = SDL_iconv_string("UTF-32LE", "UTF-8", buffer, len + 1);
+        SDLTest_AssertCheck(utf32 != NULL, "Check SDL_iconv_string() from UTF-8 to UTF-32LE");
+        if (utf32) {
+            const Uint8 *unit = (const Uint8 *)utf32;
+            str = buffer;
+            while ((codepoint = SDL_StepUTF8(&str, NULL)) != 0) {
+                if (codepoint != ((Uint32)unit[0] | ((Uint32)unit[1] << 8) | ((Uint32)unit[2] << 16) | ((Uint32)unit[3] << 24))) {
+                    match = false;
+                    break;
+                }
+                unit += 4;
+            }
+            SDLTest_AssertCheck(match, "Check UTF-32LE codepoints match the UTF-8 input");
+
+            restored = SDL_iconv_string("UTF-8", "UTF-32LE", utf32, (num_codepoints + 1) * 4);
+            SDLTest_AssertCheck(restored && SDL_strcmp(restored, buffer) == 0, "Check SDL_iconv_string() from UTF-32LE back to UTF-8");
+            SDL_free(restored);
+            SDL_free(utf32);
+        }
+
+        utf16 = SDL_iconv_string("UTF-16LE", "UTF-8", buffer, len + 1);
+        SDLTest_AssertCheck(utf16 != NULL, "Check SDL_iconv_string() from UTF-8 to UTF-16LE");
+        if (utf16) {
+            restored = SDL_iconv_string("UTF-8", "UTF-16LE", utf16, (num_utf16_units + 1) * 2);
+            SDLTest_AssertCheck(restored && SDL_strcmp(restored, buffer) == 0, "Check SDL_iconv_string() from UTF-16LE back to UTF-8");
+            SDL_free(restored);
+            SDL_free(utf16);
+        }
+    }
+    return TEST_COMPLETED;
+}
+
 static int SDLCALL
 stdlib_iconv(void *arg)
 {
@@ -1427,6 +1600,14 @@ static int SDLCALL stdlib_strtod(void *arg)
     STRTOD_TEST_CASE("\t  123.75abcxyz", 123.75, 9); // skip leading space
     STRTOD_TEST_CASE("+999.555", 999.555, 8);
     STRTOD_TEST_CASE("-999.555", -999.555, 8);
+    STRTOD_TEST_CASE("1e3", 1000.0, 3);
+    STRTOD_TEST_CASE("-2.5E-3x", -2.5e-3, 7);
+    STRTOD_TEST_CASE("1e", 1.0, 1); // exponent without digits is not consumed
+    STRTOD_TEST_CASE("0.1", 0.1, 3);
+    STRTOD_TEST_CASE("9007199254740993", 9007199254740992.0, 16); // round half to even
+    STRTOD_TEST_CASE("2.2250738585072014e-308", 2.2250738585072014e-308, 23);
+    STRTOD_TEST_CASE("4.9406564584124654e-324", 4.9406564584124654e-324, 23);
+    STRTOD_TEST_CASE("1.7976931348623157e308", 1.7976931348623157e308, 22);
 
 #undef STRTOD_TEST_CASE
 
@@ -1476,6 +1657,14 @@ static const SDLTest_TestCaseReference stdlibTest_iconv = {
     stdlib_iconv, "stdlib_iconv", "Calls to SDL_iconv", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_utf8strlen = {
+    stdlib_utf8strlen, "stdlib_utf8strlen", "Calls to SDL_utf8strlen and SDL_utf8strnlen", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_iconv_unicode = {
+    stdlib_iconv_unicode, "stdlib_iconv_unicode", "Calls to SDL_iconv_string between UTF-8, UTF-16 and UTF-32", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTest_strpbrk = {
     stdlib_strpbrk, "stdlib_strpbrk", "Calls to SDL_strpbrk", TEST_ENABLED
 };
@@ -1504,6 +1693,8 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_aligned_alloc,
     &stdlibTestOverflow,
     &stdlibTest_iconv,
+    &stdlibTest_utf8strlen,
+    &stdlibTest_iconv_unicode,
     &stdlibTest_strpbrk,
     &stdlibTest_wcstol,
     &stdlibTest_strtox,
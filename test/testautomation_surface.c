@@ -1586,6 +1586,131 @@ static int SDLCALL surface_testScale(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Fill a sprite with transparent borders and holes, leaving the transparent pixels all zero */
+static void FillRLESprite(SDL_Surface *surface, Uint32 colorkey)
+{
+    int x, y;
+
+    SDL_LockSurface(surface);
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            if (x < y / 2 || x >= surface->w - y / 3 || ((x / 5 + y / 3) % 4) == 0) {
+                row[x] = colorkey;
+            } else {
+                Uint8 a = (Uint8)((x * 37 + y * 11) % 3 == 0 ? 255 : 32 + (x * 7 + y * 13) % 200);
+                row[x] = SDL_MapSurfaceRGBA(surface, (Uint8)(x * 9), (Uint8)(y * 5), (Uint8)((x ^ y) * 3), a);
+            }
+        }
+    }
+    SDL_UnlockSurface(surface);
+}
+
+static int SDLCALL surface_testBlitRLE(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_PixelFormat dst_format;
+        bool colorkey;
+        SDL_BlendMode blend;
+        bool colormod;
+        bool alphamod;
+    } cases[] = {
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, true, SDL_BLENDMODE_NONE, true, false },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, true, SDL_BLENDMODE_ADD, true, true },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, true, SDL_BLENDMODE_NONE, false, false },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, true, SDL_BLENDMODE_MOD, false, false },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, false, SDL_BLENDMODE_BLEND, true, false },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, false, SDL_BLENDMODE_BLEND, false, true },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, false, SDL_BLENDMODE_BLEND, false, false },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, false, SDL_BLENDMODE_ADD, true, true },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, false, SDL_BLENDMODE_BLEND_PREMULTIPLIED, true, false },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, false, SDL_BLENDMODE_ADD_PREMULTIPLIED, false, true },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, true, SDL_BLENDMODE_MUL, true, false },
+    };
+    const SDL_Rect srcrect = { 3, 2, 40, 30 };
+    const SDL_Rect dstrects[] = { { 5, 4, 0, 0 }, { -7, -3, 0, 0 }, { 30, 20, 0, 0 } };
+    const int w = 48, h = 36;
+    int i, j, pass;
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        SDL_Surface *plain, *rle, *dst_plain, *dst_rle;
+        Uint32 colorkey;
+
+        plain = SDL_CreateSurface(w, h, cases[i].src_format);
+        SDLTest_AssertCheck(plain != NULL, "Verify source surface is not NULL");
+        dst_plain = SDL_CreateSurface(w, h, cases[i].dst_format);
+        dst_rle = SDL_CreateSurface(w, h, cases[i].dst_format);
+        SDLTest_AssertCheck(dst_plain != NULL && dst_rle != NULL, "Verify destination surfaces are not NULL");
+        if (!plain || !dst_plain || !dst_rle) {
+            SDL_DestroySurface(plain);
+            SDL_DestroySurface(dst_plain);
+            SDL_DestroySurface(dst_rle);
+            return TEST_ABORTED;
+        }
+        colorkey = cases[i].colorkey ? SDL_MapSurfaceRGB(plain, 255, 0, 255) : 0;
+        FillRLESprite(plain, colorkey);
+        rle = SDL_DuplicateSurface(plain);
+        SDLTest_AssertCheck(rle != NULL, "Verify duplicate surface is not NULL");
+        if (!rle) {
+            SDL_DestroySurface(plain);
+            SDL_DestroySurface(dst_plain);
+            SDL_DestroySurface(dst_rle);
+            return TEST_ABORTED;
+        }
+        CHECK_FUNC(SDL_SetSurfaceRLE, (rle, true));
+
+        for (pass = 0; pass < 2; ++pass) {
+            SDL_Surface *surfaces[2];
+            surfaces[0] = plain;
+            surfaces[1] = rle;
+            for (j = 0; j < 2; ++j) {
+                SDL_Surface *surface = surfaces[j];
+                if (cases[i].colorkey) {
+                    CHECK_FUNC(SDL_SetSurfaceColorKey, (surface, true, colorkey));
+                }
+                CHECK_FUNC(SDL_SetSurfaceBlendMode, (surface, cases[i].blend));
+                if (cases[i].colormod) {
+                    /* The second pass changes the modulation without changing the blit mapping */
+                    CHECK_FUNC(SDL_SetSurfaceColorMod, (surface, pass ? 90 : 200, 160, pass ? 255 : 40));
+                }
+                if (cases[i].alphamod) {
+                    CHECK_FUNC(SDL_SetSurfaceAlphaMod, (surface, pass ? 60 : 180));
+                }
+            }
+
+            CHECK_FUNC(SDL_FillSurfaceRect, (dst_plain, NULL, SDL_MapSurfaceRGBA(dst_plain, 40, 120, 200, 255)));
+            CHECK_FUNC(SDL_FillSurfaceRect, (dst_rle, NULL, SDL_MapSurfaceRGBA(dst_rle, 40, 120, 200, 255)));
+            for (j = 0; j < SDL_arraysize(dstrects); ++j) {
+                /* The last blit uses the whole source, clipped by the destination */
+                const SDL_Rect *src = (j == SDL_arraysize(dstrects) - 1) ? NULL : &srcrect;
+                SDL_Rect rect = dstrects[j];
+                CHECK_FUNC(SDL_BlitSurface, (plain, src, dst_plain, &rect));
+                rect = dstrects[j];
+                CHECK_FUNC(SDL_BlitSurface, (rle, src, dst_rle, &rect));
+            }
+            SDLTest_AssertCheck(rle->pixels == NULL, "Verify case %d is RLE encoded", i);
+            /* The RLE blitters may round blended channels differently, since
+               they don't need the colorkey test and can use a faster blitter */
+            SDLTest_AssertCheck(SDLTest_CompareSurfaces(dst_rle, dst_plain, 12) == 0,
+                                "Verify case %d pass %d RLE blit matches the regular blit", i, pass);
+        }
+
+        /* Locking the surface gives back the original pixels */
+        SDL_LockSurface(rle);
+        SDLTest_AssertCheck(SDLTest_CompareSurfaces(rle, plain, 0) == 0, "Verify case %d RLE surface decodes to the original pixels", i);
+        SDL_UnlockSurface(rle);
+
+        SDL_DestroySurface(plain);
+        SDL_DestroySurface(rle);
+        SDL_DestroySurface(dst_plain);
+        SDL_DestroySurface(dst_rle);
+    }
+
+    return TEST_COMPLETED;
+}
+
 
 /* ================= Test References ================== */
 
@@ -1662,6 +1787,10 @@ static const SDLTest_TestCaseReference surfaceTestBlitBlendMul = {
     surface_testBlitBlendMul, "surface_testBlitBlendMul", "Tests blitting routines with mul blending mode.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestBlitRLE = {
+    surface_testBlitRLE, "surface_testBlitRLE", "Tests RLE accelerated blits with modulation and blend modes.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestBlitInvalid = {
     surface_testBlitInvalid, "surface_testBlitInvalid", "Tests blitting routines with invalid surfaces.", TEST_ENABLED
 };
@@ -1714,6 +1843,7 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestBlitBlendAddPremultiplied,
     &surfaceTestBlitBlendMod,
     &surfaceTestBlitBlendMul,
+    &surfaceTestBlitRLE,
     &surfaceTestBlitInvalid,
     &surfaceTestOverflow,
     &surfaceTestFlip,
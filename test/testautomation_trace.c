@@ -0,0 +1,151 @@
+/**
+ * Trace test suite
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+/* Helper functions */
+
+/* Saves the current trace and returns it as a string, which must be freed */
+static char *SaveTraceToString(void)
+{
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    char *result = NULL;
+    bool saved;
+
+    SDLTest_AssertCheck(io != NULL, "Check SDL_IOFromDynamicMem() result");
+    if (!io) {
+        return NULL;
+    }
+    saved = SDL_SaveTrace_IO(io, false);
+    SDLTest_AssertCheck(saved, "Call to SDL_SaveTrace_IO(), expected true, got %s (%s)", saved ? "true" : "false", saved ? "" : SDL_GetError());
+    if (saved) {
+        const Sint64 size = SDL_GetIOSize(io);
+        const char *data = (const char *)SDL_GetPointerProperty(SDL_GetIOProperties(io), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+
+        result = (char *)SDL_malloc((size_t)size + 1);
+        if (result) {
+            if (data) {
+                SDL_memcpy(result, data, (size_t)size);
+            }
+            result[size] = '\0';
+        }
+    }
+    SDL_CloseIO(io);
+    return result;
+}
+
+static int SDLCALL TraceThread(void *data)
+{
+    SDL_BeginTraceScope("worker");
+    SDL_EndTraceScope();
+    return 0;
+}
+
+/* Test case functions */
+
+/**
+ * Record nested scopes on two threads and check the saved trace
+ */
+static int SDLCALL trace_recordScopes(void *arg)
+{
+    SDL_Thread *thread;
+    char *trace;
+
+    if (!SDL_StartTracing()) {
+        SDLTest_Log("Tracing isn't supported in this build: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("Call to SDL_StartTracing()");
+
+    SDL_BeginTraceScope("outer");
+    SDL_BeginTraceScope("inner \"quoted\"");
+    SDL_EndTraceScope();
+    SDL_EndTraceScope();
+    SDLTest_AssertPass("Call to SDL_BeginTraceScope() and SDL_EndTraceScope()");
+
+    /* Unbalanced ends are ignored */
+    SDL_EndTraceScope();
+
+    thread = SDL_CreateThread(TraceThread, "TraceWorker", NULL);
+    SDLTest_AssertCheck(thread != NULL, "Call to SDL_CreateThread()");
+    SDL_WaitThread(thread, NULL);
+
+    SDL_StopTracing();
+    SDLTest_AssertPass("Call to SDL_StopTracing()");
+
+    /* Nothing is recorded after tracing stops */
+    SDL_BeginTraceScope("stopped");
+    SDL_EndTraceScope();
+
+    trace = SaveTraceToString();
+    if (trace) {
+        SDLTest_AssertCheck(SDL_strncmp(trace, "{\"traceEvents\":[", 16) == 0, "Check trace starts with the event array");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"outer\",\"ph\":\"X\"") != NULL, "Check trace contains the outer scope");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"inner \\\"quoted\\\"\"") != NULL, "Check trace contains the escaped inner scope");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"name\":\"worker\"") != NULL, "Check trace contains the scope from the thread");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"args\":{\"name\":\"TraceWorker\"}") != NULL, "Check trace contains the thread name");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"stopped\"") == NULL, "Check trace doesn't contain scopes after tracing stopped");
+        SDL_free(trace);
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Restarting tracing discards the previous trace
+ */
+static int SDLCALL trace_restart(void *arg)
+{
+    char *trace;
+
+    if (!SDL_StartTracing()) {
+        SDLTest_Log("Tracing isn't supported in this build: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDL_BeginTraceScope("first");
+    SDL_EndTraceScope();
+
+    /* A scope that is still open when tracing restarts is dropped */
+    SDL_BeginTraceScope("open");
+    SDL_StartTracing();
+    SDLTest_AssertPass("Call to SDL_StartTracing() while tracing");
+    SDL_EndTraceScope();
+
+    SDL_BeginTraceScope("second");
+    SDL_EndTraceScope();
+    SDL_StopTracing();
+
+    trace = SaveTraceToString();
+    if (trace) {
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"first\"") == NULL, "Check trace doesn't contain scopes from the previous trace");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"open\"") == NULL, "Check trace doesn't contain scopes begun before it started");
+        SDLTest_AssertCheck(SDL_strstr(trace, "\"second\"") != NULL, "Check trace contains the new scope");
+        SDL_free(trace);
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Trace test cases */
+static const SDLTest_TestCaseReference traceTest1 = {
+    trace_recordScopes, "trace_recordScopes", "Record scopes and save them as a Chrome trace", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTest2 = {
+    trace_restart, "trace_restart", "Restarting tracing discards the previous trace", TEST_ENABLED
+};
+
+/* Sequence of Trace test cases */
+static const SDLTest_TestCaseReference *traceTests[] = {
+    &traceTest1, &traceTest2, NULL
+};
+
+/* Trace test suite (global) */
+SDLTest_TestSuiteReference traceTestSuite = {
+    "Trace",
+    NULL,
+    traceTests,
+    NULL
+};
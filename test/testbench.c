@@ -0,0 +1,326 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/*
+ * Headless micro-benchmarks for performance sensitive parts of SDL.
+ *
+ * Each result is the median time of a single call, in nanoseconds. Results
+ * can be written to a file with --output and compared against an earlier
+ * run with --baseline, in which case any benchmark that got slower by more
+ * than the tolerance is reported and the program exits with an error.
+ *
+ * Results and baselines use the same plain text format, one benchmark per
+ * line: the name, the time in nanoseconds, and optionally a tolerance in
+ * percent that overrides --tolerance for that benchmark. Lines starting
+ * with '#' are ignored.
+ */
+
+#include <stdlib.h>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "testbench.h"
+
+#define BENCH_MAX_RESULTS 256
+#define BENCH_MAX_SAMPLES 31
+#define BENCH_MAX_NAME    64
+
+typedef struct
+{
+    char name[BENCH_MAX_NAME];
+    double ns;
+    double tolerance; /* percent, or negative to use the default */
+} BenchResult;
+
+static SDLTest_CommonState *state;
+static SDLTest_TestSuiteRunner *runner;
+
+static SDLTest_TestSuiteReference *benchSuites[] = {
+    &benchVideoSuite,
+    &benchAudioSuite,
+    &benchCoreSuite,
+    NULL
+};
+
+static BenchResult results[BENCH_MAX_RESULTS];
+static int num_results;
+static Uint64 min_sample_ns = 20 * SDL_NS_PER_MS;
+static int num_samples = 5;
+
+static double TimeCalls(BenchFunction func, void *userdata, Uint64 iterations)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 i;
+
+    for (i = 0; i < iterations; ++i) {
+        func(userdata);
+    }
+    return (double)(SDL_GetPerformanceCounter() - start) * SDL_NS_PER_SECOND / (double)SDL_GetPerformanceFrequency();
+}
+
+static int SDLCALL CompareDoubles(const void *a, const void *b)
+{
+    const double A = *(const double *)a;
+    const double B = *(const double *)b;
+    return (A < B) ? -1 : (A > B) ? 1 : 0;
+}
+
+void Bench_Run(const char *name, BenchFunction func, void *userdata)
+{
+    double samples[BENCH_MAX_SAMPLES];
+    Uint64 iterations = 1;
+    double elapsed;
+    int i;
+
+    /* Warm up caches and lazily created state, then find how many calls fill a sample */
+    func(userdata);
+    for (;;) {
+        elapsed = TimeCalls(func, userdata, iterations);
+        if (elapsed >= (double)min_sample_ns / 4 || iterations >= (SDL_MAX_UINT64 / 16)) {
+            break;
+        }
+        iterations *= 4;
+    }
+    if (elapsed > 0.0 && elapsed < (double)min_sample_ns) {
+        iterations = (Uint64)(iterations * ((double)min_sample_ns / elapsed)) + 1;
+    }
+
+    for (i = 0; i < num_samples; ++i) {
+        samples[i] = TimeCalls(func, userdata, iterations) / (double)iterations;
+    }
+    SDL_qsort(samples, num_samples, sizeof(samples[0]), CompareDoubles);
+
+    SDLTest_AssertCheck(num_results < BENCH_MAX_RESULTS, "Room to record benchmark %s", name);
+    if (num_results < BENCH_MAX_RESULTS) {
+        BenchResult *result = &results[num_results++];
+        SDL_strlcpy(result->name, name, sizeof(result->name));
+        result->ns = samples[num_samples / 2];
+        result->tolerance = -1.0;
+        SDL_Log("%-48s %14.1f ns  (%" SDL_PRIu64 " calls per sample)", name, result->ns, iterations);
+    }
+}
+
+static bool WriteResults(const char *file)
+{
+    SDL_IOStream *io = SDL_IOFromFile(file, "w");
+    bool result;
+    int i;
+
+    if (!io) {
+        return false;
+    }
+    result = SDL_IOprintf(io, "# SDL benchmark results: name, nanoseconds per call, optional tolerance in percent\n") > 0;
+    for (i = 0; i < num_results && result; ++i) {
+        result = SDL_IOprintf(io, "%s %.1f\n", results[i].name, results[i].ns) > 0;
+    }
+    if (!SDL_CloseIO(io)) {
+        result = false;
+    }
+    return result;
+}
+
+static int LoadResults(const char *file, BenchResult *baseline, int max_results)
+{
+    char *contents = (char *)SDL_LoadFile(file, NULL);
+    char *line, *saveptr = NULL;
+    int count = 0;
+
+    if (!contents) {
+        return -1;
+    }
+    for (line = SDL_strtok_r(contents, "\r\n", &saveptr); line && count < max_results; line = SDL_strtok_r(NULL, "\r\n", &saveptr)) {
+        BenchResult *result = &baseline[count];
+        char format[32];
+        int fields;
+
+        while (*line == ' ' || *line == '\t') {
+            ++line;
+        }
+        if (*line == '#' || *line == '\0') {
+            continue;
+        }
+        SDL_snprintf(format, sizeof(format), "%%%ds %%lf %%lf", BENCH_MAX_NAME - 1);
+        result->tolerance = -1.0;
+        fields = SDL_sscanf(line, format, result->name, &result->ns, &result->tolerance);
+        if (fields < 2) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_TEST, "Ignoring malformed baseline line: %s", line);
+            continue;
+        }
+        ++count;
+    }
+    SDL_free(contents);
+    return count;
+}
+
+/* Returns the number of benchmarks that got slower than the baseline allows */
+static int CompareResults(const BenchResult *baseline, int num_baseline, double default_tolerance)
+{
+    int regressions = 0;
+    int i, j;
+
+    for (i = 0; i < num_results; ++i) {
+        const BenchResult *result = &results[i];
+
+        for (j = 0; j < num_baseline; ++j) {
+            if (SDL_strcmp(result->name, baseline[j].name) == 0) {
+                break;
+            }
+        }
+        if (j == num_baseline) {
+            SDL_Log("%-48s no baseline", result->name);
+        } else {
+            const double tolerance = (baseline[j].tolerance >= 0.0) ? baseline[j].tolerance : default_tolerance;
+            const double change = (baseline[j].ns > 0.0) ? 100.0 * (result->ns - baseline[j].ns) / baseline[j].ns : 0.0;
+
+            if (change > tolerance) {
+                SDL_LogError(SDL_LOG_CATEGORY_TEST, "%-48s %+7.1f%% REGRESSION (%.1f ns, baseline %.1f ns, tolerance %.0f%%)", result->name, change, result->ns, baseline[j].ns, tolerance);
+                ++regressions;
+            } else if (change < -tolerance) {
+                SDL_Log("%-48s %+7.1f%% improved", result->name, change);
+            } else {
+                SDL_Log("%-48s %+7.1f%% ok", result->name, change);
+            }
+        }
+    }
+    return regressions;
+}
+
+static void
+quit(int rc)
+{
+    SDLTest_DestroyTestSuiteRunner(runner);
+    SDLTest_CommonQuit(state);
+    /* Let 'main()' return normally */
+    if (rc != 0) {
+        exit(rc);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output_file = NULL;
+    const char *baseline_file = NULL;
+    double tolerance = 20.0;
+    int result;
+    int i;
+    int list = 0;
+
+    /* Initialize test framework, the benchmarks don't need a window or an audio device */
+    state = SDLTest_CommonCreateState(argv, SDL_INIT_EVENTS);
+    if (!state) {
+        return 1;
+    }
+    state->num_windows = 0;
+
+    runner = SDLTest_CreateTestSuiteRunner(state, benchSuites);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+
+            if (SDL_strcasecmp(argv[i], "--list") == 0) {
+                consumed = 1;
+                list = 1;
+            } else if (argv[i + 1]) {
+                if (SDL_strcasecmp(argv[i], "--output") == 0) {
+                    output_file = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i], "--baseline") == 0) {
+                    baseline_file = argv[i + 1];
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i], "--tolerance") == 0) {
+                    tolerance = SDL_atof(argv[i + 1]);
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i], "--min-time") == 0) {
+                    min_sample_ns = SDL_MS_TO_NS(SDL_atoi(argv[i + 1]));
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i], "--samples") == 0) {
+                    num_samples = SDL_clamp(SDL_atoi(argv[i + 1]), 1, BENCH_MAX_SAMPLES);
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed < 0) {
+            static const char *options[] = {
+                "[--list]",
+                "[--output FILE]",
+                "[--baseline FILE]",
+                "[--tolerance PERCENT]",
+                "[--min-time MS]",
+                "[--samples N]",
+                NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            quit(1);
+        }
+
+        i += consumed;
+    }
+
+    /* List all benchmark suites. */
+    if (list) {
+        int suiteCounter;
+        for (suiteCounter = 0; benchSuites[suiteCounter]; ++suiteCounter) {
+            int testCounter;
+            SDLTest_TestSuiteReference *testSuite = benchSuites[suiteCounter];
+            SDL_Log("Benchmark suite: %s", testSuite->name);
+            for (testCounter = 0; testSuite->testCases[testCounter]; ++testCounter) {
+                const SDLTest_TestCaseReference *testCase = testSuite->testCases[testCounter];
+                SDL_Log("      benchmark: %s%s", testCase->name, testCase->enabled ? "" : " (disabled)");
+            }
+        }
+        quit(0);
+        return 0;
+    }
+
+    /* Initialize common state */
+    if (!SDLTest_CommonInit(state)) {
+        quit(2);
+    }
+
+    /* Call Harness */
+    result = SDLTest_ExecuteTestSuiteRunner(runner);
+
+    if (output_file) {
+        if (WriteResults(output_file)) {
+            SDL_Log("Wrote %d results to %s", num_results, output_file);
+        } else {
+            SDL_LogError(SDL_LOG_CATEGORY_TEST, "Couldn't write %s: %s", output_file, SDL_GetError());
+            result = 1;
+        }
+    }
+
+    if (baseline_file) {
+        static BenchResult baseline[BENCH_MAX_RESULTS];
+        const int num_baseline = LoadResults(baseline_file, baseline, SDL_arraysize(baseline));
+
+        if (num_baseline < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_TEST, "Couldn't load %s: %s", baseline_file, SDL_GetError());
+            result = 1;
+        } else {
+            const int regressions = CompareResults(baseline, num_baseline, tolerance);
+            if (regressions > 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_TEST, "%d of %d benchmarks are slower than %s allows", regressions, num_results, baseline_file);
+                result = 1;
+            }
+        }
+    }
+
+    /* Shutdown everything */
+    quit(0);
+    return result;
+}
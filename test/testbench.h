@@ -0,0 +1,39 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/**
+ * Shared definitions for the benchmark suites run by testbench.
+ */
+
+#ifndef testbench_h_
+#define testbench_h_
+
+#include <SDL3/SDL_test.h>
+
+/* A single timed operation, called over and over by Bench_Run() */
+typedef void (SDLCALL *BenchFunction)(void *userdata);
+
+/**
+ * Time repeated calls to `func` and record the average time per call.
+ *
+ * The number of calls is chosen so that each sample takes at least the
+ * minimum sample time, and the median of several samples is recorded as
+ * `name`, which should be unique across all suites.
+ */
+extern void Bench_Run(const char *name, BenchFunction func, void *userdata);
+
+/* Benchmark collections */
+extern SDLTest_TestSuiteReference benchAudioSuite;
+extern SDLTest_TestSuiteReference benchCoreSuite;
+extern SDLTest_TestSuiteReference benchVideoSuite;
+
+#endif /* testbench_h_ */
@@ -0,0 +1,240 @@
+/**
+ * Audio conversion, resampling and mixing benchmarks
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbench.h"
+
+/* About 93 ms of audio at 44.1 kHz, a typical amount for a single callback or two */
+#define BENCH_AUDIO_FRAMES 4096
+
+typedef struct
+{
+    SDL_AudioSpec src_spec;
+    SDL_AudioSpec dst_spec;
+    SDL_AudioStream *stream;
+    Uint8 *src;
+    int src_len;
+    Uint8 *dst;
+    int dst_len;
+} AudioBench;
+
+static Uint8 *CreateTestAudio(const SDL_AudioSpec *spec, int *len)
+{
+    const int num_samples = BENCH_AUDIO_FRAMES * spec->channels;
+    SDL_AudioSpec float_spec;
+    float *samples = (float *)SDL_malloc(num_samples * sizeof(float));
+    Uint8 *data = NULL;
+    int i;
+
+    if (!samples) {
+        return NULL;
+    }
+    float_spec.format = SDL_AUDIO_F32;
+    float_spec.channels = spec->channels;
+    float_spec.freq = spec->freq;
+
+    /* A sine sweep, so the conversions see a realistic spread of values */
+    for (i = 0; i < num_samples; ++i) {
+        samples[i] = 0.8f * SDL_sinf((float)i * (0.01f + (float)i * 0.000001f));
+    }
+    if (!SDL_ConvertAudioSamples(&float_spec, (const Uint8 *)samples, num_samples * (int)sizeof(float), spec, &data, len)) {
+        data = NULL;
+    }
+    SDL_free(samples);
+    return data;
+}
+
+static const char *ShortAudioFormatName(SDL_AudioFormat format)
+{
+    const char *name = SDL_GetAudioFormatName(format);
+    const char *prefix = "SDL_AUDIO_";
+
+    if (SDL_strncmp(name, prefix, SDL_strlen(prefix)) == 0) {
+        name += SDL_strlen(prefix);
+    }
+    return name;
+}
+
+static void SDLCALL BenchConvert(void *userdata)
+{
+    AudioBench *bench = (AudioBench *)userdata;
+    Uint8 *dst = NULL;
+    int dst_len = 0;
+
+    SDL_ConvertAudioSamples(&bench->src_spec, bench->src, bench->src_len, &bench->dst_spec, &dst, &dst_len);
+    SDL_free(dst);
+}
+
+static void SDLCALL BenchStream(void *userdata)
+{
+    AudioBench *bench = (AudioBench *)userdata;
+
+    SDL_PutAudioStreamData(bench->stream, bench->src, bench->src_len);
+    while (SDL_GetAudioStreamData(bench->stream, bench->dst, bench->dst_len) > 0) {
+        /* Drain everything that's available */
+    }
+}
+
+static void SDLCALL BenchMix(void *userdata)
+{
+    AudioBench *bench = (AudioBench *)userdata;
+    SDL_MixAudio(bench->dst, bench->src, bench->src_spec.format, (Uint32)bench->src_len, 0.5f);
+}
+
+/* Test case functions */
+
+/**
+ * Convert between sample formats and channel layouts
+ */
+static int SDLCALL bench_convert(void *arg)
+{
+    static const struct
+    {
+        SDL_AudioFormat src_format;
+        int src_channels;
+        SDL_AudioFormat dst_format;
+        int dst_channels;
+    } conversions[] = {
+        { SDL_AUDIO_S16, 2, SDL_AUDIO_F32, 2 },
+        { SDL_AUDIO_F32, 2, SDL_AUDIO_S16, 2 },
+        { SDL_AUDIO_S32, 2, SDL_AUDIO_F32, 2 },
+        { SDL_AUDIO_U8, 1, SDL_AUDIO_F32, 1 },
+        { SDL_AUDIO_S16, 1, SDL_AUDIO_S16, 2 },
+        { SDL_AUDIO_F32, 2, SDL_AUDIO_F32, 6 },
+        { SDL_AUDIO_F32, 6, SDL_AUDIO_F32, 2 }
+    };
+    AudioBench bench;
+    int i;
+
+    SDL_zero(bench);
+    for (i = 0; i < (int)SDL_arraysize(conversions); ++i) {
+        char name[64];
+
+        bench.src_spec.format = conversions[i].src_format;
+        bench.src_spec.channels = conversions[i].src_channels;
+        bench.src_spec.freq = 48000;
+        bench.dst_spec.format = conversions[i].dst_format;
+        bench.dst_spec.channels = conversions[i].dst_channels;
+        bench.dst_spec.freq = 48000;
+
+        bench.src = CreateTestAudio(&bench.src_spec, &bench.src_len);
+        SDLTest_AssertCheck(bench.src != NULL, "Create %s source audio", ShortAudioFormatName(bench.src_spec.format));
+        if (!bench.src) {
+            continue;
+        }
+        SDL_snprintf(name, sizeof(name), "audio_convert_%s_%dch_to_%s_%dch",
+                     ShortAudioFormatName(bench.src_spec.format), bench.src_spec.channels,
+                     ShortAudioFormatName(bench.dst_spec.format), bench.dst_spec.channels);
+        Bench_Run(name, BenchConvert, &bench);
+        SDL_free(bench.src);
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Resample through an audio stream
+ */
+static int SDLCALL bench_resample(void *arg)
+{
+    static const struct
+    {
+        SDL_AudioFormat format;
+        int channels;
+        int src_freq;
+        int dst_freq;
+    } resamples[] = {
+        { SDL_AUDIO_F32, 2, 44100, 48000 },
+        { SDL_AUDIO_F32, 2, 48000, 44100 },
+        { SDL_AUDIO_S16, 2, 22050, 48000 },
+        { SDL_AUDIO_F32, 1, 96000, 48000 }
+    };
+    AudioBench bench;
+    int i;
+
+    SDL_zero(bench);
+    for (i = 0; i < (int)SDL_arraysize(resamples); ++i) {
+        char name[64];
+
+        bench.src_spec.format = resamples[i].format;
+        bench.src_spec.channels = resamples[i].channels;
+        bench.src_spec.freq = resamples[i].src_freq;
+        bench.dst_spec = bench.src_spec;
+        bench.dst_spec.freq = resamples[i].dst_freq;
+
+        bench.src = CreateTestAudio(&bench.src_spec, &bench.src_len);
+        bench.dst_len = bench.src_len * 4;
+        bench.dst = (Uint8 *)SDL_malloc(bench.dst_len);
+        bench.stream = SDL_CreateAudioStream(&bench.src_spec, &bench.dst_spec);
+        SDLTest_AssertCheck(bench.src && bench.dst && bench.stream, "Create audio stream and buffers");
+        if (bench.src && bench.dst && bench.stream) {
+            SDL_snprintf(name, sizeof(name), "audio_resample_%s_%dch_%d_to_%d",
+                         ShortAudioFormatName(bench.src_spec.format), bench.src_spec.channels,
+                         bench.src_spec.freq, bench.dst_spec.freq);
+            Bench_Run(name, BenchStream, &bench);
+        }
+        SDL_DestroyAudioStream(bench.stream);
+        SDL_free(bench.dst);
+        SDL_free(bench.src);
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Mix one buffer into another
+ */
+static int SDLCALL bench_mix(void *arg)
+{
+    static const SDL_AudioFormat formats[] = {
+        SDL_AUDIO_S16, SDL_AUDIO_S32, SDL_AUDIO_F32
+    };
+    AudioBench bench;
+    int i;
+
+    SDL_zero(bench);
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        char name[64];
+
+        bench.src_spec.format = formats[i];
+        bench.src_spec.channels = 2;
+        bench.src_spec.freq = 48000;
+
+        bench.src = CreateTestAudio(&bench.src_spec, &bench.src_len);
+        bench.dst = (Uint8 *)SDL_calloc(1, bench.src_len);
+        SDLTest_AssertCheck(bench.src && bench.dst, "Create %s mixing buffers", ShortAudioFormatName(formats[i]));
+        if (bench.src && bench.dst) {
+            SDL_snprintf(name, sizeof(name), "audio_mix_%s", ShortAudioFormatName(formats[i]));
+            Bench_Run(name, BenchMix, &bench);
+        }
+        SDL_free(bench.dst);
+        SDL_free(bench.src);
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+static const SDLTest_TestCaseReference benchConvert = {
+    bench_convert, "bench_convert", "Sample format and channel conversion", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchResample = {
+    bench_resample, "bench_resample", "Sample rate conversion through an audio stream", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchMix = {
+    bench_mix, "bench_mix", "Mixing audio buffers", TEST_ENABLED
+};
+
+/* Sequence of Audio benchmarks */
+static const SDLTest_TestCaseReference *benchAudioTests[] = {
+    &benchConvert, &benchResample, &benchMix, NULL
+};
+
+/* Audio benchmark suite (global) */
+SDLTest_TestSuiteReference benchAudioSuite = {
+    "Audio",
+    NULL,
+    benchAudioTests,
+    NULL
+};
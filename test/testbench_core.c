@@ -0,0 +1,277 @@
+/**
+ * Event queue, properties, hints, timer and I/O stream benchmarks
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbench.h"
+
+#define BENCH_NUM_EVENTS     64
+#define BENCH_NUM_PROPERTIES 256
+#define BENCH_IO_SIZE        4096
+
+typedef struct
+{
+    SDL_PropertiesID props;
+    char names[BENCH_NUM_PROPERTIES][32];
+    Uint8 data[BENCH_IO_SIZE];
+    Uint32 counter;
+    Uint64 sink;
+} CoreBench;
+
+static void SDLCALL BenchPeepEvents(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    SDL_Event events[BENCH_NUM_EVENTS];
+    int i;
+
+    for (i = 0; i < BENCH_NUM_EVENTS; ++i) {
+        SDL_zero(events[i]);
+        events[i].type = SDL_EVENT_USER;
+        events[i].user.code = i;
+    }
+    SDL_PeepEvents(events, BENCH_NUM_EVENTS, SDL_ADDEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+    bench->sink += SDL_PeepEvents(events, BENCH_NUM_EVENTS, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+}
+
+static void SDLCALL BenchPushPollEvents(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    SDL_Event event;
+    int i;
+
+    for (i = 0; i < BENCH_NUM_EVENTS; ++i) {
+        SDL_zero(event);
+        event.type = SDL_EVENT_USER;
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    while (SDL_PollEvent(&event)) {
+        bench->sink += event.type;
+    }
+}
+
+static void SDLCALL BenchSetProperties(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    int i;
+
+    for (i = 0; i < BENCH_NUM_PROPERTIES; ++i) {
+        SDL_SetNumberProperty(bench->props, bench->names[i], (Sint64)bench->counter + i);
+    }
+    ++bench->counter;
+}
+
+static void SDLCALL BenchGetProperties(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    int i;
+
+    for (i = 0; i < BENCH_NUM_PROPERTIES; ++i) {
+        bench->sink += (Uint64)SDL_GetNumberProperty(bench->props, bench->names[i], 0);
+    }
+}
+
+static void SDLCALL BenchCreateProperties(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    SDL_PropertiesID props = SDL_CreateProperties();
+    int i;
+
+    for (i = 0; i < 16; ++i) {
+        SDL_SetNumberProperty(props, bench->names[i], i);
+    }
+    SDL_DestroyProperties(props);
+}
+
+static void SDLCALL BenchSetHint(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+
+    SDL_SetHint("SDL_BENCH_HINT", (bench->counter++ & 1) ? "1" : "0");
+}
+
+static void SDLCALL BenchGetHint(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+
+    bench->sink += SDL_GetHintBoolean("SDL_BENCH_HINT", false);
+}
+
+static void SDLCALL BenchPerformanceCounter(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+
+    bench->sink += SDL_GetPerformanceCounter();
+}
+
+static void SDLCALL BenchTicksNS(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+
+    bench->sink += SDL_GetTicksNS();
+}
+
+static void SDLCALL BenchWriteDynamicMem(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    size_t offset;
+
+    if (io) {
+        for (offset = 0; offset < sizeof(bench->data); offset += 16) {
+            SDL_WriteIO(io, &bench->data[offset], 16);
+        }
+        SDL_CloseIO(io);
+    }
+}
+
+static void SDLCALL BenchReadConstMem(void *userdata)
+{
+    CoreBench *bench = (CoreBench *)userdata;
+    SDL_IOStream *io = SDL_IOFromConstMem(bench->data, sizeof(bench->data));
+    Uint32 value;
+
+    if (io) {
+        while (SDL_ReadU32LE(io, &value)) {
+            bench->sink += value;
+        }
+        SDL_CloseIO(io);
+    }
+}
+
+/* Test case functions */
+
+/**
+ * Add and remove events from the event queue
+ */
+static int SDLCALL bench_events(void *arg)
+{
+    CoreBench *bench = (CoreBench *)SDL_calloc(1, sizeof(*bench));
+
+    SDLTest_AssertCheck(bench != NULL, "Allocate benchmark state");
+    if (!bench) {
+        return TEST_ABORTED;
+    }
+    Bench_Run("events_peep_64", BenchPeepEvents, bench);
+    Bench_Run("events_push_poll_64", BenchPushPollEvents, bench);
+    SDL_free(bench);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Set and look up properties, which exercises the internal hash table
+ */
+static int SDLCALL bench_properties(void *arg)
+{
+    CoreBench *bench = (CoreBench *)SDL_calloc(1, sizeof(*bench));
+    int i;
+
+    SDLTest_AssertCheck(bench != NULL, "Allocate benchmark state");
+    if (!bench) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < BENCH_NUM_PROPERTIES; ++i) {
+        SDL_snprintf(bench->names[i], sizeof(bench->names[i]), "bench.property.%d", i);
+    }
+    bench->props = SDL_CreateProperties();
+    SDLTest_AssertCheck(bench->props != 0, "Create properties");
+    if (bench->props) {
+        Bench_Run("properties_set_256", BenchSetProperties, bench);
+        Bench_Run("properties_get_256", BenchGetProperties, bench);
+        Bench_Run("properties_create_destroy_16", BenchCreateProperties, bench);
+        SDL_DestroyProperties(bench->props);
+    }
+    SDL_free(bench);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Set and query hints
+ */
+static int SDLCALL bench_hints(void *arg)
+{
+    CoreBench *bench = (CoreBench *)SDL_calloc(1, sizeof(*bench));
+
+    SDLTest_AssertCheck(bench != NULL, "Allocate benchmark state");
+    if (!bench) {
+        return TEST_ABORTED;
+    }
+    Bench_Run("hint_set", BenchSetHint, bench);
+    Bench_Run("hint_get", BenchGetHint, bench);
+    SDL_ResetHint("SDL_BENCH_HINT");
+    SDL_free(bench);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Query the time
+ */
+static int SDLCALL bench_timer(void *arg)
+{
+    CoreBench *bench = (CoreBench *)SDL_calloc(1, sizeof(*bench));
+
+    SDLTest_AssertCheck(bench != NULL, "Allocate benchmark state");
+    if (!bench) {
+        return TEST_ABORTED;
+    }
+    Bench_Run("timer_performance_counter", BenchPerformanceCounter, bench);
+    Bench_Run("timer_ticks_ns", BenchTicksNS, bench);
+    SDL_free(bench);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Write and read memory streams in small pieces
+ */
+static int SDLCALL bench_iostream(void *arg)
+{
+    CoreBench *bench = (CoreBench *)SDL_calloc(1, sizeof(*bench));
+    int i;
+
+    SDLTest_AssertCheck(bench != NULL, "Allocate benchmark state");
+    if (!bench) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < BENCH_IO_SIZE; ++i) {
+        bench->data[i] = (Uint8)i;
+    }
+    Bench_Run("iostream_write_dynamic_4k", BenchWriteDynamicMem, bench);
+    Bench_Run("iostream_read_u32_4k", BenchReadConstMem, bench);
+    SDL_free(bench);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+static const SDLTest_TestCaseReference benchEvents = {
+    bench_events, "bench_events", "Event queue throughput", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchProperties = {
+    bench_properties, "bench_properties", "Property set and lookup", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchHints = {
+    bench_hints, "bench_hints", "Hint set and lookup", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchTimer = {
+    bench_timer, "bench_timer", "Time queries", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchIOStream = {
+    bench_iostream, "bench_iostream", "Memory stream reads and writes", TEST_ENABLED
+};
+
+/* Sequence of Core benchmarks */
+static const SDLTest_TestCaseReference *benchCoreTests[] = {
+    &benchEvents, &benchProperties, &benchHints, &benchTimer, &benchIOStream, NULL
+};
+
+/* Core benchmark suite (global) */
+SDLTest_TestSuiteReference benchCoreSuite = {
+    "Core",
+    NULL,
+    benchCoreTests,
+    NULL
+};
@@ -0,0 +1,302 @@
+/**
+ * Surface and software rendering benchmarks
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbench.h"
+
+#define BENCH_SURFACE_SIZE 256
+
+typedef struct
+{
+    SDL_Surface *src;
+    SDL_Surface *dst;
+    SDL_Renderer *renderer;
+    SDL_Rect dstrect;
+    SDL_ScaleMode scaleMode;
+} VideoBench;
+
+static SDL_Surface *CreateTestSurface(int w, int h, SDL_PixelFormat format)
+{
+    SDL_Surface *rgba = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA32);
+    SDL_Surface *surface = NULL;
+    int x, y;
+
+    if (!rgba) {
+        return NULL;
+    }
+
+    /* A gradient with varying alpha, so blending doesn't take any shortcuts */
+    for (y = 0; y < h; ++y) {
+        Uint8 *row = (Uint8 *)rgba->pixels + y * rgba->pitch;
+        for (x = 0; x < w; ++x) {
+            row[x * 4 + 0] = (Uint8)(x * 255 / w);
+            row[x * 4 + 1] = (Uint8)(y * 255 / h);
+            row[x * 4 + 2] = (Uint8)((x ^ y) & 0xFF);
+            row[x * 4 + 3] = (Uint8)((x + y) & 0xFF);
+        }
+    }
+
+    if (format == SDL_PIXELFORMAT_INDEX8) {
+        surface = SDL_CreateSurface(w, h, format);
+        if (surface) {
+            SDL_Palette *palette = SDL_CreateSurfacePalette(surface);
+            SDL_Color colors[256];
+            int i;
+
+            for (i = 0; i < 256; ++i) {
+                colors[i].r = (Uint8)i;
+                colors[i].g = (Uint8)(255 - i);
+                colors[i].b = (Uint8)(i * 7);
+                colors[i].a = (Uint8)(i * 3);
+            }
+            SDL_SetPaletteColors(palette, colors, 0, 256);
+            for (y = 0; y < h; ++y) {
+                Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+                for (x = 0; x < w; ++x) {
+                    row[x] = (Uint8)((x + y * 3) & 0xFF);
+                }
+            }
+        }
+    } else {
+        surface = SDL_ConvertSurface(rgba, format);
+    }
+    SDL_DestroySurface(rgba);
+    return surface;
+}
+
+static const char *ShortFormatName(SDL_PixelFormat format)
+{
+    const char *name = SDL_GetPixelFormatName(format);
+    const char *prefix = "SDL_PIXELFORMAT_";
+
+    if (SDL_strncmp(name, prefix, SDL_strlen(prefix)) == 0) {
+        name += SDL_strlen(prefix);
+    }
+    return name;
+}
+
+static void SDLCALL BenchBlit(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    SDL_BlitSurface(bench->src, NULL, bench->dst, NULL);
+}
+
+static void SDLCALL BenchBlitScaled(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    SDL_BlitSurfaceScaled(bench->src, NULL, bench->dst, &bench->dstrect, bench->scaleMode);
+}
+
+static void SDLCALL BenchFillRect(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    SDL_FillSurfaceRect(bench->dst, NULL, 0xFF336699);
+}
+
+static void SDLCALL BenchFillRects(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    SDL_Rect rects[16];
+    int i;
+
+    for (i = 0; i < (int)SDL_arraysize(rects); ++i) {
+        rects[i].x = i * 13;
+        rects[i].y = i * 7;
+        rects[i].w = 32 + i * 4;
+        rects[i].h = 24 + i * 3;
+    }
+    SDL_FillSurfaceRects(bench->dst, rects, SDL_arraysize(rects), 0xFF996633);
+}
+
+static void SDLCALL BenchRenderLines(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    int i;
+
+    for (i = 0; i < BENCH_SURFACE_SIZE; i += 8) {
+        SDL_RenderLine(bench->renderer, 0.0f, (float)i, (float)(BENCH_SURFACE_SIZE - 1), (float)(BENCH_SURFACE_SIZE - 1 - i));
+    }
+    SDL_FlushRenderer(bench->renderer);
+}
+
+static void SDLCALL BenchRenderFillRects(void *userdata)
+{
+    VideoBench *bench = (VideoBench *)userdata;
+    SDL_FRect rects[16];
+    int i;
+
+    for (i = 0; i < (int)SDL_arraysize(rects); ++i) {
+        rects[i].x = (float)(i * 13);
+        rects[i].y = (float)(i * 7);
+        rects[i].w = (float)(32 + i * 4);
+        rects[i].h = (float)(24 + i * 3);
+    }
+    SDL_RenderFillRects(bench->renderer, rects, SDL_arraysize(rects));
+    SDL_FlushRenderer(bench->renderer);
+}
+
+/* Test case functions */
+
+/**
+ * Blit from common source formats onto an XRGB8888 surface with each blend mode
+ */
+static int SDLCALL bench_blit(void *arg)
+{
+    static const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_XRGB8888,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_INDEX8
+    };
+    static const struct
+    {
+        SDL_BlendMode mode;
+        const char *name;
+    } blendModes[] = {
+        { SDL_BLENDMODE_NONE, "none" },
+        { SDL_BLENDMODE_BLEND, "blend" },
+        { SDL_BLENDMODE_ADD, "add" },
+        { SDL_BLENDMODE_MOD, "mod" }
+    };
+    VideoBench bench;
+    int i, j;
+
+    SDL_zero(bench);
+    bench.dst = SDL_CreateSurface(BENCH_SURFACE_SIZE, BENCH_SURFACE_SIZE, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(bench.dst != NULL, "Create destination surface");
+    if (!bench.dst) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        bench.src = CreateTestSurface(BENCH_SURFACE_SIZE, BENCH_SURFACE_SIZE, formats[i]);
+        SDLTest_AssertCheck(bench.src != NULL, "Create %s source surface", ShortFormatName(formats[i]));
+        if (!bench.src) {
+            continue;
+        }
+        for (j = 0; j < (int)SDL_arraysize(blendModes); ++j) {
+            char name[64];
+
+            SDL_SetSurfaceBlendMode(bench.src, blendModes[j].mode);
+            SDL_snprintf(name, sizeof(name), "blit_%s_%s", ShortFormatName(formats[i]), blendModes[j].name);
+            Bench_Run(name, BenchBlit, &bench);
+        }
+        SDL_DestroySurface(bench.src);
+    }
+    SDL_DestroySurface(bench.dst);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Scale an ARGB8888 surface up and down with nearest and linear filtering
+ */
+static int SDLCALL bench_blitScaled(void *arg)
+{
+    static const struct
+    {
+        SDL_ScaleMode mode;
+        const char *name;
+    } scaleModes[] = {
+        { SDL_SCALEMODE_NEAREST, "nearest" },
+        { SDL_SCALEMODE_LINEAR, "linear" }
+    };
+    VideoBench bench;
+    int i;
+
+    SDL_zero(bench);
+    bench.src = CreateTestSurface(BENCH_SURFACE_SIZE, BENCH_SURFACE_SIZE, SDL_PIXELFORMAT_ARGB8888);
+    bench.dst = SDL_CreateSurface(BENCH_SURFACE_SIZE * 2, BENCH_SURFACE_SIZE * 2, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(bench.src != NULL && bench.dst != NULL, "Create source and destination surfaces");
+    if (!bench.src || !bench.dst) {
+        SDL_DestroySurface(bench.src);
+        SDL_DestroySurface(bench.dst);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(bench.src, SDL_BLENDMODE_NONE);
+
+    for (i = 0; i < (int)SDL_arraysize(scaleModes); ++i) {
+        char name[64];
+
+        bench.scaleMode = scaleModes[i].mode;
+
+        bench.dstrect.x = 0;
+        bench.dstrect.y = 0;
+        bench.dstrect.w = BENCH_SURFACE_SIZE * 2;
+        bench.dstrect.h = BENCH_SURFACE_SIZE * 2;
+        SDL_snprintf(name, sizeof(name), "blit_scaled_up_%s", scaleModes[i].name);
+        Bench_Run(name, BenchBlitScaled, &bench);
+
+        bench.dstrect.w = BENCH_SURFACE_SIZE / 2;
+        bench.dstrect.h = BENCH_SURFACE_SIZE / 2;
+        SDL_snprintf(name, sizeof(name), "blit_scaled_down_%s", scaleModes[i].name);
+        Bench_Run(name, BenchBlitScaled, &bench);
+    }
+    SDL_DestroySurface(bench.src);
+    SDL_DestroySurface(bench.dst);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Fill rectangles on a surface directly and through the software renderer
+ */
+static int SDLCALL bench_fill(void *arg)
+{
+    VideoBench bench;
+
+    SDL_zero(bench);
+    bench.dst = SDL_CreateSurface(BENCH_SURFACE_SIZE, BENCH_SURFACE_SIZE, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(bench.dst != NULL, "Create destination surface");
+    if (!bench.dst) {
+        return TEST_ABORTED;
+    }
+
+    Bench_Run("fill_surface", BenchFillRect, &bench);
+    Bench_Run("fill_surface_rects", BenchFillRects, &bench);
+
+    bench.renderer = SDL_CreateSoftwareRenderer(bench.dst);
+    SDLTest_AssertCheck(bench.renderer != NULL, "Create software renderer");
+    if (bench.renderer) {
+        SDL_SetRenderDrawColor(bench.renderer, 0xFF, 0x80, 0x40, 0xFF);
+        Bench_Run("render_fill_rects", BenchRenderFillRects, &bench);
+        Bench_Run("render_lines", BenchRenderLines, &bench);
+
+        SDL_SetRenderDrawBlendMode(bench.renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(bench.renderer, 0xFF, 0x80, 0x40, 0x80);
+        Bench_Run("render_fill_rects_blend", BenchRenderFillRects, &bench);
+        Bench_Run("render_lines_blend", BenchRenderLines, &bench);
+
+        SDL_DestroyRenderer(bench.renderer);
+    }
+    SDL_DestroySurface(bench.dst);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+static const SDLTest_TestCaseReference benchBlit = {
+    bench_blit, "bench_blit", "Blit between pixel formats with each blend mode", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchBlitScaled = {
+    bench_blitScaled, "bench_blitScaled", "Scaled blits with nearest and linear filtering", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference benchFill = {
+    bench_fill, "bench_fill", "Surface fills and software renderer primitives", TEST_ENABLED
+};
+
+/* Sequence of Video benchmarks */
+static const SDLTest_TestCaseReference *benchVideoTests[] = {
+    &benchBlit, &benchBlitScaled, &benchFill, NULL
+};
+
+/* Video benchmark suite (global) */
+SDLTest_TestSuiteReference benchVideoSuite = {
+    "Video",
+    NULL,
+    benchVideoTests,
+    NULL
+};
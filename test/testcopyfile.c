@@ -0,0 +1,192 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+/* Benchmark of SDL_CopyFile() against a plain SDL_IOStream copy loop, for small and large files. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SOURCE_FILE "testcopyfile.src"
+#define TARGET_FILE "testcopyfile.dst"
+
+static bool CreateSourceFile(const char *path, Uint64 size)
+{
+    Uint8 block[64 * 1024];
+    Uint64 seed = 0x5D1;
+    SDL_IOStream *io;
+    Uint64 written = 0;
+    size_t i;
+    bool result = true;
+
+    for (i = 0; i < sizeof(block); ++i) {
+        block[i] = (Uint8)SDL_rand_r(&seed, 256);
+    }
+
+    io = SDL_IOFromFile(path, "wb");
+    if (!io) {
+        return false;
+    }
+    while (written < size) {
+        const size_t len = (size_t)SDL_min(size - written, sizeof(block));
+        if (SDL_WriteIO(io, block, len) != len) {
+            result = false;
+            break;
+        }
+        written += len;
+    }
+    if (!SDL_CloseIO(io)) {
+        result = false;
+    }
+    return result;
+}
+
+/* This is how SDL_CopyFile() used to copy files, for comparison */
+static bool StreamCopyFile(const char *oldpath, const char *newpath)
+{
+    Uint8 buffer[4096];
+    SDL_IOStream *input;
+    SDL_IOStream *output;
+    size_t len;
+    bool result = true;
+
+    input = SDL_IOFromFile(oldpath, "rb");
+    if (!input) {
+        return false;
+    }
+    output = SDL_IOFromFile(newpath, "wb");
+    if (!output) {
+        SDL_CloseIO(input);
+        return false;
+    }
+    while ((len = SDL_ReadIO(input, buffer, sizeof(buffer))) > 0) {
+        if (SDL_WriteIO(output, buffer, len) < len) {
+            result = false;
+            break;
+        }
+    }
+    SDL_CloseIO(input);
+    if (!SDL_CloseIO(output)) {
+        result = false;
+    }
+    return result;
+}
+
+static bool VerifyCopy(const char *oldpath, const char *newpath)
+{
+    size_t oldsize = 0, newsize = 0;
+    void *olddata = SDL_LoadFile(oldpath, &oldsize);
+    void *newdata = SDL_LoadFile(newpath, &newsize);
+    bool result = (olddata && newdata && oldsize == newsize && SDL_memcmp(olddata, newdata, oldsize) == 0);
+
+    SDL_free(olddata);
+    SDL_free(newdata);
+    return result;
+}
+
+static bool RunBenchmark(const char *desc, Uint64 size, int count)
+{
+    Uint64 start, copy_ns, stream_ns;
+    int i;
+
+    if (!CreateSourceFile(SOURCE_FILE, size)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create %s: %s", SOURCE_FILE, SDL_GetError());
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < count; ++i) {
+        if (!SDL_CopyFile(SOURCE_FILE, TARGET_FILE)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CopyFile() failed: %s", SDL_GetError());
+            return false;
+        }
+    }
+    copy_ns = SDL_GetTicksNS() - start;
+
+    if (!VerifyCopy(SOURCE_FILE, TARGET_FILE)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CopyFile() produced a different file");
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < count; ++i) {
+        if (!StreamCopyFile(SOURCE_FILE, TARGET_FILE)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Stream copy failed: %s", SDL_GetError());
+            return false;
+        }
+    }
+    stream_ns = SDL_GetTicksNS() - start;
+
+    SDL_Log("%s: %d x %" SDL_PRIu64 " bytes: SDL_CopyFile %.3f ms, stream copy %.3f ms (%.2fx)",
+            desc, count, size,
+            (double)copy_ns / SDL_NS_PER_MS, (double)stream_ns / SDL_NS_PER_MS,
+            copy_ns ? ((double)stream_ns / (double)copy_ns) : 0.0);
+
+    SDL_RemovePath(SOURCE_FILE);
+    SDL_RemovePath(TARGET_FILE);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint64 small_size = 4 * 1024;
+    Uint64 large_size = 64 * 1024 * 1024;
+    int small_count = 256;
+    int large_count = 4;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed && (i + 1) < argc) {
+            if (SDL_strcmp(argv[i], "--small-size") == 0) {
+                small_size = SDL_strtoull(argv[i + 1], NULL, 0);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--small-count") == 0) {
+                small_count = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--large-size") == 0) {
+                large_size = SDL_strtoull(argv[i + 1], NULL, 0);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--large-count") == 0) {
+                large_count = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--small-size BYTES]", "[--small-count N]", "[--large-size BYTES]", "[--large-count N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!RunBenchmark("small files", small_size, small_count) ||
+        !RunBenchmark("large files", large_size, large_count)) {
+        result = 1;
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return result;
+}
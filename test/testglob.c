@@ -0,0 +1,185 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+/* Benchmark of SDL_GlobDirectory() over a generated directory tree. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define TREE_ROOT "testglob.tree"
+
+static int depth = 3;
+static int fanout = 8;
+static int files_per_dir = 64;
+static int num_dirs = 0;
+static int num_files = 0;
+
+static bool CreateTree(const char *path, int level)
+{
+    char *subpath = NULL;
+    int i;
+
+    if (!SDL_CreateDirectory(path)) {
+        return false;
+    }
+    num_dirs++;
+
+    for (i = 0; i < files_per_dir; ++i) {
+        SDL_IOStream *io;
+        /* Mix up the case of the names, so case-insensitive globbing has something to do */
+        if (SDL_asprintf(&subpath, "%s/%s%d.%s", path, (i & 1) ? "Asset" : "asset", i, (i % 4) ? "dat" : "TXT") < 0) {
+            return false;
+        }
+        io = SDL_IOFromFile(subpath, "wb");
+        SDL_free(subpath);
+        if (!io) {
+            return false;
+        }
+        SDL_CloseIO(io);
+        num_files++;
+    }
+
+    if (level < depth) {
+        for (i = 0; i < fanout; ++i) {
+            bool result;
+            if (SDL_asprintf(&subpath, "%s/dir%d", path, i) < 0) {
+                return false;
+            }
+            result = CreateTree(subpath, level + 1);
+            SDL_free(subpath);
+            if (!result) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static SDL_EnumerationResult SDLCALL RemoveTreeCallback(void *userdata, const char *dirname, const char *fname)
+{
+    SDL_PathInfo info;
+    char *path = NULL;
+
+    if (SDL_asprintf(&path, "%s%s", dirname, fname) < 0) {
+        return SDL_ENUM_FAILURE;
+    }
+    if (SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_DIRECTORY) {
+        SDL_EnumerateDirectory(path, RemoveTreeCallback, NULL);
+    }
+    SDL_RemovePath(path);
+    SDL_free(path);
+    return SDL_ENUM_CONTINUE;
+}
+
+static void RemoveTree(const char *path)
+{
+    SDL_EnumerateDirectory(path, RemoveTreeCallback, NULL);
+    SDL_RemovePath(path);
+}
+
+static bool RunBenchmark(const char *pattern, SDL_GlobFlags flags, int expected, int iterations)
+{
+    Uint64 start, elapsed;
+    int count = 0;
+    int i;
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        char **entries = SDL_GlobDirectory(TREE_ROOT, pattern, flags, &count);
+        if (!entries) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_GlobDirectory('%s') failed: %s", pattern ? pattern : "(null)", SDL_GetError());
+            return false;
+        }
+        SDL_free(entries);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_Log("pattern '%s'%s: %d matches, %.3f ms per glob",
+            pattern ? pattern : "(null)", (flags & SDL_GLOB_CASEINSENSITIVE) ? " (case-insensitive)" : "",
+            count, ((double)elapsed / iterations) / SDL_NS_PER_MS);
+
+    if (expected >= 0 && count != expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d matches, got %d", expected, count);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int iterations = 10;
+    int top_files, txt_files;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed && (i + 1) < argc) {
+            if (SDL_strcmp(argv[i], "--depth") == 0) {
+                depth = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--fanout") == 0) {
+                fanout = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--files") == 0) {
+                files_per_dir = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                iterations = SDL_max(1, SDL_atoi(argv[i + 1]));
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--depth N]", "[--fanout N]", "[--files N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    RemoveTree(TREE_ROOT);
+    if (!CreateTree(TREE_ROOT, 0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create directory tree: %s", SDL_GetError());
+        RemoveTree(TREE_ROOT);
+        return 1;
+    }
+    SDL_Log("Generated %d directories with %d files in '%s'", num_dirs, num_files, TREE_ROOT);
+
+    top_files = files_per_dir;
+    txt_files = (files_per_dir + 3) / 4;
+
+    if (!RunBenchmark(NULL, 0, num_dirs - 1 + num_files, iterations) ||
+        !RunBenchmark("*", 0, top_files + ((depth > 0) ? fanout : 0), iterations) ||
+        !RunBenchmark("*/*/*.TXT", 0, (depth >= 2) ? (fanout * fanout * txt_files) : 0, iterations) ||
+        !RunBenchmark("*/*/*.txt", SDL_GLOB_CASEINSENSITIVE, (depth >= 2) ? (fanout * fanout * txt_files) : 0, iterations) ||
+        !RunBenchmark("dir1/*/asset*", SDL_GLOB_CASEINSENSITIVE, (depth >= 2) ? (fanout * files_per_dir) : 0, iterations)) {
+        result = 1;
+    }
+
+    RemoveTree(TREE_ROOT);
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return result;
+}
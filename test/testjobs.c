@@ -0,0 +1,238 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+/* Test and benchmark of the SDL job system */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_CHAIN_JOBS  100
+#define NUM_TREE_LEVELS 12
+#define NUM_ROWS        1080
+#define ROW_WIDTH       1920
+
+static SDL_JobSystem *jobs;
+
+/* A chain of jobs that each depend on the previous one has to run in order */
+static SDL_AtomicInt chain_position;
+static int chain_errors;
+
+static void SDLCALL ChainJob(void *userdata)
+{
+    const int position = (int)(intptr_t)userdata;
+    if (SDL_AddAtomicInt(&chain_position, 1) != position) {
+        ++chain_errors;
+    }
+}
+
+static bool TestChain(void)
+{
+    SDL_Job *chain[NUM_CHAIN_JOBS];
+    int i;
+
+    SDL_SetAtomicInt(&chain_position, 0);
+    chain_errors = 0;
+    for (i = 0; i < NUM_CHAIN_JOBS; ++i) {
+        chain[i] = SDL_SubmitJob(jobs, ChainJob, (void *)(intptr_t)i, i ? &chain[i - 1] : NULL, i ? 1 : 0);
+        if (!chain[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_SubmitJob() failed: %s", SDL_GetError());
+            return false;
+        }
+    }
+    for (i = 0; i < NUM_CHAIN_JOBS; ++i) {
+        SDL_WaitJob(chain[i]);
+    }
+    if (chain_errors || SDL_GetAtomicInt(&chain_position) != NUM_CHAIN_JOBS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Dependent jobs ran out of order");
+        return false;
+    }
+    SDL_Log("Job dependencies: OK");
+    return true;
+}
+
+/* Jobs that submit more jobs and wait for them, to exercise work stealing */
+static SDL_AtomicInt tree_count;
+
+static void SDLCALL TreeJob(void *userdata)
+{
+    const int level = (int)(intptr_t)userdata;
+
+    SDL_AddAtomicInt(&tree_count, 1);
+    if (level > 0) {
+        SDL_Job *left = SDL_SubmitJob(jobs, TreeJob, (void *)(intptr_t)(level - 1), NULL, 0);
+        SDL_Job *right = SDL_SubmitJob(jobs, TreeJob, (void *)(intptr_t)(level - 1), NULL, 0);
+        SDL_WaitJob(left);
+        SDL_WaitJob(right);
+    }
+}
+
+static bool TestTree(void)
+{
+    const int expected = (1 << (NUM_TREE_LEVELS + 1)) - 1;
+
+    SDL_SetAtomicInt(&tree_count, 0);
+    SDL_WaitJob(SDL_SubmitJob(jobs, TreeJob, (void *)(intptr_t)NUM_TREE_LEVELS, NULL, 0));
+    if (SDL_GetAtomicInt(&tree_count) != expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d nested jobs, got %d", expected, SDL_GetAtomicInt(&tree_count));
+        return false;
+    }
+    SDL_Log("Nested jobs: OK");
+    return true;
+}
+
+/* Detached jobs are finished by SDL_DestroyJobSystem() */
+static SDL_AtomicInt detached_count;
+
+static void SDLCALL DetachedJob(void *userdata)
+{
+    (void)userdata;
+    SDL_DelayNS(100000);
+    SDL_AddAtomicInt(&detached_count, 1);
+}
+
+/* Fill the rows of an image, the way a blitter might */
+static Uint32 *pixels;
+
+static void SDLCALL FillRows(void *userdata, int start, int end)
+{
+    const Uint32 value = *(const Uint32 *)userdata;
+    int y, x;
+
+    for (y = start; y < end; ++y) {
+        Uint32 *row = &pixels[y * ROW_WIDTH];
+        for (x = 0; x < ROW_WIDTH; ++x) {
+            row[x] = (value ^ (Uint32)x) + (Uint32)y;
+        }
+    }
+}
+
+static bool TestParallelFor(int iterations)
+{
+    Uint64 start, serial_ns, parallel_ns;
+    Uint32 value = 0;
+    int i, x, y;
+
+    pixels = (Uint32 *)SDL_calloc(NUM_ROWS * ROW_WIDTH, sizeof(*pixels));
+    if (!pixels) {
+        return false;
+    }
+
+    /* Touch the pages first, so the serial pass doesn't pay for that */
+    FillRows(&value, 0, NUM_ROWS);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        value = (Uint32)i;
+        FillRows(&value, 0, NUM_ROWS);
+    }
+    serial_ns = SDL_GetTicksNS() - start;
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        value = (Uint32)i;
+        if (!SDL_ParallelFor(jobs, 0, NUM_ROWS, 0, FillRows, &value)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ParallelFor() failed: %s", SDL_GetError());
+            SDL_free(pixels);
+            return false;
+        }
+    }
+    parallel_ns = SDL_GetTicksNS() - start;
+
+    for (y = 0; y < NUM_ROWS; ++y) {
+        for (x = 0; x < ROW_WIDTH; ++x) {
+            if (pixels[y * ROW_WIDTH + x] != (value ^ (Uint32)x) + (Uint32)y) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ParallelFor() missed pixel %d,%d", x, y);
+                SDL_free(pixels);
+                return false;
+            }
+        }
+    }
+    SDL_free(pixels);
+
+    SDL_Log("Parallel for: OK, %d x %dx%d fill: serial %.3f ms, parallel %.3f ms (%.2fx)",
+            iterations, ROW_WIDTH, NUM_ROWS,
+            (double)serial_ns / SDL_NS_PER_MS, (double)parallel_ns / SDL_NS_PER_MS,
+            parallel_ns ? ((double)serial_ns / (double)parallel_ns) : 0.0);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_workers = 0;
+    int iterations = 20;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed && (i + 1) < argc) {
+            if (SDL_strcmp(argv[i], "--workers") == 0) {
+                num_workers = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                iterations = SDL_max(1, SDL_atoi(argv[i + 1]));
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--workers N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    jobs = SDL_CreateJobSystem(num_workers);
+    if (!jobs) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobSystem() failed: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_Log("Job system with %d workers", SDL_GetJobSystemWorkers(jobs));
+
+    if (!TestChain() || !TestTree() || !TestParallelFor(iterations)) {
+        result = 1;
+    }
+
+    SDL_SetAtomicInt(&detached_count, 0);
+    for (i = 0; i < 100; ++i) {
+        SDL_DetachJob(SDL_SubmitJob(jobs, DetachedJob, NULL, NULL, 0));
+    }
+    SDL_DestroyJobSystem(jobs);
+    if (SDL_GetAtomicInt(&detached_count) != 100) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of 100 detached jobs ran", SDL_GetAtomicInt(&detached_count));
+        result = 1;
+    } else {
+        SDL_Log("Detached jobs: OK");
+    }
+
+    /* The shared job system is used when no job system is given */
+    if (SDL_GetJobSystemWorkers(NULL) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't use the shared job system: %s", SDL_GetError());
+        result = 1;
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return result;
+}
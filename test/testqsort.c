@@ -10,11 +10,14 @@
   freely.
 */
 
+#include <stddef.h>
+
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_test.h>
 
 static int a_global_var = 77;
+static bool failed = false;
 
 static int SDLCALL
 num_compare(const void *_a, const void *_b)
@@ -37,6 +40,7 @@ static void
 test_sort(const char *desc, int *nums, const int arraylen)
 {
     static int nums_copy[1024 * 100];
+    static int nums_radix[1024 * 100];
     int i;
     int prev;
 
@@ -45,22 +49,76 @@ test_sort(const char *desc, int *nums, const int arraylen)
     SDL_Log("test: %s arraylen=%d", desc, arraylen);
 
     SDL_memcpy(nums_copy, nums, arraylen * sizeof (*nums));
+    SDL_memcpy(nums_radix, nums, arraylen * sizeof (*nums));
 
     SDL_qsort(nums, arraylen, sizeof(nums[0]), num_compare);
     SDL_qsort_r(nums_copy, arraylen, sizeof(nums[0]), num_compare_r, &a_global_var);
+    if (!SDL_radixsort(nums_radix, arraylen, sizeof(nums[0]), 0, SDL_SORTKEY_SINT32)) {
+        SDL_Log("radix sort failed: %s", SDL_GetError());
+        failed = true;
+        return;
+    }
 
     prev = nums[0];
     for (i = 1; i < arraylen; i++) {
         const int val = nums[i];
         const int val2 = nums_copy[i];
-        if ((val < prev) || (val != val2)) {
+        const int val3 = nums_radix[i];
+        if ((val < prev) || (val != val2) || (val != val3)) {
             SDL_Log("sort is broken!");
+            failed = true;
             return;
         }
         prev = val;
     }
 }
 
+typedef struct
+{
+    Uint8 pad;
+    float depth;
+    int order;
+} sprite;
+
+static void
+test_radixsort_keys(Uint64 *seed)
+{
+    static sprite sprites[10000];
+    static const float specials[] = { 0.0f, -0.0f, 1e-40f, -1e-40f, 3.4e38f, -3.4e38f };
+    int i;
+
+    SDL_Log("test: radix sort by float key, arraylen=%d", (int)SDL_arraysize(sprites));
+
+    for (i = 0; i < SDL_arraysize(sprites); i++) {
+        if (i < SDL_arraysize(specials)) {
+            sprites[i].depth = specials[i];
+        } else {
+            /* Lots of duplicates, to check that equal keys keep their order */
+            sprites[i].depth = (float)(SDL_rand_r(seed, 2000) - 1000) / 8.0f;
+        }
+        sprites[i].order = i;
+    }
+    if (!SDL_radixsort(sprites, SDL_arraysize(sprites), sizeof(sprites[0]), offsetof(sprite, depth), SDL_SORTKEY_FLOAT)) {
+        SDL_Log("radix sort failed: %s", SDL_GetError());
+        failed = true;
+        return;
+    }
+    for (i = 1; i < SDL_arraysize(sprites); i++) {
+        const sprite *a = &sprites[i - 1];
+        const sprite *b = &sprites[i];
+        Uint32 a_bits, b_bits;
+        SDL_memcpy(&a_bits, &a->depth, sizeof(a_bits));
+        SDL_memcpy(&b_bits, &b->depth, sizeof(b_bits));
+        if (a->depth > b->depth ||
+            (a_bits == b_bits && a->order > b->order) ||
+            (a_bits == 0 && b_bits == 0x80000000)) {
+            SDL_Log("radix sort is broken at %d!", i);
+            failed = true;
+            return;
+        }
+    }
+}
+
 int main(int argc, char *argv[])
 {
     static int nums[1024 * 100];
@@ -130,13 +188,25 @@ int main(int argc, char *argv[])
         test_sort("reverse sorted", nums, arraylen);
 
         for (i = 0; i < arraylen; i++) {
-            nums[i] = SDL_rand_r(&seed, 1000000);
+            nums[i] = (i < arraylen / 2) ? i : (arraylen - i);
+        }
+        test_sort("organ pipe", nums, arraylen);
+
+        for (i = 0; i < arraylen; i++) {
+            nums[i] = i % 16;
+        }
+        test_sort("sawtooth", nums, arraylen);
+
+        for (i = 0; i < arraylen; i++) {
+            nums[i] = SDL_rand_r(&seed, 1000000) - 500000;
         }
         test_sort("random sorted", nums, arraylen);
     }
 
+    test_radixsort_keys(&seed);
+
     SDL_Quit();
     SDLTest_CommonDestroyState(state);
 
-    return 0;
+    return failed ? 1 : 0;
 }